@@ -32,6 +32,11 @@ namespace configuration
 {
 	class OPENKIT_EXPORT Configuration;
 }
+
+namespace protocol
+{
+	class OPENKIT_EXPORT RetryPolicy;
+}
 #endif
 
 namespace openkit
@@ -151,6 +156,89 @@ namespace openkit
 			///
 			AbstractOpenKitBuilder& withCrashReportingLevel(openkit::CrashReportingLevel crashReportingLevel);
 
+			///
+			/// Sets the maximum number of idle HTTP connections kept open for reuse.
+			///
+			/// Reusing a connection avoids a new TCP and TLS handshake for each request sent to the endpoint.
+			/// Setting this to 0 disables reusing connection handles.
+			/// @param[in] poolSize maximum number of idle HTTP connections
+			/// @returns @c this
+			///
+			AbstractOpenKitBuilder& withHTTPClientPoolSize(uint32_t poolSize);
+
+			///
+			/// Sets the time after which idle HTTP connections are no longer reused.
+			///
+			/// @param[in] idleTimeoutInMilliseconds the idle timeout in milliseconds
+			/// @returns @c this
+			///
+			AbstractOpenKitBuilder& withHTTPClientIdleTimeout(int64_t idleTimeoutInMilliseconds);
+
+			///
+			/// Sets the maximum number of beacon requests sent concurrently.
+			///
+			/// Beacon data of different sessions is sent concurrently, while the data of one session is always sent in order.
+			/// Setting this to 1 sends the sessions one after the other.
+			/// @param[in] maxConcurrentBeaconRequests maximum number of beacon requests sent concurrently
+			/// @returns @c this
+			///
+			AbstractOpenKitBuilder& withMaxConcurrentBeaconRequests(uint32_t maxConcurrentBeaconRequests);
+
+			///
+			/// Sets the time window in which new sessions share the response of a single new session request.
+			///
+			/// Instead of sending one request per new session, the multiplicity received for one session is
+			/// applied to all sessions becoming ready to send within the given time.
+			/// Setting this to 0 sends one request per new session.
+			/// @param[in] batchWindowInMilliseconds the batch window in milliseconds
+			/// @returns @c this
+			///
+			AbstractOpenKitBuilder& withNewSessionRequestBatchWindow(int64_t batchWindowInMilliseconds);
+
+			///
+			/// Sets how often and after which delay a failed status request is retried.
+			///
+			/// The delay doubles with each retry, starting at the initial delay, and never exceeds the maximum delay.
+			/// @param[in] maxRetries maximum number of retries after the first attempt
+			/// @param[in] initialDelayInMilliseconds delay before the first retry in milliseconds
+			/// @param[in] maxDelayInMilliseconds upper bound for the delay between two attempts in milliseconds
+			/// @returns @c this
+			///
+			AbstractOpenKitBuilder& withStatusRequestRetryPolicy(uint32_t maxRetries, int64_t initialDelayInMilliseconds, int64_t maxDelayInMilliseconds);
+
+			///
+			/// Sets how often and after which delay a failed time sync request is retried.
+			///
+			/// The delay doubles with each retry, starting at the initial delay, and never exceeds the maximum delay.
+			/// @param[in] maxRetries maximum number of retries after the first attempt
+			/// @param[in] initialDelayInMilliseconds delay before the first retry in milliseconds
+			/// @param[in] maxDelayInMilliseconds upper bound for the delay between two attempts in milliseconds
+			/// @returns @c this
+			///
+			AbstractOpenKitBuilder& withTimeSyncRequestRetryPolicy(uint32_t maxRetries, int64_t initialDelayInMilliseconds, int64_t maxDelayInMilliseconds);
+
+			///
+			/// Sets how often and after which delay a beacon request failing on connection level is retried.
+			///
+			/// The delay doubles with each retry, starting at the initial delay, and never exceeds the maximum delay.
+			/// @param[in] maxRetries maximum number of retries after the first attempt
+			/// @param[in] initialDelayInMilliseconds delay before the first retry in milliseconds
+			/// @param[in] maxDelayInMilliseconds upper bound for the delay between two attempts in milliseconds
+			/// @returns @c this
+			///
+			AbstractOpenKitBuilder& withBeaconRequestRetryPolicy(uint32_t maxRetries, int64_t initialDelayInMilliseconds, int64_t maxDelayInMilliseconds);
+
+			///
+			/// Enables or disables reporting the operating system's thread IDs.
+			///
+			/// By default the thread ID reported with each event is derived from a hash of @c std::thread::id.
+			/// When enabled, the kernel's thread ID is reported instead (e.g. @c gettid on Linux), so that the IDs
+			/// match those shown by profilers and system tools. On platforms without such an ID the hashed ID is used.
+			/// @param[in] useKernelThreadIDs @c true to report kernel thread IDs, @c false to report hashed thread IDs
+			/// @returns @c this
+			///
+			AbstractOpenKitBuilder& withKernelThreadIDs(bool useKernelThreadIDs);
+
 			///
 			/// Builds an @ref openkit::IOpenKit instance
 			/// @return an @ref openkit::IOpenKit instance
@@ -251,6 +339,54 @@ namespace openkit
 			///
 			CrashReportingLevel getCrashReportingLevel() const;
 
+			///
+			/// Returns the maximum number of idle HTTP connections
+			/// @returns the maximum number of idle HTTP connections
+			///
+			uint32_t getHTTPClientPoolSize() const;
+
+			///
+			/// Returns the idle timeout of HTTP connections
+			/// @returns the idle timeout of HTTP connections in milliseconds
+			///
+			int64_t getHTTPClientIdleTimeout() const;
+
+			///
+			/// Returns the maximum number of beacon requests sent concurrently
+			/// @returns the maximum number of beacon requests sent concurrently
+			///
+			uint32_t getMaxConcurrentBeaconRequests() const;
+
+			///
+			/// Returns the time window in which new sessions share the response of a single new session request
+			/// @returns the new session request batch window in milliseconds
+			///
+			int64_t getNewSessionRequestBatchWindow() const;
+
+			///
+			/// Returns the retry policy for status requests
+			/// @returns the retry policy for status requests, @c nullptr if the default is used
+			///
+			std::shared_ptr<const protocol::RetryPolicy> getStatusRequestRetryPolicy() const;
+
+			///
+			/// Returns the retry policy for time sync requests
+			/// @returns the retry policy for time sync requests, @c nullptr if the default is used
+			///
+			std::shared_ptr<const protocol::RetryPolicy> getTimeSyncRequestRetryPolicy() const;
+
+			///
+			/// Returns the retry policy for beacon requests failing on connection level
+			/// @returns the retry policy for beacon requests, @c nullptr if the default is used
+			///
+			std::shared_ptr<const protocol::RetryPolicy> getBeaconRequestRetryPolicy() const;
+
+			///
+			/// Returns a flag if the operating system's thread IDs are reported
+			/// @returns @c true if kernel thread IDs are reported, @c false otherwise
+			///
+			bool isUsingKernelThreadIDs() const;
+
 		public:
 			///
 			/// Returns a @ref openkit::ILogger. If no logger is set, when building the OpenKit with @ref build(),
@@ -301,6 +437,30 @@ namespace openkit
 
 			/// crash reporting level
 			openkit::CrashReportingLevel mCrashReportingLevel;
+
+			/// maximum number of idle HTTP connections
+			uint32_t mHTTPClientPoolSize;
+
+			/// idle timeout of HTTP connections
+			int64_t mHTTPClientIdleTimeout;
+
+			/// maximum number of beacon requests sent concurrently
+			uint32_t mMaxConcurrentBeaconRequests;
+
+			/// time window in which new sessions share the response of a single new session request
+			int64_t mNewSessionRequestBatchWindow;
+
+			/// retry policy for status requests, @c nullptr to use the default
+			std::shared_ptr<const protocol::RetryPolicy> mStatusRequestRetryPolicy;
+
+			/// retry policy for time sync requests, @c nullptr to use the default
+			std::shared_ptr<const protocol::RetryPolicy> mTimeSyncRequestRetryPolicy;
+
+			/// retry policy for beacon requests, @c nullptr to use the default
+			std::shared_ptr<const protocol::RetryPolicy> mBeaconRequestRetryPolicy;
+
+			/// flag if the operating system's thread IDs are reported
+			bool mUseKernelThreadIDs;
 	};
 }
 
@@ -77,6 +77,17 @@ namespace openkit
 		///
 		virtual std::shared_ptr<openkit::ISession> createSession(const char* clientIPAddress) = 0;
 
+		///
+		/// Sends the data collected so far by all Sessions without waiting for the send interval to expire.
+		///
+		/// The calling thread is blocked until the data was acknowledged by the server, OpenKit is shut down
+		/// or the timeout expired. Sessions are sent concurrently, as configured by
+		/// @ref openkit::AbstractOpenKitBuilder::withMaxConcurrentBeaconRequests.
+		/// @param[in] timeoutMillis The maximum number of milliseconds to wait for the data being sent.
+		/// @returns @c true when all data was sent, @c false when a shutdown request was made or @c timeoutMillis expired.
+		///
+		virtual bool flush(int64_t timeoutMillis) = 0;
+
 		///
 		/// Shuts down OpenKit, ending all open Sessions and waiting for them to be sent.
 		///
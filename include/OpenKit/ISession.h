@@ -73,6 +73,13 @@ namespace openkit
 		///
 		virtual std::shared_ptr<IWebRequestTracer> traceWebRequest(const char* url) = 0;
 
+		///
+		/// Sends the data collected so far by this Session without waiting for the send interval to expire.
+		///
+		/// This method does not block. Use @ref openkit::IOpenKit::flush(int64_t) to wait until the data was sent.
+		///
+		virtual void flush() = 0;
+
 		///
 		/// Ends this Session and marks it as ready for immediate sending.
 		/// @remarks All previously added action are implicitly closed
@@ -284,6 +284,18 @@ extern "C" {
 	///
 	OPENKIT_EXPORT bool isInitialized(struct OpenKitHandle* openKitHandle);
 
+	///
+	/// Sends the data collected so far by all sessions without waiting for the send interval to expire.
+	///
+	/// The calling thread is blocked until the data was acknowledged by the server, OpenKit is shut down
+	/// or the timeout expired.
+	///
+	/// @param[in] openKitHandle the handle returned by @ref createDynatraceOpenKit or @ref createAppMonOpenKit
+	/// @param[in] timeoutMillis The maximum number of milliseconds to wait for the data being sent.
+	/// @returns @c true when all data was sent, @c false when a shutdown request was made or @c timeoutMillis expired.
+	///
+	OPENKIT_EXPORT bool flushOpenKit(struct OpenKitHandle* openKitHandle, int64_t timeoutMillis);
+
 
 	//--------------
 	//  Session
@@ -325,6 +337,13 @@ extern "C" {
 	///
 	OPENKIT_EXPORT void reportCrash(struct SessionHandle* sessionHandle, const char* errorName, const char* reason, const char* stacktrace);
 
+	///
+	/// Sends the data collected so far by this session without waiting for the send interval to expire.
+	/// This function does not block, use @ref flushOpenKit to wait until the data was sent.
+	/// @param[in] sessionHandle the handle returned by @ref createSession
+	///
+	OPENKIT_EXPORT void flushSession(struct SessionHandle* sessionHandle);
+
 	//--------------
 	//  Root Action
 	//--------------
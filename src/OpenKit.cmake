@@ -50,12 +50,16 @@ set(OPENKIT_SOURCES_C_API
 set(OPENKIT_SOURCES_CACHING
     ${CMAKE_CURRENT_LIST_DIR}/caching/BeaconCache.cxx
     ${CMAKE_CURRENT_LIST_DIR}/caching/BeaconCache.h
+    ${CMAKE_CURRENT_LIST_DIR}/caching/BeaconCacheArena.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/caching/BeaconCacheArena.h
     ${CMAKE_CURRENT_LIST_DIR}/caching/BeaconCacheEntry.cxx
     ${CMAKE_CURRENT_LIST_DIR}/caching/BeaconCacheEntry.h
     ${CMAKE_CURRENT_LIST_DIR}/caching/BeaconCacheEvictor.cxx
     ${CMAKE_CURRENT_LIST_DIR}/caching/BeaconCacheEvictor.h
     ${CMAKE_CURRENT_LIST_DIR}/caching/BeaconCacheRecord.cxx
     ${CMAKE_CURRENT_LIST_DIR}/caching/BeaconCacheRecord.h
+    ${CMAKE_CURRENT_LIST_DIR}/caching/BeaconChunk.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/caching/BeaconChunk.h
     ${CMAKE_CURRENT_LIST_DIR}/caching/IBeaconCache.h
     ${CMAKE_CURRENT_LIST_DIR}/caching/IObserver.h
     ${CMAKE_CURRENT_LIST_DIR}/caching/SpaceEvictionStrategy.cxx
@@ -103,8 +107,6 @@ set(OPENKIT_SOURCES_CONFIGURATION
 )
 
 set(OPENKIT_SOURCES_CORE_UTIL
-    ${CMAKE_CURRENT_LIST_DIR}/core/util/Compressor.cxx
-    ${CMAKE_CURRENT_LIST_DIR}/core/util/Compressor.h
     ${CMAKE_CURRENT_LIST_DIR}/core/util/CountDownLatch.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/util/CountDownLatch.h
     ${CMAKE_CURRENT_LIST_DIR}/core/util/CyclicBarrier.cxx
@@ -116,6 +118,9 @@ set(OPENKIT_SOURCES_CORE_UTIL
     ${CMAKE_CURRENT_LIST_DIR}/core/util/ReadWriteLock.h
     ${CMAKE_CURRENT_LIST_DIR}/core/util/ScopedReadLock.h
     ${CMAKE_CURRENT_LIST_DIR}/core/util/ScopedWriteLock.h
+    ${CMAKE_CURRENT_LIST_DIR}/core/util/SIMDSupport.h
+    ${CMAKE_CURRENT_LIST_DIR}/core/util/StreamingCompressor.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/util/StreamingCompressor.h
     ${CMAKE_CURRENT_LIST_DIR}/core/util/SynchronizedQueue.h
     ${CMAKE_CURRENT_LIST_DIR}/core/util/URLEncoding.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/util/URLEncoding.h
@@ -138,10 +143,14 @@ set(OPENKIT_SOURCES_CORE
     ${CMAKE_CURRENT_LIST_DIR}/core/RootAction.h
     ${CMAKE_CURRENT_LIST_DIR}/core/Session.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/Session.h
+    ${CMAKE_CURRENT_LIST_DIR}/core/SessionRegistry.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/SessionRegistry.h
     ${CMAKE_CURRENT_LIST_DIR}/core/SessionWrapper.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/SessionWrapper.h
     ${CMAKE_CURRENT_LIST_DIR}/core/UTF8String.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/UTF8String.h
+    ${CMAKE_CURRENT_LIST_DIR}/core/UTF8StringView.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/core/UTF8StringView.h
     ${CMAKE_CURRENT_LIST_DIR}/core/WebRequestTracerBase.cxx
     ${CMAKE_CURRENT_LIST_DIR}/core/WebRequestTracerBase.h
     ${CMAKE_CURRENT_LIST_DIR}/core/WebRequestTracerStringURL.cxx
@@ -159,14 +168,25 @@ set(OPENKIT_SOURCES_PROTOCOL
     ${CMAKE_CURRENT_LIST_DIR}/protocol/Beacon.cxx
     ${CMAKE_CURRENT_LIST_DIR}/protocol/Beacon.h
     ${CMAKE_CURRENT_LIST_DIR}/protocol/BeaconProtocolConstants.h
+    ${CMAKE_CURRENT_LIST_DIR}/protocol/CurlHandlePool.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/protocol/CurlHandlePool.h
     ${CMAKE_CURRENT_LIST_DIR}/protocol/EventType.h
+    ${CMAKE_CURRENT_LIST_DIR}/protocol/EventWriter.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/protocol/EventWriter.h
     ${CMAKE_CURRENT_LIST_DIR}/protocol/HTTPClient.cxx
     ${CMAKE_CURRENT_LIST_DIR}/protocol/HTTPClient.h
+    ${CMAKE_CURRENT_LIST_DIR}/protocol/HTTPMultiClient.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/protocol/HTTPMultiClient.h
     ${CMAKE_CURRENT_LIST_DIR}/protocol/HTTPResponseParser.cxx
     ${CMAKE_CURRENT_LIST_DIR}/protocol/HTTPResponseParser.h
+    ${CMAKE_CURRENT_LIST_DIR}/protocol/ImmutableBeaconData.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/protocol/ImmutableBeaconData.h
     ${CMAKE_CURRENT_LIST_DIR}/protocol/IHTTPClient.h
+    ${CMAKE_CURRENT_LIST_DIR}/protocol/IHTTPMultiClient.h
     ${CMAKE_CURRENT_LIST_DIR}/protocol/Response.cxx
     ${CMAKE_CURRENT_LIST_DIR}/protocol/Response.h
+    ${CMAKE_CURRENT_LIST_DIR}/protocol/RetryPolicy.cxx
+    ${CMAKE_CURRENT_LIST_DIR}/protocol/RetryPolicy.h
     ${CMAKE_CURRENT_LIST_DIR}/protocol/StatusResponse.cxx
     ${CMAKE_CURRENT_LIST_DIR}/protocol/StatusResponse.h
     ${CMAKE_CURRENT_LIST_DIR}/protocol/TimeSyncResponse.cxx
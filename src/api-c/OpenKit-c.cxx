@@ -628,6 +628,22 @@ extern "C" {
 		return false;
 	}
 
+	bool flushOpenKit(struct OpenKitHandle* openKitHandle, int64_t timeoutMillis)
+	{
+		TRY
+		{
+			if (openKitHandle)
+			{
+				// retrieve the OpenKit instance from the handle and call the respective method
+				assert(openKitHandle->sharedPointer != nullptr);
+				return openKitHandle->sharedPointer->flush(timeoutMillis);
+			}
+		}
+		CATCH_AND_LOG(openKitHandle)
+
+		return false;
+	}
+
 	//--------------
 	//  Session
 	//--------------
@@ -713,6 +729,20 @@ extern "C" {
 		CATCH_AND_LOG(sessionHandle)
 	}
 
+	void flushSession(SessionHandle* sessionHandle)
+	{
+		TRY
+		{
+			if (sessionHandle)
+			{
+				// retrieve the Session instance from the handle and call the respective method
+				assert(sessionHandle->sharedPointer != nullptr);
+				sessionHandle->sharedPointer->flush();
+			}
+		}
+		CATCH_AND_LOG(sessionHandle)
+	}
+
 	//--------------
 	//  Root Action
 	//--------------
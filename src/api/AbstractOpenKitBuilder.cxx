@@ -19,6 +19,8 @@
 #include "core/OpenKit.h"
 #include "OpenKit/OpenKitConstants.h"
 #include "protocol/ssl/SSLStrictTrustManager.h"
+#include "configuration/HTTPClientConfiguration.h"
+#include "protocol/RetryPolicy.h"
 
 using namespace openkit;
 
@@ -42,6 +44,14 @@ AbstractOpenKitBuilder::AbstractOpenKitBuilder(const char* endpointURL, const ch
 	, mBeaconCacheUpperMemoryBoundary(configuration::BeaconCacheConfiguration::DEFAULT_UPPER_MEMORY_BOUNDARY_IN_BYTES)
 	, mDataCollectionLevel(configuration::BeaconConfiguration::DEFAULT_DATA_COLLECTION_LEVEL)
 	, mCrashReportingLevel(configuration::BeaconConfiguration::DEFAULT_CRASH_REPORTING_LEVEL)
+	, mHTTPClientPoolSize(configuration::HTTPClientConfiguration::DEFAULT_HTTP_CLIENT_POOL_SIZE)
+	, mHTTPClientIdleTimeout(configuration::HTTPClientConfiguration::DEFAULT_HTTP_CLIENT_IDLE_TIMEOUT_IN_MILLIS)
+	, mMaxConcurrentBeaconRequests(configuration::HTTPClientConfiguration::DEFAULT_MAX_CONCURRENT_BEACON_REQUESTS)
+	, mNewSessionRequestBatchWindow(configuration::HTTPClientConfiguration::DEFAULT_NEW_SESSION_REQUEST_BATCH_WINDOW_IN_MILLIS)
+	, mStatusRequestRetryPolicy(nullptr)
+	, mTimeSyncRequestRetryPolicy(nullptr)
+	, mBeaconRequestRetryPolicy(nullptr)
+	, mUseKernelThreadIDs(false)
 {
 
 }
@@ -134,6 +144,54 @@ AbstractOpenKitBuilder& AbstractOpenKitBuilder::withCrashReportingLevel(CrashRep
 	return *this;
 }
 
+AbstractOpenKitBuilder& AbstractOpenKitBuilder::withHTTPClientPoolSize(uint32_t poolSize)
+{
+	mHTTPClientPoolSize = poolSize;
+	return *this;
+}
+
+AbstractOpenKitBuilder& AbstractOpenKitBuilder::withHTTPClientIdleTimeout(int64_t idleTimeoutInMilliseconds)
+{
+	mHTTPClientIdleTimeout = idleTimeoutInMilliseconds;
+	return *this;
+}
+
+AbstractOpenKitBuilder& AbstractOpenKitBuilder::withMaxConcurrentBeaconRequests(uint32_t maxConcurrentBeaconRequests)
+{
+	mMaxConcurrentBeaconRequests = maxConcurrentBeaconRequests;
+	return *this;
+}
+
+AbstractOpenKitBuilder& AbstractOpenKitBuilder::withNewSessionRequestBatchWindow(int64_t batchWindowInMilliseconds)
+{
+	mNewSessionRequestBatchWindow = batchWindowInMilliseconds;
+	return *this;
+}
+
+AbstractOpenKitBuilder& AbstractOpenKitBuilder::withStatusRequestRetryPolicy(uint32_t maxRetries, int64_t initialDelayInMilliseconds, int64_t maxDelayInMilliseconds)
+{
+	mStatusRequestRetryPolicy = std::make_shared<protocol::RetryPolicy>(maxRetries, initialDelayInMilliseconds, maxDelayInMilliseconds);
+	return *this;
+}
+
+AbstractOpenKitBuilder& AbstractOpenKitBuilder::withTimeSyncRequestRetryPolicy(uint32_t maxRetries, int64_t initialDelayInMilliseconds, int64_t maxDelayInMilliseconds)
+{
+	mTimeSyncRequestRetryPolicy = std::make_shared<protocol::RetryPolicy>(maxRetries, initialDelayInMilliseconds, maxDelayInMilliseconds);
+	return *this;
+}
+
+AbstractOpenKitBuilder& AbstractOpenKitBuilder::withBeaconRequestRetryPolicy(uint32_t maxRetries, int64_t initialDelayInMilliseconds, int64_t maxDelayInMilliseconds)
+{
+	mBeaconRequestRetryPolicy = std::make_shared<protocol::RetryPolicy>(maxRetries, initialDelayInMilliseconds, maxDelayInMilliseconds);
+	return *this;
+}
+
+AbstractOpenKitBuilder& AbstractOpenKitBuilder::withKernelThreadIDs(bool useKernelThreadIDs)
+{
+	mUseKernelThreadIDs = useKernelThreadIDs;
+	return *this;
+}
+
 std::shared_ptr<openkit::IOpenKit> AbstractOpenKitBuilder::build()
 {
 	auto openKit = std::make_shared<core::OpenKit>(getLogger(), buildConfiguration());
@@ -208,4 +266,44 @@ openkit::DataCollectionLevel AbstractOpenKitBuilder::getDataCollectionLevel() co
 openkit::CrashReportingLevel AbstractOpenKitBuilder::getCrashReportingLevel() const
 {
 	return mCrashReportingLevel;
+}
+
+uint32_t AbstractOpenKitBuilder::getHTTPClientPoolSize() const
+{
+	return mHTTPClientPoolSize;
+}
+
+int64_t AbstractOpenKitBuilder::getHTTPClientIdleTimeout() const
+{
+	return mHTTPClientIdleTimeout;
+}
+
+uint32_t AbstractOpenKitBuilder::getMaxConcurrentBeaconRequests() const
+{
+	return mMaxConcurrentBeaconRequests;
+}
+
+int64_t AbstractOpenKitBuilder::getNewSessionRequestBatchWindow() const
+{
+	return mNewSessionRequestBatchWindow;
+}
+
+std::shared_ptr<const protocol::RetryPolicy> AbstractOpenKitBuilder::getStatusRequestRetryPolicy() const
+{
+	return mStatusRequestRetryPolicy;
+}
+
+std::shared_ptr<const protocol::RetryPolicy> AbstractOpenKitBuilder::getTimeSyncRequestRetryPolicy() const
+{
+	return mTimeSyncRequestRetryPolicy;
+}
+
+std::shared_ptr<const protocol::RetryPolicy> AbstractOpenKitBuilder::getBeaconRequestRetryPolicy() const
+{
+	return mBeaconRequestRetryPolicy;
+}
+
+bool AbstractOpenKitBuilder::isUsingKernelThreadIDs() const
+{
+	return mUseKernelThreadIDs;
 }
\ No newline at end of file
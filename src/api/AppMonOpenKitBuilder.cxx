@@ -58,6 +58,14 @@ std::shared_ptr<configuration::Configuration> AppMonOpenKitBuilder::buildConfigu
 		std::make_shared<providers::DefaultSessionIDProvider>(),
 		getTrustManager(),
 		beaconCacheConfiguration,
-		beaconConfiguration
+		beaconConfiguration,
+		getHTTPClientPoolSize(),
+		getHTTPClientIdleTimeout(),
+		getMaxConcurrentBeaconRequests(),
+		getNewSessionRequestBatchWindow(),
+		isUsingKernelThreadIDs(),
+		getStatusRequestRetryPolicy(),
+		getTimeSyncRequestRetryPolicy(),
+		getBeaconRequestRetryPolicy()
 		);
 }
@@ -59,7 +59,15 @@ std::shared_ptr<configuration::Configuration> DynatraceOpenKitBuilder::buildConf
 			std::make_shared<providers::DefaultSessionIDProvider>(),
 			getTrustManager(),
 			beaconCacheConfiguration,
-			beaconConfiguration
+			beaconConfiguration,
+			getHTTPClientPoolSize(),
+			getHTTPClientIdleTimeout(),
+			getMaxConcurrentBeaconRequests(),
+			getNewSessionRequestBatchWindow(),
+			isUsingKernelThreadIDs(),
+			getStatusRequestRetryPolicy(),
+			getTimeSyncRequestRetryPolicy(),
+			getBeaconRequestRetryPolicy()
 		);
 }
 
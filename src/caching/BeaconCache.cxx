@@ -20,13 +20,21 @@
 #include <inttypes.h> // for PRId64 macro
 
 using namespace caching;
+
+constexpr uint32_t BeaconCache::NUMBER_OF_SHARDS;
  
 BeaconCache::BeaconCache(std::shared_ptr<openkit::ILogger> logger)
 	: mLogger(logger)
 	, observers()
-	, mGlobalCacheLock()
-	, mBeacons()
+	, mShards()
 	, mCacheSizeInBytes(0)
+{
+
+}
+
+BeaconCache::Shard::Shard()
+	: lock()
+	, beacons()
 {
 
 }
@@ -46,17 +54,7 @@ void BeaconCache::addEventData(int32_t beaconID, int64_t timestamp, const core::
 		mLogger->debug("BeaconCache addEventData(sn=%d, timestamp=%" PRId64 ", data='%s')", beaconID, timestamp, data.getStringData().c_str());
 	}
 
-	// get a reference to the cache entry
-	auto entry = getCachedEntryOrInsert(beaconID);
-
-	BeaconCacheRecord record(timestamp, data);
-	
-	std::unique_lock<std::mutex> lock(entry->getLock());
-	entry->addEventData(record);
-	lock.unlock();
-
-	// update cache stats
-	mCacheSizeInBytes += record.getDataSizeInBytes();
+	addData(beaconID, timestamp, data, &BeaconCacheEntry::addEventData);
 
 	// notify observers
 	onDataAdded();
@@ -69,46 +67,74 @@ void BeaconCache::addActionData(int32_t beaconID, int64_t timestamp, const core:
 		mLogger->debug("BeaconCache addActionData(sn=%d, timestamp=%" PRId64 ", data='%s')", beaconID, timestamp, data.getStringData().c_str());
 	}
 
-	// get a reference to the cache entry
-	auto entry = getCachedEntryOrInsert(beaconID);
-
-	BeaconCacheRecord record(timestamp, data);
-	std::unique_lock<std::mutex> lock(entry->getLock());
-	entry->addActionData(record);
-	lock.unlock();
-
-	// update cache stats
-	mCacheSizeInBytes += record.getDataSizeInBytes();
+	addData(beaconID, timestamp, data, &BeaconCacheEntry::addActionData);
 
 	// notify observers
 	onDataAdded();
 }
 
+void BeaconCache::addData(int32_t beaconID, int64_t timestamp, const core::UTF8String& data, AddDataFunction addData)
+{
+	auto& shard = getShard(beaconID);
+
+	{
+		// fast path - the entry already exists, which is the common case
+		core::util::ScopedReadLock lock(shard.lock);
+		auto it = shard.beacons.find(beaconID);
+		if (it != shard.beacons.end())
+		{
+			std::lock_guard<std::mutex> entryLock(it->second->getLock());
+			(it->second.get()->*addData)(timestamp, data);
+		}
+		else
+		{
+			lock.unlock();
+
+			// does not exist, and needs to be inserted
+			core::util::ScopedWriteLock writeLock(shard.lock);
+
+			// double check since this could have been added in the mean time
+			auto& entry = shard.beacons[beaconID];
+			if (entry == nullptr)
+			{
+				entry = std::make_shared<BeaconCacheEntry>();
+			}
+
+			std::lock_guard<std::mutex> entryLock(entry->getLock());
+			(entry.get()->*addData)(timestamp, data);
+		}
+	}
+
+	// update cache stats
+	mCacheSizeInBytes.fetch_add(static_cast<int64_t>(data.getStringData().size()), std::memory_order_relaxed);
+}
+
 void BeaconCache::deleteCacheEntry(int32_t beaconID)
 {
-	core::util::ScopedWriteLock lock(mGlobalCacheLock);
+	auto& shard = getShard(beaconID);
+	core::util::ScopedWriteLock lock(shard.lock);
 	if (mLogger->isDebugEnabled())
 	{
 		mLogger->debug("BeaconCache deleteCacheEntry(sn=%d)", beaconID);
 	}
 	
-	auto it = mBeacons.find(beaconID);
-	if (it != mBeacons.end())
+	auto it = shard.beacons.find(beaconID);
+	if (it != shard.beacons.end())
 	{
-		mCacheSizeInBytes -= it->second->getTotalNumberOfBytes();
-		mBeacons.erase(it);
+		mCacheSizeInBytes.fetch_sub(it->second->getTotalNumberOfBytes(), std::memory_order_relaxed);
+		shard.beacons.erase(it);
 	}
 	
 	lock.unlock();
 }
 
-const core::UTF8String BeaconCache::getNextBeaconChunk(int32_t beaconID, const core::UTF8String& chunkPrefix, int32_t maxSize, const core::UTF8String& delimiter)
+std::shared_ptr<BeaconChunk> BeaconCache::getNextBeaconChunk(int32_t beaconID, const core::UTF8String& chunkPrefix, int32_t maxSize, const core::UTF8String& delimiter)
 {
 	auto entry = getCachedEntry(beaconID);
 	if (entry == nullptr)
 	{
 		// a cache entry for the given beaconID does not exist
-		return core::UTF8String();
+		return nullptr;
 	}
 
 	if (entry->needsDataCopyBeforeChunking())
@@ -121,11 +147,22 @@ const core::UTF8String BeaconCache::getNextBeaconChunk(int32_t beaconID, const c
 		lock.unlock();
 
 		// assumption: sending will work fine, and everything we copied will be removed quite soon
-		mCacheSizeInBytes -= numBytes;
+		mCacheSizeInBytes.fetch_sub(numBytes, std::memory_order_relaxed);
 	}
 
 	// data for chunking is available
-	return entry->getChunk(chunkPrefix, maxSize, delimiter);
+	// the lock is required, since the arena's segment list may be modified concurrently by adding or evicting data
+	std::unique_lock<std::mutex> lock(entry->getLock());
+	auto chunk = entry->getChunk(chunkPrefix, maxSize, delimiter);
+	lock.unlock();
+
+	if (chunk != nullptr)
+	{
+		// the chunk references the entry's data, keep it alive even if the entry is deleted in the mean time
+		chunk->setDataOwner(entry);
+	}
+
+	return chunk;
 }
 
 void BeaconCache::removeChunkedData(int32_t beaconID)
@@ -137,6 +174,8 @@ void BeaconCache::removeChunkedData(int32_t beaconID)
 		return;
 	}
 
+	// releasing the records' data modifies the arena, which is shared with concurrently added data
+	std::lock_guard<std::mutex> lock(entry->getLock());
 	entry->removeDataMarkedForSending();
 }
 
@@ -157,38 +196,12 @@ void BeaconCache::resetChunkedData(int32_t beaconID)
 	numBytes = newSize - oldSize;
 	lock.unlock();
 
-	mCacheSizeInBytes += numBytes;
+	mCacheSizeInBytes.fetch_add(numBytes, std::memory_order_relaxed);
 
 	// notify observers
 	onDataAdded();
 }
 
-std::shared_ptr<BeaconCacheEntry> BeaconCache::getCachedEntryOrInsert(int beaconID)
-{
-	auto entry = getCachedEntry(beaconID);
-	if (entry == nullptr)
-	{
-		// does not exist, and needs to be inserted
-		core::util::ScopedWriteLock lock(mGlobalCacheLock);
-		
-		// double check since this could have been added in the mean time
-		auto it = mBeacons.find(beaconID);
-		if (it == mBeacons.end())
-		{
-			entry = std::make_shared<BeaconCacheEntry>();
-			mBeacons.insert(std::make_pair(beaconID, entry));
-		}
-		else
-		{
-			entry = it->second;
-		}
-
-		lock.unlock();
-	}
-
-	return entry;
-}
-
 const std::vector<core::UTF8String> BeaconCache::getEvents(int32_t beaconID)
 {
 	auto entry = getCachedEntry(beaconID);
@@ -214,6 +227,8 @@ const std::list<BeaconCacheRecord> BeaconCache::getEventsBeingSent(int32_t beaco
 		return {};
 	}
 
+	// the records reference the entry's arena, which grows concurrently
+	std::unique_lock<std::mutex> lock(entry->getLock());
 	return entry->getEventDataBeingSent();
 }
 
@@ -242,6 +257,8 @@ const std::list<BeaconCacheRecord> BeaconCache::getActionsBeingSent(int32_t beac
 		return {};
 	}
 
+	// the records reference the entry's arena, which grows concurrently
+	std::unique_lock<std::mutex> lock(entry->getLock());
 	return entry->getActionDataBeingSent();
 }
 
@@ -260,9 +277,10 @@ std::shared_ptr<BeaconCacheEntry> BeaconCache::getCachedEntry(int32_t beaconID)
 	std::shared_ptr<BeaconCacheEntry> entry = nullptr;
 
 	// acquire read lock and get the entry
-	core::util::ScopedReadLock lock(mGlobalCacheLock);
-	auto it = mBeacons.find(beaconID);
-	if (it != mBeacons.end())
+	auto& shard = getShard(beaconID);
+	core::util::ScopedReadLock lock(shard.lock);
+	auto it = shard.beacons.find(beaconID);
+	if (it != shard.beacons.end())
 	{
 		entry = it->second;
 	}
@@ -275,16 +293,23 @@ const std::unordered_set<int32_t> BeaconCache::getBeaconIDs()
 {
 	std::unordered_set<int32_t> result;
 	
-	core::util::ScopedReadLock lock(mGlobalCacheLock);
-	for (auto const& beacon : mBeacons)
+	for (auto& shard : mShards)
 	{
-		result.insert(beacon.first);
+		core::util::ScopedReadLock lock(shard.lock);
+		for (auto const& beacon : shard.beacons)
+		{
+			result.insert(beacon.first);
+		}
 	}
-	lock.unlock();
 	
 	return result;
 }
 
+BeaconCache::Shard& BeaconCache::getShard(int32_t beaconID)
+{
+	return mShards[static_cast<uint32_t>(beaconID) & (NUMBER_OF_SHARDS - 1)];
+}
+
 uint32_t BeaconCache::evictRecordsByAge(int32_t beaconID, int64_t minTimestamp)
 {
 	auto entry = getCachedEntry(beaconID);
@@ -295,9 +320,13 @@ uint32_t BeaconCache::evictRecordsByAge(int32_t beaconID, int64_t minTimestamp)
 	}
 
 	std::unique_lock<std::mutex> lock(entry->getLock());
+	int64_t oldSize = entry->getTotalNumberOfBytes();
 	uint32_t numRecordsRemoved = entry->removeRecordsOlderThan(minTimestamp);
+	int64_t numBytes = oldSize - entry->getTotalNumberOfBytes();
 	lock.unlock();
 
+	mCacheSizeInBytes.fetch_sub(numBytes, std::memory_order_relaxed);
+
 	if (mLogger->isDebugEnabled())
 	{
 		mLogger->debug("BeaconCache evictRecordsByAge(sn=%d, minTimestamp=%" PRId64 ") has evicted %u records", beaconID, minTimestamp, numRecordsRemoved);
@@ -316,9 +345,13 @@ uint32_t BeaconCache::evictRecordsByNumber(int32_t beaconID, uint32_t numRecords
 	}
 
 	std::unique_lock<std::mutex> lock(entry->getLock());
+	int64_t oldSize = entry->getTotalNumberOfBytes();
 	uint32_t numRecordsRemoved = entry->removeOldestRecords(numRecords);
+	int64_t numBytes = oldSize - entry->getTotalNumberOfBytes();
 	lock.unlock();
 
+	mCacheSizeInBytes.fetch_sub(numBytes, std::memory_order_relaxed);
+
 	if (mLogger->isDebugEnabled())
 	{
 		mLogger->debug("BeaconCache evictRecordsByNumber(sn=%d, numRecords=%u) has evicted %u records", beaconID, numRecords, numRecordsRemoved);
@@ -327,9 +360,26 @@ uint32_t BeaconCache::evictRecordsByNumber(int32_t beaconID, uint32_t numRecords
 	return numRecordsRemoved;
 }
 
+std::vector<BeaconCacheRecordSummary> BeaconCache::getOldestRecords(int32_t beaconID, BeaconCacheRecordCursor& cursor, uint32_t maxNumRecords)
+{
+	auto entry = getCachedEntry(beaconID);
+	if (entry == nullptr)
+	{
+		// already removed
+		return {};
+	}
+
+	std::vector<BeaconCacheRecordSummary> records;
+	std::unique_lock<std::mutex> lock(entry->getLock());
+	entry->getOldestRecords(cursor, maxNumRecords, records);
+	lock.unlock();
+
+	return records;
+}
+
 int64_t BeaconCache::getNumBytesInCache() const
 {
-	return mCacheSizeInBytes;
+	return mCacheSizeInBytes.load(std::memory_order_relaxed);
 }
 
 void BeaconCache::onDataAdded()
@@ -24,6 +24,7 @@
 #include "core/util/ScopedWriteLock.h"
 #include "caching/BeaconCacheEntry.h"
 
+#include <array>
 #include <unordered_set>
 #include <unordered_map>
 #include <vector>
@@ -37,6 +38,9 @@ namespace caching
 	///
 	/// This cache needs to deal with high concurrency, since it's possible that a lot of threads insert new data concurrently.
 	/// Furthermore two OpenKit internal threads are also accessing the cache.
+	///
+	/// To avoid a single point of contention the beacons are distributed over @ref NUMBER_OF_SHARDS shards by their beacon ID,
+	/// each shard being protected by its own lock. Threads reporting data for different beacons therefore rarely contend.
 	///
 	class BeaconCache : public IBeaconCache
 	{
@@ -69,7 +73,7 @@ namespace caching
 
 		virtual void deleteCacheEntry(int32_t beaconID) override;
 
-		virtual const core::UTF8String getNextBeaconChunk(int32_t beaconID, const core::UTF8String& chunkPrefix, int32_t maxSize, const core::UTF8String& delimiter) override;
+		virtual std::shared_ptr<BeaconChunk> getNextBeaconChunk(int32_t beaconID, const core::UTF8String& chunkPrefix, int32_t maxSize, const core::UTF8String& delimiter) override;
 
 		virtual void removeChunkedData(int32_t beaconID) override;
 
@@ -121,17 +125,55 @@ namespace caching
 
 		virtual uint32_t evictRecordsByNumber(int32_t beaconID, uint32_t numRecords) override;
 
+		virtual std::vector<BeaconCacheRecordSummary> getOldestRecords(int32_t beaconID, BeaconCacheRecordCursor& cursor, uint32_t maxNumRecords) override;
+
 		virtual int64_t getNumBytesInCache() const override;
 
 		virtual bool isEmpty(int32_t beaconID) override;
 
+		/// Number of independently locked shards, must be a power of two
+		static constexpr uint32_t NUMBER_OF_SHARDS = 16;
+
 	private:
 		///
-		/// Get cached @ref BeaconCacheEntry or insert new one if nothing exists for given @c beaconID.
-		/// @param beaconID The beacon id to search for.
-		/// @return The already cached entry or newly created one.
+		/// Part of the cache holding all beacons whose ID maps to this shard.
+		///
+		struct Shard
+		{
+			///
+			/// Default constructor
+			///
+			Shard();
+
+			/// Locks this shard's beacons for read and write access
+			core::util::ReadWriteLock lock;
+
+			/// The beacons of this shard (key=beaconID, value=cache entry)
+			std::unordered_map<int32_t, std::shared_ptr<BeaconCacheEntry>> beacons;
+		};
+
+		///
+		/// Pointer to @ref BeaconCacheEntry::addEventData or @ref BeaconCacheEntry::addActionData
 		///
-		std::shared_ptr<BeaconCacheEntry> getCachedEntryOrInsert(int beaconID);
+		typedef void (BeaconCacheEntry::*AddDataFunction)(int64_t, const core::UTF8String&);
+
+		///
+		/// Get the shard responsible for the given @c beaconID.
+		/// @param beaconID The beacon id.
+		/// @return The shard for the beacon id.
+		///
+		Shard& getShard(int32_t beaconID);
+
+		///
+		/// Add data to the cache entry of @c beaconID, creating the entry if it does not exist yet.
+		///
+		/// The data is added while holding the shard's lock, so that no reference to the entry needs to be acquired.
+		/// @param beaconID The beacon id.
+		/// @param timestamp The data's timestamp.
+		/// @param data The serialized data.
+		/// @param addData The entry's method to add the data.
+		///
+		void addData(int32_t beaconID, int64_t timestamp, const core::UTF8String& data, AddDataFunction addData);
 
 		///
 		/// Get cached @ref BeaconCacheEntry or @c nullptr if nothing exists for given @c beaconID.
@@ -159,13 +201,10 @@ namespace caching
 		/// Observers to be notified about data being added
 		std::vector<IObserver*> observers;
 
-		/// Locks the cache for read and write access
-		core::util::ReadWriteLock mGlobalCacheLock;
-
-		/// The central part of the cache are the beacons (key=beaconID, value=
-		std::unordered_map<int32_t, std::shared_ptr<BeaconCacheEntry>> mBeacons;
+		/// The central part of the cache are the beacons, distributed over the shards by their beacon id
+		std::array<Shard, NUMBER_OF_SHARDS> mShards;
 
-		/// Sum of all record's data size estimation.
+		/// Sum of all record's data size estimation, only used as statistic, therefore updated with relaxed ordering.
 		std::atomic<int64_t> mCacheSizeInBytes;
 	};
 }
@@ -0,0 +1,128 @@
+/**
+* Copyright 2018 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "BeaconCacheArena.h"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace caching;
+
+constexpr size_t BeaconCacheArena::MIN_SEGMENT_CAPACITY;
+constexpr size_t BeaconCacheArena::MAX_SEGMENT_CAPACITY;
+
+namespace
+{
+	///
+	/// Length prefix stored in front of each record's data
+	///
+	struct RecordHeader
+	{
+		/// number of data bytes following the header
+		uint32_t byteLength;
+
+		/// number of UTF8 characters in the data
+		uint32_t stringLength;
+	};
+}
+
+BeaconCacheArena::Segment::Segment(size_t segmentCapacity)
+	: data(new char[segmentCapacity])
+	, capacity(segmentCapacity)
+	, used(0)
+	, liveRecords(0)
+{
+}
+
+BeaconCacheArena::BeaconCacheArena()
+	: mSegments()
+	, mFirstSegmentID(0)
+	, mNextSegmentCapacity(MIN_SEGMENT_CAPACITY)
+{
+}
+
+BeaconCacheArena::RecordLocation BeaconCacheArena::append(const core::UTF8String& data)
+{
+	const auto& bytes = data.getStringData();
+	auto requiredBytes = sizeof(RecordHeader) + bytes.size();
+
+	if (mSegments.empty() || mSegments.back()->capacity - mSegments.back()->used < requiredBytes)
+	{
+		mSegments.emplace_back(new Segment(std::max(mNextSegmentCapacity, requiredBytes)));
+		mNextSegmentCapacity = std::min(mNextSegmentCapacity * 2, MAX_SEGMENT_CAPACITY);
+	}
+
+	auto& segment = *mSegments.back();
+	RecordLocation location = { mFirstSegmentID + mSegments.size() - 1, static_cast<uint32_t>(segment.used) };
+
+	RecordHeader header = { static_cast<uint32_t>(bytes.size()), static_cast<uint32_t>(data.getStringLength()) };
+	memcpy(segment.data.get() + segment.used, &header, sizeof(header));
+	if (!bytes.empty())
+	{
+		memcpy(segment.data.get() + segment.used + sizeof(header), bytes.data(), bytes.size());
+	}
+
+	segment.used += requiredBytes;
+	segment.liveRecords++;
+
+	return location;
+}
+
+core::UTF8StringView BeaconCacheArena::getData(const RecordLocation& location) const
+{
+	const auto& segment = getSegment(location.segmentID);
+
+	RecordHeader header;
+	memcpy(&header, segment.data.get() + location.offset, sizeof(header));
+
+	return core::UTF8StringView::fromValidatedData(segment.data.get() + location.offset + sizeof(header), header.byteLength, header.stringLength);
+}
+
+void BeaconCacheArena::release(const RecordLocation& location)
+{
+	auto& segment = getSegment(location.segmentID);
+	segment.liveRecords--;
+	if (segment.liveRecords > 0)
+	{
+		return;
+	}
+
+	auto index = static_cast<size_t>(location.segmentID - mFirstSegmentID);
+	if (index == mSegments.size() - 1)
+	{
+		// the segment currently being appended to is rewound and reused
+		segment.used = 0;
+		return;
+	}
+
+	mSegments[index].reset();
+	while (!mSegments.empty() && mSegments.front() == nullptr)
+	{
+		mSegments.pop_front();
+		mFirstSegmentID++;
+	}
+}
+
+size_t BeaconCacheArena::getNumberOfSegments() const
+{
+	return static_cast<size_t>(std::count_if(mSegments.begin(), mSegments.end(),
+		[](const std::unique_ptr<Segment>& segment) { return segment != nullptr; }));
+}
+
+BeaconCacheArena::Segment& BeaconCacheArena::getSegment(uint64_t segmentID) const
+{
+	return *mSegments[static_cast<size_t>(segmentID - mFirstSegmentID)];
+}
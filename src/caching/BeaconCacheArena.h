@@ -0,0 +1,141 @@
+/**
+* Copyright 2018 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef _CACHING_BEACONCACHEARENA_H
+#define _CACHING_BEACONCACHEARENA_H
+
+#include "core/UTF8String.h"
+#include "core/UTF8StringView.h"
+
+#include <cstdint>
+#include <cstddef>
+#include <deque>
+#include <memory>
+
+namespace caching
+{
+	///
+	/// Append-only storage for the serialized data of one @ref BeaconCacheEntry.
+	///
+	/// Records are copied into contiguous segments as length-prefixed blobs, so that adding a record is
+	/// a bump-pointer copy and records added one after another are adjacent in memory.
+	/// Segments start small and grow geometrically, so that short lived sessions don't waste memory.
+	/// A segment is freed as soon as all records stored in it have been released.
+	///
+	/// This class is not thread safe, the owning @ref BeaconCacheEntry synchronizes access.
+	///
+	class BeaconCacheArena
+	{
+	public:
+		///
+		/// Location of a record within the arena
+		///
+		struct RecordLocation
+		{
+			/// ID of the segment containing the record
+			uint64_t segmentID;
+
+			/// offset of the record's length prefix within the segment
+			uint32_t offset;
+		};
+
+		/// capacity of the first segment in bytes
+		static constexpr size_t MIN_SEGMENT_CAPACITY = 512;
+
+		/// maximum capacity of a segment in bytes, unless a single record requires more
+		static constexpr size_t MAX_SEGMENT_CAPACITY = 16 * 1024;
+
+		///
+		/// Default constructor
+		///
+		BeaconCacheArena();
+
+		///
+		/// Copy the given data into the arena.
+		/// @param[in] data the data to store
+		/// @return the location of the stored record
+		///
+		RecordLocation append(const core::UTF8String& data);
+
+		///
+		/// Get the data of a previously appended record.
+		///
+		/// The returned view is valid until the record is released.
+		/// @param[in] location the record's location as returned by @ref append
+		/// @return view on the record's data
+		///
+		core::UTF8StringView getData(const RecordLocation& location) const;
+
+		///
+		/// Release a previously appended record.
+		///
+		/// Each record must be released at most once. The record's storage is reclaimed,
+		/// when all records of the same segment have been released.
+		/// @param[in] location the record's location as returned by @ref append
+		///
+		void release(const RecordLocation& location);
+
+		///
+		/// Get the number of segments currently allocated.
+		///
+		/// This method shall only be used for testing purposes.
+		///
+		size_t getNumberOfSegments() const;
+
+	private:
+		///
+		/// A contiguous block of memory holding length-prefixed records
+		///
+		struct Segment
+		{
+			///
+			/// Allocate a new segment
+			/// @param[in] segmentCapacity the number of bytes to allocate
+			///
+			Segment(size_t segmentCapacity);
+
+			/// the segment's storage
+			std::unique_ptr<char[]> data;
+
+			/// number of bytes allocated for @c data
+			size_t capacity;
+
+			/// number of bytes already used in @c data
+			size_t used;
+
+			/// number of records stored in this segment, which have not been released yet
+			size_t liveRecords;
+		};
+
+		///
+		/// Get the segment with the given ID
+		/// @param[in] segmentID the segment's ID
+		/// @return the segment
+		///
+		Segment& getSegment(uint64_t segmentID) const;
+
+		/// the segments, where index 0 corresponds to @c mFirstSegmentID; released segments are @c nullptr
+		std::deque<std::unique_ptr<Segment>> mSegments;
+
+		/// ID of the first segment in @c mSegments
+		uint64_t mFirstSegmentID;
+
+		/// capacity of the next segment to allocate
+		size_t mNextSegmentCapacity;
+	};
+}
+
+#endif
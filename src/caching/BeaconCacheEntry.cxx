@@ -16,11 +16,21 @@
 
 #include "BeaconCacheEntry.h"
 
+#include <algorithm>
+#include <limits>
+
 using namespace caching;
 
+/// value of the oldest timestamp, if there is no active data
+static constexpr int64_t NO_ACTIVE_DATA_TIMESTAMP = std::numeric_limits<int64_t>::max();
+
 BeaconCacheEntry::BeaconCacheEntry()
-	: mEventData()
+	: mArena()
+	, mEventData()
 	, mActionData()
+	, mEventDataOrdered(true)
+	, mActionDataOrdered(true)
+	, mOldestTimestamp(NO_ACTIVE_DATA_TIMESTAMP)
 	, mMutex()
 	, mEventDataBeingSent()
 	, mActionDataBeingSent()
@@ -36,14 +46,35 @@ std::mutex& BeaconCacheEntry::getLock()
 
 void BeaconCacheEntry::addEventData(const BeaconCacheRecord& record)
 {
-	mEventData.push_back(record);
-	mTotalNumBytes += record.getDataSizeInBytes();
+	addData(mEventData, mEventDataOrdered, record.getTimestamp(), record.getData());
+}
+
+void BeaconCacheEntry::addEventData(int64_t timestamp, const core::UTF8String& data)
+{
+	addData(mEventData, mEventDataOrdered, timestamp, data);
 }
 
 void BeaconCacheEntry::addActionData(const BeaconCacheRecord& record)
 {
-	mActionData.push_back(record);
-	mTotalNumBytes += record.getDataSizeInBytes();
+	addData(mActionData, mActionDataOrdered, record.getTimestamp(), record.getData());
+}
+
+void BeaconCacheEntry::addActionData(int64_t timestamp, const core::UTF8String& data)
+{
+	addData(mActionData, mActionDataOrdered, timestamp, data);
+}
+
+void BeaconCacheEntry::addData(RecordIndex& records, bool& isOrdered, int64_t timestamp, const core::UTF8String& data)
+{
+	if (!records.empty() && timestamp < records.back().timestamp)
+	{
+		isOrdered = false;
+	}
+	mOldestTimestamp = std::min(mOldestTimestamp, timestamp);
+
+	auto dataSizeInBytes = static_cast<int64_t>(data.getStringData().size());
+	records.push_back({ timestamp, mArena.append(data), dataSizeInBytes, false });
+	mTotalNumBytes += dataSizeInBytes;
 }
 
 bool BeaconCacheEntry::needsDataCopyBeforeChunking() const
@@ -54,20 +85,26 @@ bool BeaconCacheEntry::needsDataCopyBeforeChunking() const
 
 void BeaconCacheEntry::copyDataForChunking()
 {
-	mActionDataBeingSent.splice(mActionDataBeingSent.begin(), mActionData);
-	mEventDataBeingSent.splice(mEventDataBeingSent.begin(), mEventData);
-
+	// the data stays in the arena, only the indices are handed over
+	mActionDataBeingSent.insert(mActionDataBeingSent.begin(), mActionData.begin(), mActionData.end());
+	mActionData.clear();
+	mEventDataBeingSent.insert(mEventDataBeingSent.begin(), mEventData.begin(), mEventData.end());
+	mEventData.clear();
+
+	mEventDataOrdered = true;
+	mActionDataOrdered = true;
+	mOldestTimestamp = NO_ACTIVE_DATA_TIMESTAMP;
 	mTotalNumBytes = 0;
 }
 
-const core::UTF8String BeaconCacheEntry::getChunk(const core::UTF8String& chunkPrefix, size_t maxSize, const core::UTF8String& delimiter)
+std::shared_ptr<BeaconChunk> BeaconCacheEntry::getChunk(const core::UTF8String& chunkPrefix, size_t maxSize, const core::UTF8String& delimiter)
 {
 	if (!hasDataToSend())
 	{
 		// nothing to send - reset lists, so next time lists get copied again
 		mEventDataBeingSent.clear();
 		mActionDataBeingSent.clear();
-		return core::UTF8String();
+		return nullptr;
 	}
 	return getNextChunk(chunkPrefix, maxSize, delimiter);
 }
@@ -77,34 +114,36 @@ bool BeaconCacheEntry::hasDataToSend() const
 	return !mEventDataBeingSent.empty() || !mActionDataBeingSent.empty();
 }
 
-const core::UTF8String BeaconCacheEntry::getNextChunk(const core::UTF8String& chunkPrefix, size_t maxSize, const core::UTF8String& delimiter)
+std::shared_ptr<BeaconChunk> BeaconCacheEntry::getNextChunk(const core::UTF8String& chunkPrefix, size_t maxSize, const core::UTF8String& delimiter)
 {
-	core::UTF8String chunk;
-
-	// append the chunk prefix
-	chunk.concatenate(chunkPrefix);
+	// the chunk starts with the prefix
+	auto chunk = std::make_shared<BeaconChunk>(chunkPrefix, delimiter);
 
 	// append data from both lists
 	// note the order is currently important -> event data goes first, then action data
-	chunkifyDataList(chunk, mEventDataBeingSent, maxSize, delimiter);
-	chunkifyDataList(chunk, mActionDataBeingSent, maxSize, delimiter);
+	chunkifyDataList(*chunk, mEventDataBeingSent, maxSize);
+	chunkifyDataList(*chunk, mActionDataBeingSent, maxSize);
 
 	return chunk;
 }
 
-void BeaconCacheEntry::chunkifyDataList(core::UTF8String& chunk, std::list<BeaconCacheRecord>& dataBeingSent, size_t maxSize, const core::UTF8String& delimiter)
+void BeaconCacheEntry::chunkifyDataList(BeaconChunk& chunk, RecordIndex& dataBeingSent, size_t maxSize)
 {
-	auto it = dataBeingSent.begin();
-	while (it != dataBeingSent.end() && chunk.getStringLength() <= maxSize)
+	const auto delimiterByteLength = chunk.getDelimiter().getStringData().size();
+	for (auto& record : dataBeingSent)
 	{
-		// mark the record for sending
-		it->markForSending();
+		auto data = mArena.getData(record.location);
+		if (chunk.getNumberOfRecords() > 0 && chunk.getByteLength() + delimiterByteLength + data.getByteLength() > maxSize)
+		{
+			// the record does not fit, stop here to keep the records in order
+			break;
+		}
 
-		// append delimiter & data
-		chunk.concatenate(delimiter);
-		chunk.concatenate(it->getData());
+		// mark the record for sending
+		record.markedForSending = true;
 
-		it++;
+		// reference the data in place, marked records are neither evicted nor released until they are removed or reset
+		chunk.appendRecord(data);
 	}
 }
 
@@ -116,35 +155,9 @@ void BeaconCacheEntry::removeDataMarkedForSending()
 		return;
 	}
 
-	auto it = mEventDataBeingSent.begin();
-	while (it != mEventDataBeingSent.end())
-	{
-		if (it->isMarkedForSending())
-		{
-			it = mEventDataBeingSent.erase(it);
-		}
-		else
-		{
-			++it;
-		}
-	}
-
-	if (it == mEventDataBeingSent.end())
-	{
-		// only check action data, if all event data has been traversed, otherwise it's just waste of cpu time
-		it = mActionDataBeingSent.begin();
-		while (it != mActionDataBeingSent.end())
-		{
-			if (it->isMarkedForSending())
-			{
-				it = mActionDataBeingSent.erase(it);
-			}
-			else
-			{
-				++it;
-			}
-		}
-	}
+	auto isMarkedForSending = [](const IndexedRecord& record) { return record.markedForSending; };
+	removeRecords(mEventDataBeingSent, isMarkedForSending);
+	removeRecords(mActionDataBeingSent, isMarkedForSending);
 }
 
 void BeaconCacheEntry::resetDataMarkedForSending()
@@ -157,22 +170,28 @@ void BeaconCacheEntry::resetDataMarkedForSending()
 
 	// reset the "sending marks" and in the same traversal count the bytes which are added back
 	int64_t numBytes = 0;
-	for (auto it = mEventDataBeingSent.begin(); it != mEventDataBeingSent.end(); ++it)
+	for (auto& record : mEventDataBeingSent)
 	{
-		it->unsetSending();
-		numBytes += it->getDataSizeInBytes();
+		record.markedForSending = false;
+		numBytes += record.dataSizeInBytes;
+		mOldestTimestamp = std::min(mOldestTimestamp, record.timestamp);
 	}
 
-	for (auto it = mActionDataBeingSent.begin(); it != mActionDataBeingSent.end(); ++it)
+	for (auto& record : mActionDataBeingSent)
 	{
-		it->unsetSending();
-		numBytes += it->getDataSizeInBytes();
+		record.markedForSending = false;
+		numBytes += record.dataSizeInBytes;
+		mOldestTimestamp = std::min(mOldestTimestamp, record.timestamp);
 	}
 
 	// merge data
-	mEventData.splice(mEventData.begin(), mEventDataBeingSent);
-	mActionData.splice(mActionData.begin(), mActionDataBeingSent);
+	mEventData.insert(mEventData.begin(), mEventDataBeingSent.begin(), mEventDataBeingSent.end());
+	mEventDataBeingSent.clear();
+	mActionData.insert(mActionData.begin(), mActionDataBeingSent.begin(), mActionDataBeingSent.end());
+	mActionDataBeingSent.clear();
 
+	mEventDataOrdered = isOrderedByTimestamp(mEventData);
+	mActionDataOrdered = isOrderedByTimestamp(mActionData);
 	mTotalNumBytes += numBytes;
 }
 
@@ -183,91 +202,192 @@ int64_t BeaconCacheEntry::getTotalNumberOfBytes() const
 
 int32_t BeaconCacheEntry::removeRecordsOlderThan(int64_t minTimestamp)
 {
-	int32_t numRecordsRemoved = removeRecordsOlderThan(mEventData, minTimestamp);
-	numRecordsRemoved += removeRecordsOlderThan(mActionData, minTimestamp);
+	if (mOldestTimestamp >= minTimestamp)
+	{
+		// nothing expired
+		return 0;
+	}
+
+	int64_t numBytesRemoved = 0;
+	int64_t oldestTimestamp = NO_ACTIVE_DATA_TIMESTAMP;
+	int32_t numRecordsRemoved = removeExpiredRecords(mEventData, mEventDataOrdered, minTimestamp, numBytesRemoved, oldestTimestamp);
+	numRecordsRemoved += removeExpiredRecords(mActionData, mActionDataOrdered, minTimestamp, numBytesRemoved, oldestTimestamp);
+
+	mOldestTimestamp = oldestTimestamp;
+	mTotalNumBytes -= numBytesRemoved;
 
 	return numRecordsRemoved;
 }
 
-int32_t BeaconCacheEntry::removeRecordsOlderThan(std::list<BeaconCacheRecord>& records, int64_t minTimestamp)
+int32_t BeaconCacheEntry::removeExpiredRecords(RecordIndex& records, bool& isOrdered, int64_t minTimestamp, int64_t& numBytesRemoved, int64_t& oldestTimestamp)
 {
+	// expired records at the front can be dropped without looking at the remaining ones
 	int32_t numRecordsRemoved = 0;
-	auto it = records.begin();
-	while (it != records.end())
+	while (!records.empty() && records.front().timestamp < minTimestamp)
+	{
+		numBytesRemoved += removeFirstRecord(records);
+		numRecordsRemoved++;
+	}
+
+	if (isOrdered)
 	{
-		auto record = *it;
-		if (record.getTimestamp() < minTimestamp)
+		if (!records.empty())
 		{
-			it = records.erase(it);
-			numRecordsRemoved++;
+			oldestTimestamp = std::min(oldestTimestamp, records.front().timestamp);
+		}
+		return numRecordsRemoved;
+	}
+
+	// records were added out of order, expired ones might follow records which are not expired
+	int64_t previousTimestamp = std::numeric_limits<int64_t>::min();
+	isOrdered = true;
+	numRecordsRemoved += removeRecords(records, [&](const IndexedRecord& record)
+	{
+		if (record.timestamp < minTimestamp)
+		{
+			numBytesRemoved += record.dataSizeInBytes;
+			return true;
+		}
+
+		isOrdered = isOrdered && previousTimestamp <= record.timestamp;
+		previousTimestamp = record.timestamp;
+		oldestTimestamp = std::min(oldestTimestamp, record.timestamp);
+		return false;
+	});
+
+	return numRecordsRemoved;
+}
+
+bool BeaconCacheEntry::isOrderedByTimestamp(const RecordIndex& records)
+{
+	return std::is_sorted(records.begin(), records.end(),
+		[](const IndexedRecord& lhs, const IndexedRecord& rhs) { return lhs.timestamp < rhs.timestamp; });
+}
+
+template <typename Predicate>
+int32_t BeaconCacheEntry::removeRecords(RecordIndex& records, Predicate predicate)
+{
+	// single sequential pass, compacting the remaining records towards the front
+	auto kept = records.begin();
+	for (auto it = records.begin(); it != records.end(); ++it)
+	{
+		if (predicate(*it))
+		{
+			mArena.release(it->location);
 		}
 		else
 		{
-			++it;
+			*kept++ = *it;
 		}
 	}
 
+	auto numRecordsRemoved = static_cast<int32_t>(records.end() - kept);
+	records.erase(kept, records.end());
+
 	return numRecordsRemoved;
 }
 
+int64_t BeaconCacheEntry::removeFirstRecord(RecordIndex& records)
+{
+	auto numBytes = records.front().dataSizeInBytes;
+	mArena.release(records.front().location);
+	records.pop_front();
+
+	return numBytes;
+}
+
 int32_t BeaconCacheEntry::removeOldestRecords(int32_t numRecords)
 {
 	int32_t numRecordsRemoved = 0;
+	int64_t numBytesRemoved = 0;
 
-	auto eventsIterator = mEventData.begin();
-	auto actionsIterator = mActionData.begin();
-
-	while (numRecordsRemoved < numRecords && (eventsIterator != mEventData.end() || actionsIterator != mActionData.end()))
+	while (numRecordsRemoved < numRecords && (!mEventData.empty() || !mActionData.empty()))
 	{
-		if (eventsIterator == mEventData.end())
+		if (mEventData.empty())
 		{
 			// actions is not empty -> remove action
-			actionsIterator = mActionData.erase(actionsIterator);
+			numBytesRemoved += removeFirstRecord(mActionData);
 		}
-		else if (actionsIterator == mActionData.end())
+		else if (mActionData.empty())
 		{
 			// events is not empty -> remove event
-			eventsIterator = mEventData.erase(eventsIterator);
+			numBytesRemoved += removeFirstRecord(mEventData);
 		}
 		else
 		{
 			// both are not empty -> compare by timestamp and take the older one
-			if ((*actionsIterator).getTimestamp() < (*eventsIterator).getTimestamp())
+			if (mActionData.front().timestamp < mEventData.front().timestamp)
 			{
 				// first action is older than first event
-				actionsIterator = mActionData.erase(actionsIterator);
+				numBytesRemoved += removeFirstRecord(mActionData);
 			}
 			else
 			{
 				// first event is older than first action
-				eventsIterator = mEventData.erase(eventsIterator);
+				numBytesRemoved += removeFirstRecord(mEventData);
 			}
 		}
 
 		numRecordsRemoved++;
 	}
 
+	mTotalNumBytes -= numBytesRemoved;
+
 	return numRecordsRemoved;
 }
 
-const std::list<BeaconCacheRecord> BeaconCacheEntry::getEventData() const
+void BeaconCacheEntry::getOldestRecords(BeaconCacheRecordCursor& cursor, uint32_t maxNumRecords, std::vector<BeaconCacheRecordSummary>& records) const
+{
+	// same traversal as removeOldestRecords, without modifying the data
+	uint32_t numRecordsCollected = 0;
+	while (numRecordsCollected < maxNumRecords && (cursor.eventIndex < mEventData.size() || cursor.actionIndex < mActionData.size()))
+	{
+		const IndexedRecord* record = nullptr;
+		if (cursor.eventIndex >= mEventData.size()
+			|| (cursor.actionIndex < mActionData.size() && mActionData[cursor.actionIndex].timestamp < mEventData[cursor.eventIndex].timestamp))
+		{
+			record = &mActionData[cursor.actionIndex++];
+		}
+		else
+		{
+			record = &mEventData[cursor.eventIndex++];
+		}
+
+		records.push_back({ record->timestamp, record->dataSizeInBytes });
+		numRecordsCollected++;
+	}
+}
+
+const std::list<BeaconCacheRecord> BeaconCacheEntry::toRecordList(const RecordIndex& records) const
 {
-	std::list<BeaconCacheRecord> result = mEventData;
+	std::list<BeaconCacheRecord> result;
+	for (const auto& record : records)
+	{
+		result.emplace_back(record.timestamp, mArena.getData(record.location).toUTF8String());
+		if (record.markedForSending)
+		{
+			result.back().markForSending();
+		}
+	}
 	return result;
 }
 
+const std::list<BeaconCacheRecord> BeaconCacheEntry::getEventData() const
+{
+	return toRecordList(mEventData);
+}
+
 const std::list<BeaconCacheRecord> BeaconCacheEntry::getActionData() const
 {
-	std::list<BeaconCacheRecord> result = mActionData;
-	return result;
+	return toRecordList(mActionData);
 }
 
 const std::list<BeaconCacheRecord> BeaconCacheEntry::getEventDataBeingSent() const
 {
-	return mEventDataBeingSent;
+	return toRecordList(mEventDataBeingSent);
 }
 
 const std::list<BeaconCacheRecord> BeaconCacheEntry::getActionDataBeingSent() const
 {
-	return mActionDataBeingSent;
+	return toRecordList(mActionDataBeingSent);
 }
@@ -18,9 +18,13 @@
 #define _CACHING_BEACONCACHEENTRY_H
 
 #include "core/UTF8String.h"
+#include "caching/BeaconCacheArena.h"
+#include "caching/BeaconChunk.h"
 #include "caching/BeaconCacheRecord.h"
+#include "caching/IBeaconCache.h"
 
 #include <cstdint>
+#include <deque>
 #include <vector>
 #include <memory>
 #include <list>
@@ -31,6 +35,13 @@ namespace caching
 	///
 	/// Represents an entry in the @ref BeaconCache.
 	///
+	/// The serialized data of all records is stored in a @ref BeaconCacheArena, event and action data
+	/// only keep a small index of timestamps and arena locations.
+	///
+	/// Records are usually added in timestamp order, therefore expired records are found at the front of the index.
+	/// The entry tracks whether this holds and a lower bound of all timestamps, so that age based eviction
+	/// costs O(1) if nothing expired and O(number of evicted records) otherwise.
+	///
 	/// The caller is responsible to lock this element via the mutex returned with @ref getLock()
 	/// before the first method is invoked, and to unlock it after the last operation is invoked.
 	///
@@ -55,6 +66,14 @@ namespace caching
 		///
 		void addEventData(const BeaconCacheRecord& record);
 
+		///
+		/// Add new event data to cache.
+		///
+		/// @param[in] timestamp The data's timestamp.
+		/// @param[in] data The serialized event data.
+		///
+		void addEventData(int64_t timestamp, const core::UTF8String& data);
+
 		///
 		/// Add new action data record to the cache.
 		///
@@ -62,6 +81,14 @@ namespace caching
 		///
 		void addActionData(const BeaconCacheRecord& record);
 
+		///
+		/// Add new action data to the cache.
+		///
+		/// @param[in] timestamp The data's timestamp.
+		/// @param[in] data The serialized action data.
+		///
+		void addActionData(int64_t timestamp, const core::UTF8String& data);
+
 		///
 		/// Test if data shall be copied, before creating chunks for sending.
 		///
@@ -79,15 +106,18 @@ namespace caching
 		///
 		/// This method is called from beacon sending thread.
 		///
+		/// The returned chunk references the records' data in place, it is valid until the records
+		/// are removed via @ref removeDataMarkedForSending or reset via @ref resetDataMarkedForSending.
+		///
 		/// @param[in] chunkPrefix The prefix to add to each chunk.
-		/// @param[in] maxSize     The maximum size in characters for one chunk.
+		/// @param[in] maxSize     The maximum size in bytes for one chunk, which is only exceeded by a chunk containing a single record.
 		/// @param[in] delimiter   The delimiter between data chunks.
-		/// @return The string to send or an empty string if there is no more data to send.
+		/// @return The chunk to send or @c nullptr if there is no more data to send.
 		///
-		const core::UTF8String getChunk(const core::UTF8String& chunkPrefix, size_t maxSize, const core::UTF8String& delimiter);
+		std::shared_ptr<BeaconChunk> getChunk(const core::UTF8String& chunkPrefix, size_t maxSize, const core::UTF8String& delimiter);
 
 		///
-		/// Remove data that was previously marked for sending when @ref getNextChunk was called.
+		/// Remove data that was previously marked for sending when @ref getChunk was called.
 		///
 		void removeDataMarkedForSending();
 
@@ -129,6 +159,18 @@ namespace caching
 		///
 		int32_t removeOldestRecords(int32_t numRecords);
 
+		///
+		/// Get timestamp and size of the oldest records from event & action data.
+		///
+		/// The records are appended to @c records in the same order in which @ref removeOldestRecords removes them,
+		/// starting at @c cursor, which is advanced past the appended records.
+		///
+		/// @param[in,out] cursor The position of the first record to append.
+		/// @param[in] maxNumRecords The maximum number of records to append.
+		/// @param[out] records The vector to which the record summaries are appended.
+		///
+		void getOldestRecords(BeaconCacheRecordCursor& cursor, uint32_t maxNumRecords, std::vector<BeaconCacheRecordSummary>& records) const;
+
 		///
 		/// Get a deep copy of event data.
 		///
@@ -158,6 +200,27 @@ namespace caching
 		const std::list<BeaconCacheRecord> getActionDataBeingSent() const;
 
 	private:
+		///
+		/// Index entry of a record stored in the @ref BeaconCacheArena
+		///
+		struct IndexedRecord
+		{
+			/// The record's timestamp
+			int64_t timestamp;
+
+			/// Location of the record's data in the arena
+			BeaconCacheArena::RecordLocation location;
+
+			/// Size of the record's data in bytes
+			int64_t dataSizeInBytes;
+
+			/// Indicates if this record is marked for sending
+			bool markedForSending;
+		};
+
+		/// Sequence of records, ordered by insertion
+		typedef std::deque<IndexedRecord> RecordIndex;
+
 		///
 		/// Test if there is more data to send (to chunk).
 		///
@@ -165,48 +228,109 @@ namespace caching
 		///
 		bool hasDataToSend() const;
 
+		///
+		/// Store @c data in the arena and append it to @c records.
+		/// @param[in,out] records the index to which the record is appended
+		/// @param[in,out] isOrdered flag indicating if @c records is ordered by timestamp, cleared if the new record breaks the order
+		/// @param[in] timestamp The data's timestamp.
+		/// @param[in] data The data to store.
+		///
+		void addData(RecordIndex& records, bool& isOrdered, int64_t timestamp, const core::UTF8String& data);
+
+		///
+		/// Remove all records from @c records which are older than @c minTimestamp.
+		///
+		/// If @c records is ordered by timestamp, only the expired records at the front are visited.
+		/// @param[in,out] records the records to remove expired ones from
+		/// @param[in,out] isOrdered flag indicating if @c records is ordered by timestamp, updated if all records were visited
+		/// @param[in] minTimestamp The minimum timestamp allowed.
+		/// @param[in,out] numBytesRemoved incremented by the data size of all removed records
+		/// @param[in,out] oldestTimestamp lowered to the oldest timestamp of the remaining records
+		/// @return The number of records removed from @c records.
+		///
+		int32_t removeExpiredRecords(RecordIndex& records, bool& isOrdered, int64_t minTimestamp, int64_t& numBytesRemoved, int64_t& oldestTimestamp);
+
+		///
+		/// Check if the given records are ordered by timestamp.
+		/// @param[in] records the records to check
+		/// @return @c true if no record has a smaller timestamp than its predecessor, @c false otherwise
+		///
+		static bool isOrderedByTimestamp(const RecordIndex& records);
+
 		///
 		/// Get the next chunk.
 		/// @param[in] chunkPrefix The prefix to add to each chunk.
-		/// @param[in] maxSize     The maximum size in characters for one chunk.
+		/// @param[in] maxSize     The maximum size in bytes for one chunk, which is only exceeded by a chunk containing a single record.
 		/// @param[in] delimiter   The delimiter between data chunks.
-		/// @return The string to send or an empty string if there is no more data to send.
+		/// @return The chunk to send.
 		///
-		const core::UTF8String getNextChunk(const core::UTF8String& chunkPrefix, size_t maxSize, const core::UTF8String& delimiter);
+		std::shared_ptr<BeaconChunk> getNextChunk(const core::UTF8String& chunkPrefix, size_t maxSize, const core::UTF8String& delimiter);
 
 		///
-		/// Iterates (up to the @c maxSize) the provided @c dataBeingSent list and appends the data together with the @c delimiter to the provided @c chunk.
-		/// param[in,out] chunk the chunk to which the data is appended
-		/// param[in] dataBeingSent the list of record containing the data to append
-		/// param[in] maxSize in characters for one chunk. Up to this size data (if available) is appended
-		/// param[in] delimiter the delimiter between data chunks 
+		/// Sequentially scans the provided @c dataBeingSent records and appends their data to the provided @c chunk,
+		/// as long as the chunk's encoded size does not exceed @c maxSize.
+		///
+		/// The first record of a chunk is always appended, so that a record larger than @c maxSize is sent on its own
+		/// instead of blocking all subsequent data.
+		/// param[in,out] chunk the chunk to which the records are appended
+		/// param[in] dataBeingSent the records containing the data to append
+		/// param[in] maxSize in bytes for one chunk
 		///
-		static void chunkifyDataList(core::UTF8String& chunk, std::list<BeaconCacheRecord>& dataBeingSent, size_t maxSize, const core::UTF8String& delimiter);
+		void chunkifyDataList(BeaconChunk& chunk, RecordIndex& dataBeingSent, size_t maxSize);
 
 		///
-		/// Remove all @ref BeaconCacheRecord from @c records.
-		/// @param[in,out] records list of cache records
-		/// @param[in] minTimestamp The minimum timestamp allowed.
+		/// Remove all records from @c records for which @c predicate returns @c true.
+		///
+		/// The remaining records keep their order, the data of removed records is released in the arena.
+		/// @param[in,out] records the records to filter
+		/// @param[in] predicate the predicate deciding which records to remove
 		/// @return The number of records removed from @c records.
 		///
-		static int32_t removeRecordsOlderThan(std::list<BeaconCacheRecord>& records, int64_t minTimestamp);
+		template <typename Predicate>
+		int32_t removeRecords(RecordIndex& records, Predicate predicate);
+
+		///
+		/// Remove the first record of @c records and release its data.
+		/// @param[in,out] records the records from which the first one is removed
+		/// @return The size of the removed record's data in bytes.
+		///
+		int64_t removeFirstRecord(RecordIndex& records);
+
+		///
+		/// Materialize the given records for testing purposes.
+		/// @param[in] records the records to copy
+		/// @return deep copy of the records
+		///
+		const std::list<BeaconCacheRecord> toRecordList(const RecordIndex& records) const;
 
 	private:
 
-		///	List storing all active event data.
-		std::list<BeaconCacheRecord> mEventData;
+		/// Storage of all record data of this entry.
+		BeaconCacheArena mArena;
+
+		///	Index of all active event data.
+		RecordIndex mEventData;
+
+		///	Index of all active action data.
+		RecordIndex mActionData;
+
+		/// Indicates if @c mEventData is ordered by timestamp
+		bool mEventDataOrdered;
+
+		/// Indicates if @c mActionData is ordered by timestamp
+		bool mActionDataOrdered;
 
-		///	List storing all active action data.
-		std::list<BeaconCacheRecord> mActionData;
+		/// Lower bound of the timestamps of all active event and action data.
+		int64_t mOldestTimestamp;
 
 		/// Lock object for locking access to session & event data.
 		std::mutex mMutex;
 
-		///	List storing all event data being sent.
-		std::list<BeaconCacheRecord> mEventDataBeingSent;
+		///	Index of all event data being sent.
+		RecordIndex mEventDataBeingSent;
 
-		///	List storing all action data being sent.
-		std::list<BeaconCacheRecord> mActionDataBeingSent;
+		///	Index of all action data being sent.
+		RecordIndex mActionDataBeingSent;
 
 		/// Sum of all record's data size estimation.
 		int64_t mTotalNumBytes;
@@ -28,12 +28,15 @@ BeaconCacheEvictor::BeaconCacheEvictor(std::shared_ptr<openkit::ILogger> logger,
 	: BeaconCacheEvictor(logger, beaconCache, {
 		std::make_shared<TimeEvictionStrategy>(logger, beaconCache, configuration, timingProvider, std::bind(&BeaconCacheEvictor::isAlive, this)),
 		std::make_shared<SpaceEvictionStrategy>(logger, beaconCache, configuration, std::bind(&BeaconCacheEvictor::isAlive, this))
-		})
+		},
+		configuration->getEvictionNotificationThreshold(),
+		std::chrono::milliseconds(configuration->getEvictionNotificationInterval()))
 {
 
 }
 
-BeaconCacheEvictor::BeaconCacheEvictor(std::shared_ptr<openkit::ILogger> logger, std::shared_ptr<IBeaconCache> beaconCache, std::vector<std::shared_ptr<IBeaconCacheEvictionStrategy>> strategies)
+BeaconCacheEvictor::BeaconCacheEvictor(std::shared_ptr<openkit::ILogger> logger, std::shared_ptr<IBeaconCache> beaconCache, std::vector<std::shared_ptr<IBeaconCacheEvictionStrategy>> strategies,
+	int64_t notificationThreshold, std::chrono::milliseconds notificationInterval)
 	: mLogger(logger)
 	, mBeaconCache(beaconCache)
 	, mStrategies(strategies)
@@ -41,6 +44,9 @@ BeaconCacheEvictor::BeaconCacheEvictor(std::shared_ptr<openkit::ILogger> logger,
 	, mRunning(false)
 	, mStop(false)
 	, mRecordAdded(false)
+	, mWakeupPending(false)
+	, mNotificationThreshold(notificationThreshold)
+	, mNotificationInterval(notificationInterval)
 	, mMutex()
 	, mConditionVariable()
 {
@@ -58,6 +64,9 @@ bool BeaconCacheEvictor::start()
 		return false;
 	}
 
+	// register before the thread starts, the cache's observers are not synchronized with other threads
+	mBeaconCache->addObserver(this);
+
 	std::unique_lock<std::mutex> lock(mMutex);
 	mEvictionThread = std::unique_ptr<std::thread>(new std::thread(&BeaconCacheEvictor::cacheEvictionLoopFunc, this));
 	while (!mRunning)
@@ -150,10 +159,23 @@ bool BeaconCacheEvictor::isAlive()
 
 void BeaconCacheEvictor::update()
 {
-	std::unique_lock<std::mutex> lock(mMutex);
+	// only write the shared flags if they are not set yet, to avoid cache line ping-pong between reporting threads
+	// the idle eviction thread waits for the first added record, so it must be notified about it
+	auto notify = !mRecordAdded.load(std::memory_order_relaxed) && !mRecordAdded.exchange(true);
+
+	// below the threshold the eviction thread picks up the new record when the notification interval elapsed
+	if (mBeaconCache->getNumBytesInCache() >= mNotificationThreshold
+		&& !mWakeupPending.load(std::memory_order_relaxed) && !mWakeupPending.exchange(true))
+	{
+		// wake up the eviction thread immediately, unless it's already about to wake up
+		notify = true;
+	}
 
-	mRecordAdded = true;
-	mConditionVariable.notify_all();
+	if (notify)
+	{
+		std::unique_lock<std::mutex> lock(mMutex);
+		mConditionVariable.notify_all();
+	}
 }
 
 void BeaconCacheEvictor::cacheEvictionLoopFunc()
@@ -166,17 +188,16 @@ void BeaconCacheEvictor::cacheEvictionLoopFunc()
 		mConditionVariable.notify_all();
 	}
 
-	// first register ourselves
-	mBeaconCache->addObserver(this);
-
 	while (true)
 	{
 		{
 			std::unique_lock<std::mutex> lock(mMutex);
-			while (!mRecordAdded && !mStop)
-			{
-				mConditionVariable.wait(lock);
-			}
+
+			// nothing to evict as long as no record was added, so there's no need to wake up periodically
+			mConditionVariable.wait(lock, [this]() { return mRecordAdded.load() || mStop; });
+
+			// coalesce further records until the notification interval elapsed or the notification threshold is reached
+			mConditionVariable.wait_for(lock, mNotificationInterval, [this]() { return mWakeupPending.load() || mStop; });
 
 			if (mStop)
 			{
@@ -184,10 +205,12 @@ void BeaconCacheEvictor::cacheEvictionLoopFunc()
 				break;
 			}
 
-			// reset the added flag
-			mRecordAdded = false;
+			mWakeupPending = false;
 		}
 
+		// reset the added flag, records added while the strategies run trigger the next run
+		mRecordAdded = false;
+
 		// a new record has been added to the cache
 		// run all eviction strategies, to perform cache cleanup
 		for (auto it = mStrategies.begin(); it != mStrategies.end(); ++it)
@@ -38,6 +38,11 @@ namespace caching
 	///
 	/// Class responsible for handling an eviction thread, to ensure @ref BeaconCache stays in configured boundaries.
 	///
+	/// Notifications about added records are coalesced: @ref update only marks the cache as dirty and wakes the eviction thread
+	/// if the cache size reached the notification threshold. Otherwise the eviction thread picks up the dirty cache after the
+	/// notification interval elapsed, which keeps locking and thread wake-ups off the thread reporting the data.
+	/// While the cache is not dirty, the eviction thread waits without a timeout and is only woken up by the first added record.
+	///
 	class BeaconCacheEvictor : IObserver
 	{
 	public:
@@ -56,8 +61,11 @@ namespace caching
 		/// @param[in] logger to write traces to
 		/// @param[in] beaconCache The Beacon cache to check if entries need to be evicted
 		/// @param[in] strategies  Strategies passed to the actual Runnable.
+		/// @param[in] notificationThreshold Cache size in bytes from which on @ref update wakes up the eviction thread immediately.
+		/// @param[in] notificationInterval Interval in which the eviction thread checks for added records below the threshold.
 		///
-		BeaconCacheEvictor(std::shared_ptr<openkit::ILogger> logger, std::shared_ptr<IBeaconCache> beaconCache, std::vector<std::shared_ptr<IBeaconCacheEvictionStrategy>> strategies);
+		BeaconCacheEvictor(std::shared_ptr<openkit::ILogger> logger, std::shared_ptr<IBeaconCache> beaconCache, std::vector<std::shared_ptr<IBeaconCacheEvictionStrategy>> strategies,
+			int64_t notificationThreshold = 0, std::chrono::milliseconds notificationInterval = configuration::BeaconCacheConfiguration::DEFAULT_EVICTION_NOTIFICATION_INTERVAL_IN_MILLIS);
 
 		///
 		/// Starts the eviction thread.
@@ -94,6 +102,9 @@ namespace caching
 		///
 		/// Update function to be notified about a new record being added.
 		///
+		/// This method is called for each added record, therefore it only takes the evictor's lock
+		/// if the eviction thread needs to be woken up.
+		///
 		void update();
 
 		///
@@ -121,7 +132,16 @@ namespace caching
 		bool mStop;
 
 		/// Flag, which indicates that a new record was added to the cache, thus we need to execute the eviction strategies
-		bool mRecordAdded;
+		std::atomic<bool> mRecordAdded;
+
+		/// Flag, which indicates that the eviction thread was requested to wake up, but did not do so yet
+		std::atomic<bool> mWakeupPending;
+
+		/// Cache size in bytes from which on the eviction thread is woken up immediately
+		const int64_t mNotificationThreshold;
+
+		/// Interval in which the eviction thread checks for added records below the notification threshold
+		const std::chrono::milliseconds mNotificationInterval;
 
 		/// Mutex for condition variable
 		std::mutex mMutex;
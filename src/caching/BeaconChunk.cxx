@@ -0,0 +1,85 @@
+/**
+* Copyright 2018 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "BeaconChunk.h"
+
+#include <string>
+
+using namespace caching;
+
+BeaconChunk::BeaconChunk(const core::UTF8String& prefix, const core::UTF8String& delimiter)
+	: mPrefix(prefix)
+	, mDelimiter(delimiter)
+	, mSegments()
+	, mByteLength(0)
+	, mStringLength(0)
+	, mDataOwner()
+{
+	mSegments.emplace_back(mPrefix);
+	mByteLength = mPrefix.getStringData().size();
+	mStringLength = mPrefix.getStringLength();
+}
+
+void BeaconChunk::appendRecord(const core::UTF8StringView& data)
+{
+	mSegments.emplace_back(mDelimiter);
+	mSegments.push_back(data);
+
+	mByteLength += mDelimiter.getStringData().size() + data.getByteLength();
+	mStringLength += mDelimiter.getStringLength() + data.getStringLength();
+}
+
+void BeaconChunk::setDataOwner(std::shared_ptr<const void> dataOwner)
+{
+	mDataOwner = dataOwner;
+}
+
+const core::UTF8String& BeaconChunk::getDelimiter() const
+{
+	return mDelimiter;
+}
+
+const std::vector<core::UTF8StringView>& BeaconChunk::getSegments() const
+{
+	return mSegments;
+}
+
+size_t BeaconChunk::getNumberOfRecords() const
+{
+	return (mSegments.size() - 1) / 2;
+}
+
+size_t BeaconChunk::getByteLength() const
+{
+	return mByteLength;
+}
+
+core::UTF8String::size_type BeaconChunk::getStringLength() const
+{
+	return mStringLength;
+}
+
+core::UTF8String BeaconChunk::toUTF8String() const
+{
+	std::string data;
+	data.reserve(mByteLength);
+	for (const auto& segment : mSegments)
+	{
+		data.append(segment.getData(), segment.getByteLength());
+	}
+
+	return core::UTF8String::fromValidatedData(data.data(), data.size(), mStringLength);
+}
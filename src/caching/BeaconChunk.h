@@ -0,0 +1,123 @@
+/**
+* Copyright 2018 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef _CACHING_BEACONCHUNK_H
+#define _CACHING_BEACONCHUNK_H
+
+#include "core/UTF8String.h"
+#include "core/UTF8StringView.h"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace caching
+{
+	///
+	/// A chunk of beacon data to send, represented as a sequence of segments.
+	///
+	/// The chunk consists of a prefix followed by records, each of them preceded by a delimiter.
+	/// Prefix and delimiter are owned by the chunk, the records' data is referenced in place
+	/// in the storage of the @ref BeaconCacheEntry, which is kept alive by the chunk.
+	/// The referenced data is valid until the records are removed from or reset into the beacon cache.
+	///
+	/// The segments refer to the chunk's own members, therefore a chunk can neither be copied nor moved.
+	///
+	class BeaconChunk
+	{
+	public:
+		///
+		/// Constructor
+		/// @param[in] prefix the prefix at the beginning of the chunk
+		/// @param[in] delimiter the delimiter preceding each record
+		///
+		BeaconChunk(const core::UTF8String& prefix, const core::UTF8String& delimiter);
+
+		BeaconChunk(const BeaconChunk&) = delete;
+		BeaconChunk& operator=(const BeaconChunk&) = delete;
+
+		///
+		/// Append a record's data preceded by the delimiter.
+		/// @param[in] data view on the record's data, which must stay valid as long as the chunk is used
+		///
+		void appendRecord(const core::UTF8StringView& data);
+
+		///
+		/// Keep the given object alive as long as this chunk exists.
+		/// @param[in] dataOwner the owner of the storage referenced by the records
+		///
+		void setDataOwner(std::shared_ptr<const void> dataOwner);
+
+		///
+		/// Get the delimiter preceding each record
+		/// @return the delimiter
+		///
+		const core::UTF8String& getDelimiter() const;
+
+		///
+		/// Get the segments making up the chunk in the order they must be sent.
+		/// @return the chunk's segments
+		///
+		const std::vector<core::UTF8StringView>& getSegments() const;
+
+		///
+		/// Get the number of records in this chunk
+		/// @return the number of records
+		///
+		size_t getNumberOfRecords() const;
+
+		///
+		/// Get the size of the chunk in bytes
+		/// @return the number of bytes of all segments
+		///
+		size_t getByteLength() const;
+
+		///
+		/// Get the size of the chunk in characters
+		/// @return the number of UTF8 characters of all segments
+		///
+		core::UTF8String::size_type getStringLength() const;
+
+		///
+		/// Copy all segments into a single string.
+		///
+		/// This method is intended for logging and testing, sending doesn't require the copy.
+		/// @return the concatenated segments
+		///
+		core::UTF8String toUTF8String() const;
+
+	private:
+		/// the prefix at the beginning of the chunk
+		const core::UTF8String mPrefix;
+
+		/// the delimiter preceding each record
+		const core::UTF8String mDelimiter;
+
+		/// views on prefix, delimiters and records
+		std::vector<core::UTF8StringView> mSegments;
+
+		/// total number of bytes of all segments
+		size_t mByteLength;
+
+		/// total number of characters of all segments
+		core::UTF8String::size_type mStringLength;
+
+		/// keeps the storage of the records alive
+		std::shared_ptr<const void> mDataOwner;
+	};
+}
+
+#endif
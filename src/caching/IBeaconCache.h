@@ -19,13 +19,41 @@
 
 #include "caching/IObserver.h"
 #include "core/UTF8String.h"
+#include "caching/BeaconChunk.h"
 
 #include <cstdint>
 #include <memory>
 #include <unordered_set>
+#include <vector>
 
 namespace caching
 {
+	///
+	/// Timestamp and size of a cached record, used to select records for eviction.
+	///
+	struct BeaconCacheRecordSummary
+	{
+		/// The record's timestamp
+		int64_t timestamp;
+
+		/// Size of the record's data in bytes
+		int64_t dataSizeInBytes;
+	};
+
+	///
+	/// Position within the records of a single beacon, in the order in which they are evicted.
+	///
+	/// A zero initialized cursor refers to the oldest record.
+	///
+	struct BeaconCacheRecordCursor
+	{
+		/// Number of event data records before the cursor position
+		size_t eventIndex;
+
+		/// Number of action data records before the cursor position
+		size_t actionIndex;
+	};
+
 	///
 	/// Beacon Cache used to cache the Beacons generated by all sessions, actions, ...
 	///
@@ -39,6 +67,9 @@ namespace caching
 
 		///
 		/// Add an @c IObserver which gets notified after a new event data or action data got inserted.
+		///
+		/// Observers are not synchronized, therefore they must be added before data is added or observers are added concurrently.
+		///
 		/// @param[in] observer
 		///
 		virtual void addObserver(IObserver* observer) = 0;
@@ -76,11 +107,15 @@ namespace caching
 		///
 		/// @param[in] beaconID The beacon id for which to get the next chunk.
 		/// @param[in] chunkPrefix Prefix to append to the beginning of the chunk.
-		/// @param[in] maxSize Maximum chunk size. As soon as chunk's size is greater than or equal to maxSize result is returned.
+		/// @param[in] maxSize Maximum chunk size in bytes, including prefix and delimiters. Records are added as long as they fit,
+		///                    only a chunk consisting of a single oversized record exceeds this size.
 		/// @param[in] delimiter Delimiter between consecutive chunks.
-		/// @return the next chunk to send or an empty string, if either the given @c beaconID does not exist or if there is no more data to send.
+		/// The chunk references the cached data in place, it must not be used after the data was removed via
+		/// @ref removeChunkedData or reset via @ref resetChunkedData.
+		///
+		/// @return the next chunk to send or @c nullptr, if either the given @c beaconID does not exist or if there is no more data to send.
 		///
-		virtual const core::UTF8String getNextBeaconChunk(int32_t beaconID, const core::UTF8String& chunkPrefix, int32_t maxSize, const core::UTF8String& delimiter) = 0;
+		virtual std::shared_ptr<BeaconChunk> getNextBeaconChunk(int32_t beaconID, const core::UTF8String& chunkPrefix, int32_t maxSize, const core::UTF8String& delimiter) = 0;
 
 		///
 		/// Remove all data that was previously included in chunks.
@@ -131,6 +166,21 @@ namespace caching
 		///
 		virtual uint32_t evictRecordsByNumber(int32_t beaconID, uint32_t numRecords) = 0;
 
+		///
+		/// Get timestamp and size of the oldest records of a given beacon.
+		///
+		/// The records are returned in the order in which @ref evictRecordsByNumber would evict them,
+		/// starting at @c cursor, which is advanced past the returned records.
+		/// This allows fetching the records in small batches, without traversing them again.
+		/// Records which are currently being sent are not taken into account.
+		///
+		/// @param[in] beaconID The beacon's identifier.
+		/// @param[in,out] cursor The position of the first record to return.
+		/// @param[in] maxNumRecords The maximum number of records to return.
+		/// @return Summaries of the oldest records or an empty vector, if there are no further records or the beacon does not exist.
+		///
+		virtual std::vector<BeaconCacheRecordSummary> getOldestRecords(int32_t beaconID, BeaconCacheRecordCursor& cursor, uint32_t maxNumRecords) = 0;
+
 		///
 		/// Get number of bytes currently stored in cache.
 		///
@@ -17,9 +17,38 @@
 #include "SpaceEvictionStrategy.h"
 
 #include <map>
+#include <queue>
+#include <functional>
 
 using namespace caching;
 
+namespace
+{
+	/// Number of records fetched at once, when more records of a beacon are needed for eviction
+	constexpr uint32_t RECORD_BATCH_SIZE = 16;
+
+	///
+	/// The oldest records of a single beacon, which are considered for eviction
+	///
+	struct BeaconRecords
+	{
+		/// the beacon's identifier
+		int32_t beaconID;
+
+		/// position of the next records to fetch from the cache
+		BeaconCacheRecordCursor cursor;
+
+		/// the current batch of records fetched from the cache
+		std::vector<BeaconCacheRecordSummary> records;
+
+		/// index of the next record in @c records
+		size_t nextRecord;
+
+		/// number of records selected for eviction
+		uint32_t numRecordsSelected;
+	};
+}
+
 SpaceEvictionStrategy::SpaceEvictionStrategy(std::shared_ptr<openkit::ILogger> logger, std::shared_ptr<IBeaconCache> beaconCache, std::shared_ptr<configuration::BeaconCacheConfiguration> configuration, std::function<bool()> isAlive)
 	: mLogger(logger)
 	, mBeaconCache(beaconCache)
@@ -66,30 +95,22 @@ void SpaceEvictionStrategy::doExecute()
 	std::map<int32_t, uint32_t> removedRecordsPerBeacon;
 	while (mIsAliveFunction() && mBeaconCache->getNumBytesInCache() > mConfiguration->getCacheSizeLowerBound())
 	{
-		auto beaconIDs = mBeaconCache->getBeaconIDs();
-		auto it = beaconIDs.begin();
-		while (mIsAliveFunction() && it != beaconIDs.end() && mBeaconCache->getNumBytesInCache() > mConfiguration->getCacheSizeLowerBound())
+		auto numBytesToEvict = mBeaconCache->getNumBytesInCache() - mConfiguration->getCacheSizeLowerBound();
+		auto numRecordsToEvict = selectRecordsToEvict(numBytesToEvict);
+		if (numRecordsToEvict.empty())
 		{
-			auto beaconID = *it;
-
-			// remove 1 record from Beacon cache for given beaconID
-			// the result is the number of records removed, which might be in range [0, numRecords=1]
-			uint32_t numRecordsRemoved = mBeaconCache->evictRecordsByNumber(beaconID, 1);
+			// nothing left which could be evicted
+			break;
+		}
 
+		// evict all selected records of one beacon at once
+		for (auto it = numRecordsToEvict.begin(); mIsAliveFunction() && it != numRecordsToEvict.end(); it++)
+		{
+			uint32_t numRecordsRemoved = mBeaconCache->evictRecordsByNumber(it->first, it->second);
 			if (mLogger->isDebugEnabled())
 			{
-				auto itr = removedRecordsPerBeacon.find(beaconID);
-				if (itr == removedRecordsPerBeacon.end())
-				{
-					removedRecordsPerBeacon.insert(std::make_pair(beaconID, numRecordsRemoved));
-				}
-				else
-				{
-					removedRecordsPerBeacon.insert(std::make_pair(beaconID, itr->second + numRecordsRemoved));
-				}
+				removedRecordsPerBeacon[it->first] += numRecordsRemoved;
 			}
-
-			it++;
 		}
 	}
 
@@ -100,4 +121,67 @@ void SpaceEvictionStrategy::doExecute()
 			mLogger->debug("SpaceEvictionStrategy doExecute() - Removed %u records from Beacon with ID %d", itr->second, itr->first);
 		}
 	}
-}
\ No newline at end of file
+}
+
+std::vector<std::pair<int32_t, uint32_t>> SpaceEvictionStrategy::selectRecordsToEvict(int64_t numBytesToEvict)
+{
+	// seed with the oldest record of each beacon, further records are fetched lazily when needed
+	std::vector<BeaconRecords> beacons;
+	auto beaconIDs = mBeaconCache->getBeaconIDs();
+	for (auto beaconID : beaconIDs)
+	{
+		if (!mIsAliveFunction())
+		{
+			return {};
+		}
+
+		BeaconRecords beacon = { beaconID, { 0, 0 }, {}, 0, 0 };
+		beacon.records = mBeaconCache->getOldestRecords(beaconID, beacon.cursor, 1);
+		if (!beacon.records.empty())
+		{
+			beacons.push_back(std::move(beacon));
+		}
+	}
+
+	// k-way merge of the per beacon records, oldest first, until enough bytes are selected
+	typedef std::pair<int64_t, size_t> HeapItem;	// timestamp, beacon index
+	std::priority_queue<HeapItem, std::vector<HeapItem>, std::greater<HeapItem>> heap;
+	for (size_t beaconIndex = 0; beaconIndex < beacons.size(); beaconIndex++)
+	{
+		heap.push(std::make_pair(beacons[beaconIndex].records.front().timestamp, beaconIndex));
+	}
+
+	int64_t numBytesSelected = 0;
+	while (numBytesSelected < numBytesToEvict && !heap.empty())
+	{
+		auto beaconIndex = heap.top().second;
+		heap.pop();
+
+		auto& beacon = beacons[beaconIndex];
+
+		beacon.numRecordsSelected++;
+		numBytesSelected += beacon.records[beacon.nextRecord].dataSizeInBytes;
+		beacon.nextRecord++;
+
+		if (numBytesSelected < numBytesToEvict && beacon.nextRecord == beacon.records.size())
+		{
+			beacon.records = mBeaconCache->getOldestRecords(beacon.beaconID, beacon.cursor, RECORD_BATCH_SIZE);
+			beacon.nextRecord = 0;
+		}
+		if (beacon.nextRecord < beacon.records.size())
+		{
+			heap.push(std::make_pair(beacon.records[beacon.nextRecord].timestamp, beaconIndex));
+		}
+	}
+
+	std::vector<std::pair<int32_t, uint32_t>> result;
+	for (const auto& beacon : beacons)
+	{
+		if (beacon.numRecordsSelected > 0)
+		{
+			result.emplace_back(beacon.beaconID, beacon.numRecordsSelected);
+		}
+	}
+
+	return result;
+}
@@ -24,6 +24,8 @@
 
 #include <memory>
 #include <functional>
+#include <utility>
+#include <vector>
 
 namespace caching
 {
@@ -32,6 +34,9 @@ namespace caching
 	///
 	/// This strategy checks if the number of cached bytes is greater than @ref configuration::BeaconCacheConfiguration::getCacheSizeLowerBound()
 	/// and in this case runs the strategy.
+	///
+	/// The records to evict are selected across all beacons, oldest first, until the cache size would fall to the lower bound.
+	/// Afterwards the selected records are evicted with a single call per beacon.
 	///
 	class SpaceEvictionStrategy : public IBeaconCacheEvictionStrategy
 	{
@@ -91,6 +96,13 @@ namespace caching
 		///
 		void doExecute();
 
+		///
+		/// Select the oldest records of all beacons, until their total size is greater than or equal to @c numBytesToEvict.
+		/// @param[in] numBytesToEvict the number of bytes to evict
+		/// @return pairs of beacon ID and number of records to evict for this beacon
+		///
+		std::vector<std::pair<int32_t, uint32_t>> selectRecordsToEvict(int64_t numBytesToEvict);
+
 	private:
 		/// Logger to write traces to
 		std::shared_ptr<openkit::ILogger> mLogger;
@@ -31,11 +31,6 @@
 
 using namespace communication;
 
-/// number of retries for the status request
-constexpr int32_t STATUS_REQUEST_RETRIES = 5;
-
-const std::chrono::milliseconds BeaconSendingCaptureOffState::INITIAL_RETRY_SLEEP_TIME_MILLISECONDS(std::chrono::seconds(1));
-
 const std::chrono::milliseconds STATUS_CHECK_INTERVAL_MILLISECONDS = std::chrono::hours(2);
 const int64_t STATUS_CHECK_INTERVAL = STATUS_CHECK_INTERVAL_MILLISECONDS.count();
 
@@ -69,7 +64,8 @@ void BeaconSendingCaptureOffState::doExecute(BeaconSendingContext& context)
 			return;
 		}
 	}
-	auto statusResponse = BeaconSendingRequestUtil::sendStatusRequest(context, STATUS_REQUEST_RETRIES, INITIAL_RETRY_SLEEP_TIME_MILLISECONDS.count());
+	auto retryPolicy = context.getConfiguration()->getHTTPClientConfiguration()->getStatusRequestRetryPolicy();
+	auto statusResponse = BeaconSendingRequestUtil::sendStatusRequest(context, *retryPolicy);
 	handleStatusResponse(context, statusResponse);
 
 	// update the last status check time in any case
@@ -28,7 +28,7 @@ namespace communication
 {
 	///
 	/// State where no data is captured. Periodically issues a status request to check if capturing shall be re-enabled.
-	/// The check interval is defined in @ref INITIAL_RETRY_SLEEP_TIME_MILLISECONDS.
+	/// Failed status requests are retried according to the status request retry policy of the @ref configuration::HTTPClientConfiguration.
 	///
 	/// Transition to:
 	///   - @ref BeaconSendingCaptureOnState if capturing is re-enabled
@@ -60,9 +60,6 @@ namespace communication
 
 		virtual const char* getStateName() const override;
 
-		/// The initial delay which is later on doubled between one unsuccessful attempt and the next retry
-		static const std::chrono::milliseconds INITIAL_RETRY_SLEEP_TIME_MILLISECONDS;
-
 		///
 		/// Gets the sleep time set in the constructor.
 		/// @remarks This returns -1, if the default sleep behavior (default constructor) is used.
@@ -19,6 +19,7 @@
 #include <chrono>
 #include <algorithm>
 #include <memory>
+#include <unordered_map>
 
 #include "communication/BeaconSendingCaptureOffState.h"
 #include "communication/BeaconSendingFlushSessionsState.h"
@@ -31,8 +32,28 @@
 
 using namespace communication;
 
+namespace
+{
+	///
+	/// Abort all requests in flight, the sessions keep their data for sending it later.
+	///
+	void abortSessionsInFlight(std::shared_ptr<protocol::IHTTPMultiClient> multiClient,
+		const std::unordered_map<protocol::IHTTPMultiClient::RequestID, std::shared_ptr<core::SessionWrapper>>& sessionsInFlight)
+	{
+		multiClient->cancelAllRequests();
+		for (const auto& abortedSession : sessionsInFlight)
+		{
+			abortedSession.second->handleBeaconChunkResponse(nullptr);
+		}
+	}
+}
+
 BeaconSendingCaptureOnState::BeaconSendingCaptureOnState()
 	: AbstractBeaconSendingState(AbstractBeaconSendingState::StateType::BEACON_SENDING_CAPTURE_ON_STATE)
+	// the state does not know what happened before it was entered, therefore assume there is data to retry
+	, mSendPending(true)
+	, mNewSessionResponse(nullptr)
+	, mNewSessionResponseTimestamp(0)
 {
 
 }
@@ -47,13 +68,18 @@ void BeaconSendingCaptureOnState::doExecute(BeaconSendingContext& context)
 		return;
 	}
 
-	context.sleep();
+	context.waitForWakeup(getSleepTimeInMilliseconds(context));
 	if (context.isShutdownRequested())
 	{
 		// shutdown was requested during sleep
 		// return and let the base class handle this
 		return;
 	}
+	mSendPending = false;
+
+	// a flush requires the data of all sessions to be sent in this pass
+	auto flushID = context.getLastRequestedFlushID();
+	auto isFlushRequested = flushID > context.getLastCompletedFlushID();
 
 	// sned new session request for all sessions that are new
 	auto newSessionsResponse = sendNewSessionRequests(context);
@@ -63,6 +89,11 @@ void BeaconSendingCaptureOnState::doExecute(BeaconSendingContext& context)
 		context.setNextState(std::make_shared<BeaconSendingCaptureOffState>(newSessionsResponse->getRetryAfterInMilliseconds()));
 		return;
 	}
+	if (context.isShutdownRequested())
+	{
+		// don't start any further requests, the shutdown state sends the remaining data
+		return;
+	}
 	
 	// send all finished sessions
 	auto finishedSessionsResponse = sendFinishedSessions(context);
@@ -72,9 +103,14 @@ void BeaconSendingCaptureOnState::doExecute(BeaconSendingContext& context)
 		context.setNextState(std::make_shared<BeaconSendingCaptureOffState>(finishedSessionsResponse->getRetryAfterInMilliseconds()));
 		return;
 	}
+	if (context.isShutdownRequested())
+	{
+		// requests waiting for a retry were aborted, don't start sending open sessions
+		return;
+	}
 
 	// check if we need to send open sessions & do it if necessary
-	auto openSessionsResponse = sendOpenSessions(context);
+	auto openSessionsResponse = sendOpenSessions(context, isFlushRequested);
 	if (BeaconSendingResponseUtil::isTooManyRequestsResponse(openSessionsResponse))
 	{
 		// server is currently overloaded, temporarily switch to capture off
@@ -91,6 +127,12 @@ void BeaconSendingCaptureOnState::doExecute(BeaconSendingContext& context)
 		lastStatusResponse = finishedSessionsResponse;
 	}
 
+	if (isFlushRequested && !mSendPending)
+	{
+		// all data was acknowledged by the server, otherwise the flush is retried in the next pass
+		context.setFlushCompleted(flushID);
+	}
+
 	// handle the last statusResponse received (or null if none was received) from the server
 	handleStatusResponse(context, lastStatusResponse);
 }
@@ -107,57 +149,195 @@ const char* BeaconSendingCaptureOnState::getStateName() const
 
 std::shared_ptr<protocol::StatusResponse> BeaconSendingCaptureOnState::sendFinishedSessions(BeaconSendingContext& context)
 {
-	std::shared_ptr<protocol::StatusResponse> statusResponse = nullptr;
 	// check if there's finished Sessions to be sent -> immediately send beacon(s) of finished Sessions
+	std::vector<std::shared_ptr<core::SessionWrapper>> sessionsToSend;
 	for (auto session : context.getAllFinishedAndConfiguredSessions())
 	{
-		if (session->isDataSendingAllowed()) {
-			statusResponse = session->sendBeacon(context.getHTTPClientProvider());
-			if (!BeaconSendingResponseUtil::isSuccessfulResponse(statusResponse))
-			{
-				// something went wrong,
-				if (BeaconSendingResponseUtil::isTooManyRequestsResponse(statusResponse) || !session->isEmpty())
-				{
-					break; //  sending did not work, break out for now and retry it later
-				}
-			}
+		if (session->isDataSendingAllowed())
+		{
+			sessionsToSend.push_back(session);
 		}
+		else
+		{
+			// session is not allowed to be sent - so remove it from beacon cache
+			context.removeSession(session);
+			session->clearCapturedData();
+		}
+	}
 
-		// session was sent/is not allowed to be sent - so remove it from beacon cache
+	return sendSessions(context, sessionsToSend, [this, &context](std::shared_ptr<core::SessionWrapper> session, std::shared_ptr<protocol::StatusResponse> statusResponse)
+	{
+		if (!BeaconSendingResponseUtil::isSuccessfulResponse(statusResponse) && !session->isEmpty())
+		{
+			mSendPending = true;
+			return false; //  sending did not work, stop for now and retry it later
+		}
+
+		// session was sent - so remove it from beacon cache
 		context.removeSession(session);
 		session->clearCapturedData();
-	}
-
-	return statusResponse;
+		return true;
+	});
 }
 
-std::shared_ptr<protocol::StatusResponse> BeaconSendingCaptureOnState::sendOpenSessions(BeaconSendingContext& context)
+std::shared_ptr<protocol::StatusResponse> BeaconSendingCaptureOnState::sendOpenSessions(BeaconSendingContext& context, bool isFlushRequested)
 {
 	std::shared_ptr<protocol::StatusResponse> statusResponse = nullptr;
 	int64_t currentTimestamp = context.getCurrentTimestamp();
-	if (currentTimestamp <= context.getLastOpenSessionBeaconSendTime() + context.getSendInterval())
+	auto isSessionFlushRequested = context.consumeSessionFlushRequest();
+	auto sendAllSessions = context.consumeOpenSessionsSendingRequest() || isFlushRequested
+		|| currentTimestamp > context.getLastOpenSessionBeaconSendTime() + context.getSendInterval();
+	if (!sendAllSessions && !isSessionFlushRequested)
 	{
 		return nullptr; // send interval to send open sessions has not expired yet
 	}
 
+	std::vector<std::shared_ptr<core::SessionWrapper>> sessionsToSend;
 	for (auto session : context.getAllOpenAndConfiguredSessions())
 	{
+		// always reset the session's flush request, it's obsolete when all sessions are sent
+		if (!session->consumeFlushRequest() && !sendAllSessions)
+		{
+			continue;
+		}
+
 		if (session->isDataSendingAllowed())
 		{
-			statusResponse = session->sendBeacon(context.getHTTPClientProvider());
-			if (BeaconSendingResponseUtil::isTooManyRequestsResponse(statusResponse))
+			sessionsToSend.push_back(session);
+		}
+		else
+		{
+			session->clearCapturedData();
+		}
+	}
+
+	if (isSessionFlushRequested)
+	{
+		// a flushed session still waiting for its new session response is sent in a later pass
+		for (auto session : context.getAllNewSessions())
+		{
+			if (session->isFlushRequested())
 			{
-				// server is currently overloaded, return immediately
+				context.keepSessionFlushRequest();
 				break;
 			}
 		}
-		else
+	}
+
+	statusResponse = sendSessions(context, sessionsToSend, [this, isFlushRequested](std::shared_ptr<core::SessionWrapper> session, std::shared_ptr<protocol::StatusResponse> statusResponse)
+	{
+		if (isFlushRequested && !BeaconSendingResponseUtil::isSuccessfulResponse(statusResponse) && !session->isEmpty())
 		{
-			session->clearCapturedData();
+			mSendPending = true; // the flush is only completed, once all data was sent
 		}
+		return true; // continue with the other sessions, open sessions are sent again after the next send interval
+	});
+
+	if (sendAllSessions)
+	{
+		context.setLastOpenSessionBeaconSendTime(currentTimestamp);
 	}
 
-	context.setLastOpenSessionBeaconSendTime(currentTimestamp);
+	return statusResponse;
+}
+
+std::shared_ptr<protocol::StatusResponse> BeaconSendingCaptureOnState::sendSessions(BeaconSendingContext& context, const std::vector<std::shared_ptr<core::SessionWrapper>>& sessions, const SessionSentCallback& sessionSent)
+{
+	if (sessions.empty())
+	{
+		return nullptr;
+	}
+
+	auto multiClient = context.getHTTPMultiClient();
+	auto maxConcurrentRequests = std::max(size_t(1), size_t(context.getConfiguration()->getHTTPClientConfiguration()->getMaxConcurrentBeaconRequests()));
+
+	std::shared_ptr<protocol::StatusResponse> statusResponse = nullptr;
+	std::shared_ptr<protocol::StatusResponse> tooManyRequestsResponse = nullptr;
+	std::unordered_map<protocol::IHTTPMultiClient::RequestID, std::shared_ptr<core::SessionWrapper>> sessionsInFlight;
+	auto nextSession = sessions.begin();
+	auto startNextSession = true;
+
+	while (true)
+	{
+		// start sending further sessions, until the maximum number of requests is in flight
+		while (startNextSession && nextSession != sessions.end() && sessionsInFlight.size() < maxConcurrentRequests)
+		{
+			auto session = *nextSession++;
+			auto requestID = session->sendNextBeaconChunk(multiClient);
+			if (requestID != protocol::IHTTPMultiClient::INVALID_REQUEST_ID)
+			{
+				sessionsInFlight[requestID] = session;
+			}
+			else
+			{
+				// nothing to send for this session
+				startNextSession = sessionSent(session, nullptr);
+			}
+		}
+
+		if (sessionsInFlight.empty())
+		{
+			break;
+		}
+
+		auto completedRequests = multiClient->waitForCompletedRequests();
+		if (completedRequests.empty())
+		{
+			// all requests in flight wait for a retry, wait on the context to be interruptible by shutdown
+			context.sleep(multiClient->getMillisecondsUntilNextRetry());
+			if (context.isShutdownRequested())
+			{
+				abortSessionsInFlight(multiClient, sessionsInFlight);
+				return statusResponse;
+			}
+			continue;
+		}
+
+		for (const auto& completedRequest : completedRequests)
+		{
+			auto sessionInFlight = sessionsInFlight.find(completedRequest.requestID);
+			if (sessionInFlight == sessionsInFlight.end())
+			{
+				continue;
+			}
+			auto session = sessionInFlight->second;
+			sessionsInFlight.erase(sessionInFlight);
+
+			statusResponse = completedRequest.response;
+			auto isChunkSent = session->handleBeaconChunkResponse(statusResponse);
+			if (BeaconSendingResponseUtil::isTooManyRequestsResponse(statusResponse))
+			{
+				tooManyRequestsResponse = statusResponse;
+			}
+			if (tooManyRequestsResponse != nullptr)
+			{
+				continue;
+			}
+
+			if (isChunkSent)
+			{
+				// the session's next chunk is only sent after the previous one was received by the server
+				auto requestID = session->sendNextBeaconChunk(multiClient);
+				if (requestID != protocol::IHTTPMultiClient::INVALID_REQUEST_ID)
+				{
+					sessionsInFlight[requestID] = session;
+					continue;
+				}
+			}
+
+			if (!sessionSent(session, statusResponse))
+			{
+				startNextSession = false;
+			}
+		}
+
+		if (tooManyRequestsResponse != nullptr)
+		{
+			// server is currently overloaded, abort all requests in flight and keep their data for later
+			abortSessionsInFlight(multiClient, sessionsInFlight);
+			return tooManyRequestsResponse;
+		}
+	}
 
 	return statusResponse;
 }
@@ -178,36 +358,89 @@ void BeaconSendingCaptureOnState::handleStatusResponse(BeaconSendingContext& con
 
 std::shared_ptr<protocol::StatusResponse> BeaconSendingCaptureOnState::sendNewSessionRequests(BeaconSendingContext& context)
 {
+	auto batchWindow = context.getConfiguration()->getHTTPClientConfiguration()->getNewSessionRequestBatchWindow();
+	std::shared_ptr<protocol::IHTTPClient> httpClient = nullptr;
 	std::shared_ptr<protocol::StatusResponse> statusResponse = nullptr;
 	for (auto session : context.getAllNewSessions() )
 	{
 		if (!session->canSendNewSessionRequest())
 		{
 			// already exceeded the maximum number of session requests, disable any further data collecting
-			auto beaconConfiguration = session->getBeaconConfiguration();
-			auto newBeaconConfiguration = std::make_shared<configuration::BeaconConfiguration>(0, beaconConfiguration->getDataCollectionLevel(), beaconConfiguration->getCrashReportingLevel());
-			session->updateBeaconConfiguration(newBeaconConfiguration);
+			updateMultiplicity(session, 0);
 			continue;
 		}
 
-		statusResponse = context.getHTTPClient()->sendNewSessionRequest();
+		if (batchWindow > 0 && mNewSessionResponse != nullptr)
+		{
+			if (context.getCurrentTimestamp() - mNewSessionResponseTimestamp <= batchWindow)
+			{
+				// the server's decision for a recent new session also applies to this one
+				updateMultiplicity(session, mNewSessionResponse->getMultiplicity());
+				continue;
+			}
+		}
+
+		if (httpClient == nullptr)
+		{
+			// one client for all requests, so that its connection is reused
+			httpClient = context.getHTTPClient();
+		}
+
+		statusResponse = httpClient->sendNewSessionRequest();
 		if (BeaconSendingResponseUtil::isSuccessfulResponse(statusResponse))
 		{
-			auto beaconConfiguration = session->getBeaconConfiguration();
-			auto newBeaconConfiguration = std::make_shared<configuration::BeaconConfiguration>(statusResponse->getMultiplicity(), beaconConfiguration->getDataCollectionLevel(), beaconConfiguration->getCrashReportingLevel());
-			session->updateBeaconConfiguration(newBeaconConfiguration);
+			updateMultiplicity(session, statusResponse->getMultiplicity());
+			if (batchWindow > 0)
+			{
+				// the batch window starts when the response was received, a slow response must not shorten it
+				mNewSessionResponse = statusResponse;
+				mNewSessionResponseTimestamp = context.getCurrentTimestamp();
+			}
 		}
 		else if (BeaconSendingResponseUtil::isTooManyRequestsResponse(statusResponse))
 		{
 			// server is currently overloaded, return immediately
 			break;
 		}
+		else if (BeaconSendingResponseUtil::isConnectionErrorResponse(statusResponse))
+		{
+			// server was not reached, this does not count as new session request and is retried with the next pass
+			mSendPending = true;
+			break;
+		}
 		else
 		{
 			// any other unsuccessful response
 			session->decreaseNumberOfNewSessionRequests();
+			mSendPending = true;
 		}
 	}
 
 	return statusResponse;
+}
+
+void BeaconSendingCaptureOnState::updateMultiplicity(std::shared_ptr<core::SessionWrapper> session, int32_t multiplicity)
+{
+	auto beaconConfiguration = session->getBeaconConfiguration();
+	auto newBeaconConfiguration = std::make_shared<configuration::BeaconConfiguration>(multiplicity, beaconConfiguration->getDataCollectionLevel(), beaconConfiguration->getCrashReportingLevel());
+	session->updateBeaconConfiguration(newBeaconConfiguration);
+}
+
+int64_t BeaconSendingCaptureOnState::getSleepTimeInMilliseconds(BeaconSendingContext& context) const
+{
+	// open sessions are sent as soon as the send interval has expired
+	auto nextSendTime = context.getLastOpenSessionBeaconSendTime() + context.getSendInterval() + 1;
+	if (context.isTimeSyncSupported() && context.getLastTimeSyncTime() >= 0)
+	{
+		// same for the time sync interval
+		nextSendTime = std::min(nextSendTime, context.getLastTimeSyncTime() + static_cast<int64_t>(BeaconSendingTimeSyncState::TIME_SYNC_INTERVAL_IN_MILLIS.count()) + 1);
+	}
+
+	auto sleepTime = std::max(int64_t(0), nextSendTime - context.getCurrentTimestamp());
+	if (mSendPending)
+	{
+		sleepTime = std::min(sleepTime, static_cast<int64_t>(BeaconSendingContext::DEFAULT_SLEEP_TIME_MILLISECONDS.count()));
+	}
+
+	return sleepTime;
 }
\ No newline at end of file
@@ -18,17 +18,23 @@
 #define _COMMUNICATION_BEACONSENDINGCAPTUREONSTATE_H
 
 #include "communication/AbstractBeaconSendingState.h"
+#include "core/SessionWrapper.h"
 #include "protocol/StatusResponse.h"
 
 #include <memory>
 #include <vector>
 #include <chrono>
+#include <functional>
 
 namespace communication
 {
 	///
 	/// The sending state, when init is completed and capturing is turned on.
 	///
+	/// Between two sending passes the state waits until the next deadline, which is the expiry of the send interval
+	/// or the time sync interval. Starting or finishing a session wakes it up earlier. Data which could not be sent
+	/// is retried after @ref BeaconSendingContext::DEFAULT_SLEEP_TIME_MILLISECONDS.
+	///
 	/// Transition to:
 	///   - @ref BeaconSendingTimeSyncState if BeaconSendingTimeSyncState::isTimeSyncRequired(BeaconSendingContext) is @c true
 	///   - @ref BeaconSendingCaptureOffState if capturing is turned off
@@ -62,9 +68,34 @@ namespace communication
 
 		///
 		/// Check if the send interval (configured by server) has expired and start to send open sessions if it has expired.
+		///
+		/// Open sessions for which a flush was requested are sent regardless of the send interval.
+		/// @param[in] context the state context
+		/// @param[in] isFlushRequested @c true if all open sessions shall be sent due to a flush
+		///
+		std::shared_ptr<protocol::StatusResponse> sendOpenSessions(BeaconSendingContext& context, bool isFlushRequested);
+
+		///
+		/// Callback invoked, when a session's beacon was sent completely or sending it failed.
+		///
+		/// The arguments are the session and the last response received for it, or @c nullptr if there was no data to send.
+		/// Returning @c false stops sending further sessions.
+		///
+		using SessionSentCallback = std::function<bool(std::shared_ptr<core::SessionWrapper>, std::shared_ptr<protocol::StatusResponse>)>;
+
+		///
+		/// Send the beacons of the given sessions concurrently.
+		///
+		/// Up to the configured maximum number of beacon requests are in flight at the same time. The chunks of one session
+		/// are sent one after the other, so each session has at most one request in flight.
+		/// If the server responds with "too many requests", all requests still in flight are aborted and their data is kept
+		/// for sending it later. The same applies, if shutdown is requested while waiting for requests to be retried.
 		/// @param[in] context the state context
+		/// @param[in] sessions the sessions to send
+		/// @param[in] sessionSent callback invoked for each session, when sending it is done
+		/// @returns the last response received, or @c nullptr if no request was sent
 		///
-		std::shared_ptr<protocol::StatusResponse> sendOpenSessions(BeaconSendingContext& context);
+		static std::shared_ptr<protocol::StatusResponse> sendSessions(BeaconSendingContext& context, const std::vector<std::shared_ptr<core::SessionWrapper>>& sessions, const SessionSentCallback& sessionSent);
 
 		///
 		/// Handle the status response received from the server and transistion the states accordingly
@@ -75,9 +106,35 @@ namespace communication
 
 		///
 		/// Check if new sessions are allowed to report data
+		///
+		/// A successful response is applied to all further new sessions within the configured batch window,
+		/// instead of sending one request per session.
 		/// @param[in] context beacon sending context
 		///
 		std::shared_ptr<protocol::StatusResponse> sendNewSessionRequests(BeaconSendingContext& context);
+
+		///
+		/// Update the multiplicity of the given session, keeping its other beacon settings
+		/// @param[in] session the session to update
+		/// @param[in] multiplicity the new multiplicity
+		///
+		static void updateMultiplicity(std::shared_ptr<core::SessionWrapper> session, int32_t multiplicity);
+
+		///
+		/// Get the time to wait until the next sending pass is due, unless new work arrives earlier.
+		/// @param[in] context beacon sending context
+		/// @returns the number of milliseconds to wait
+		///
+		int64_t getSleepTimeInMilliseconds(BeaconSendingContext& context) const;
+
+		/// flag indicating that the last pass left data which has to be retried
+		bool mSendPending;
+
+		/// last successful new session response, which is applied to new sessions within the batch window
+		std::shared_ptr<protocol::StatusResponse> mNewSessionResponse;
+
+		/// timestamp when @c mNewSessionResponse was received
+		int64_t mNewSessionResponseTimestamp;
 	};
 }
 #endif
\ No newline at end of file
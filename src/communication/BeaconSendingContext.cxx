@@ -23,6 +23,8 @@
 #include "configuration/Configuration.h"
 #include "configuration/HTTPClientConfiguration.h"
 
+#include <algorithm>
+
 using namespace communication;
 
 const std::chrono::milliseconds BeaconSendingContext::DEFAULT_SLEEP_TIME_MILLISECONDS(std::chrono::seconds(1));
@@ -36,8 +38,13 @@ BeaconSendingContext::BeaconSendingContext(std::shared_ptr<openkit::ILogger> log
 	, mCurrentState(std::move(initialState))
 	, mNextState(nullptr)
 	, mShutdown(false)
+	, mWakeupRequested(false)
 	, mShutdownMutex()
 	, mSleepConditionVariable()
+	, mOpenSessionsSendingRequested(false)
+	, mSessionFlushRequested(false)
+	, mLastRequestedFlushID(0)
+	, mLastCompletedFlushID(0)
 	, mInitSucceeded(false)
 	, mConfiguration(configuration)
 	, mHTTPClientProvider(httpClientProvider)
@@ -113,6 +120,12 @@ std::shared_ptr<protocol::IHTTPClient> BeaconSendingContext::getHTTPClient()
 	return mHTTPClientProvider->createClient(mLogger, httpClientConfig);
 }
 
+std::shared_ptr<protocol::IHTTPMultiClient> BeaconSendingContext::getHTTPMultiClient()
+{
+	std::shared_ptr<configuration::HTTPClientConfiguration> httpClientConfig = mConfiguration->getHTTPClientConfiguration();
+	return mHTTPClientProvider->createMultiClient(mLogger, httpClientConfig);
+}
+
 int64_t BeaconSendingContext::getSendInterval() const
 {
 	return mConfiguration->getSendInterval();
@@ -132,7 +145,7 @@ void BeaconSendingContext::handleStatusResponse(std::shared_ptr<protocol::Status
 void BeaconSendingContext::clearAllSessionData()
 {
 	// clear captured data from finished sessions
-	for (auto session : mSessions.toStdVector())
+	for (auto session : mSessions.getAllSessions())
 	{
 		session->clearCapturedData();
 		if (session->isSessionFinished())
@@ -186,6 +199,87 @@ void BeaconSendingContext::sleep(int64_t ms)
 	mSleepConditionVariable.wait_for(lock, std::chrono::milliseconds(ms), [&] { return mShutdown; });
 }
 
+void BeaconSendingContext::waitForWakeup(int64_t ms)
+{
+	std::unique_lock<std::mutex> lock(mShutdownMutex);
+	mSleepConditionVariable.wait_for(lock, std::chrono::milliseconds(ms), [&] { return mShutdown || mWakeupRequested; });
+	mWakeupRequested = false;
+}
+
+void BeaconSendingContext::wakeup()
+{
+	std::unique_lock<std::mutex> lock(mShutdownMutex);
+	mWakeupRequested = true;
+	mSleepConditionVariable.notify_all();
+}
+
+void BeaconSendingContext::requestOpenSessionsSending()
+{
+	mOpenSessionsSendingRequested = true;
+	wakeup();
+}
+
+bool BeaconSendingContext::consumeOpenSessionsSendingRequest()
+{
+	// only write the shared flag if it's set, this is checked on each iteration of the sending thread
+	return mOpenSessionsSendingRequested.load(std::memory_order_relaxed) && mOpenSessionsSendingRequested.exchange(false);
+}
+
+int64_t BeaconSendingContext::requestFlush()
+{
+	std::unique_lock<std::mutex> lock(mShutdownMutex);
+	mWakeupRequested = true;
+	mSleepConditionVariable.notify_all();
+	return ++mLastRequestedFlushID;
+}
+
+bool BeaconSendingContext::waitForFlush(int64_t flushID, int64_t timeoutMillis)
+{
+	std::unique_lock<std::mutex> lock(mShutdownMutex);
+	mSleepConditionVariable.wait_for(lock, std::chrono::milliseconds(timeoutMillis), [&] { return mShutdown || mLastCompletedFlushID >= flushID; });
+	return mLastCompletedFlushID >= flushID;
+}
+
+int64_t BeaconSendingContext::getLastRequestedFlushID() const
+{
+	std::unique_lock<std::mutex> lock(mShutdownMutex);
+	return mLastRequestedFlushID;
+}
+
+int64_t BeaconSendingContext::getLastCompletedFlushID() const
+{
+	std::unique_lock<std::mutex> lock(mShutdownMutex);
+	return mLastCompletedFlushID;
+}
+
+void BeaconSendingContext::setFlushCompleted(int64_t flushID)
+{
+	std::unique_lock<std::mutex> lock(mShutdownMutex);
+	mLastCompletedFlushID = std::max(mLastCompletedFlushID, flushID);
+	mSleepConditionVariable.notify_all();
+}
+
+void BeaconSendingContext::flushSession(std::shared_ptr<core::Session> session)
+{
+	std::shared_ptr<core::SessionWrapper> sessionWrapper = findSessionWrapper(session);
+	if (sessionWrapper != nullptr)
+	{
+		sessionWrapper->requestFlush();
+		mSessionFlushRequested = true;
+		wakeup();
+	}
+}
+
+bool BeaconSendingContext::consumeSessionFlushRequest()
+{
+	return mSessionFlushRequested.load(std::memory_order_relaxed) && mSessionFlushRequested.exchange(false);
+}
+
+void BeaconSendingContext::keepSessionFlushRequest()
+{
+	mSessionFlushRequested = true;
+}
+
 int64_t BeaconSendingContext::getLastStatusCheckTime() const
 {
 	return mLastStatusCheckTime;
@@ -257,7 +351,8 @@ void BeaconSendingContext::initializeTimeSync(int64_t clusterTimeOffset, bool is
 void BeaconSendingContext::startSession(std::shared_ptr<core::Session> session)
 {
 	auto sessionWrapper = std::make_shared<core::SessionWrapper>(session);
-	mSessions.put(sessionWrapper);
+	mSessions.add(sessionWrapper);
+	wakeup();
 }
 
 void BeaconSendingContext::finishSession(std::shared_ptr<core::Session> session)
@@ -266,51 +361,23 @@ void BeaconSendingContext::finishSession(std::shared_ptr<core::Session> session)
 	if (sessionWrapper != nullptr)
 	{
 		sessionWrapper->finishSession();
+		wakeup();
 	}
 }
 
 std::vector<std::shared_ptr<core::SessionWrapper>> BeaconSendingContext::getAllNewSessions()
 {
-	std::vector<std::shared_ptr<core::SessionWrapper>> newSessions;
-
-	for (auto wrapper : mSessions.toStdVector())
-	{
-		if (!wrapper->isBeaconConfigurationSet())
-		{
-			newSessions.push_back(wrapper);
-		}
-	}
-
-	return newSessions;
+	return mSessions.getNewSessions();
 }
 
 std::vector<std::shared_ptr<core::SessionWrapper>> BeaconSendingContext::getAllOpenAndConfiguredSessions()
 {
-	std::vector<std::shared_ptr<core::SessionWrapper>> openSessions;
-
-	for (auto wrapper : mSessions.toStdVector())
-	{
-		if (wrapper->isBeaconConfigurationSet() && !wrapper->isSessionFinished())
-		{
-			openSessions.push_back(wrapper);
-		}
-	}
-
-	return openSessions;
+	return mSessions.getOpenAndConfiguredSessions();
 }
 
 std::vector<std::shared_ptr<core::SessionWrapper>> BeaconSendingContext::getAllFinishedAndConfiguredSessions()
 {
-	std::vector<std::shared_ptr<core::SessionWrapper>> finishedSessions;
-	for (auto wrapper : mSessions.toStdVector())
-	{
-		if (wrapper->isBeaconConfigurationSet() && wrapper->isSessionFinished())
-		{
-			finishedSessions.push_back(wrapper);
-		}
-	}
-
-	return finishedSessions;
+	return mSessions.getFinishedAndConfiguredSessions();
 }
 
 std::shared_ptr<AbstractBeaconSendingState> BeaconSendingContext::getNextState()
@@ -320,17 +387,10 @@ std::shared_ptr<AbstractBeaconSendingState> BeaconSendingContext::getNextState()
 
 std::shared_ptr<core::SessionWrapper> BeaconSendingContext::findSessionWrapper(std::shared_ptr<core::Session> session)
 {
-	for (auto sessionWrapper : mSessions.toStdVector())
-	{
-		if ( sessionWrapper->getWrappedSession() == session )
-		{
-			return sessionWrapper;
-		}
-	}
-	return nullptr;
+	return mSessions.find(session);
 }
 
 bool BeaconSendingContext::removeSession(std::shared_ptr<core::SessionWrapper> sessionWrapper)
 {
 	return mSessions.remove(sessionWrapper);
-}
\ No newline at end of file
+}
@@ -19,7 +19,6 @@
 
 #include "OpenKit/ILogger.h"
 #include "core/util/CountDownLatch.h"
-#include "core/util/SynchronizedQueue.h"
 #include "providers/IHTTPClientProvider.h"
 #include "providers/ITimingProvider.h"
 #include "configuration/Configuration.h"
@@ -27,6 +26,7 @@
 #include "communication/AbstractBeaconSendingState.h"
 #include "core/Session.h"
 #include "core/SessionWrapper.h"
+#include "core/SessionRegistry.h"
 
 #include <atomic>
 #include <memory>
@@ -179,6 +179,12 @@ namespace communication
 		///
 		virtual std::shared_ptr<protocol::IHTTPClient> getHTTPClient();
 
+		///
+		/// Returns a client for sending beacon requests concurrently
+		/// @returns a shared pointer to the multi client created by the BeaconSendingContext
+		///
+		virtual std::shared_ptr<protocol::IHTTPMultiClient> getHTTPMultiClient();
+
 		///
 		/// Get current timestamp
 		/// @returns current timestamp
@@ -196,6 +202,85 @@ namespace communication
 		///
 		virtual void sleep(int64_t ms);
 
+		///
+		/// Wait until @ref wakeup is called, shutdown is requested or the given amount of time elapsed.
+		///
+		/// Unlike @ref sleep this returns early when new work arrives. A wakeup which happened while the
+		/// sending thread was busy is not lost, but makes the next call return immediately.
+		/// @param[in] ms maximum number of milliseconds to wait
+		///
+		virtual void waitForWakeup(int64_t ms);
+
+		///
+		/// Wake up the sending thread, if it is waiting in @ref waitForWakeup.
+		///
+		virtual void wakeup();
+
+		///
+		/// Request to send the data of open sessions without waiting for the send interval to expire
+		/// and wake up the sending thread.
+		///
+		virtual void requestOpenSessionsSending();
+
+		///
+		/// Check whether sending open sessions was requested via @ref requestOpenSessionsSending and reset the request.
+		/// @returns @c true if sending was requested since the last call, @c false otherwise
+		///
+		virtual bool consumeOpenSessionsSendingRequest();
+
+		///
+		/// Request to send the data of all sessions without waiting for the send interval to expire
+		/// and wake up the sending thread.
+		/// @returns the ID of this flush request, to be passed to @ref waitForFlush
+		///
+		virtual int64_t requestFlush();
+
+		///
+		/// Wait until the flush with the given ID was completed, shutdown is requested or the given amount of time elapsed.
+		/// @param[in] flushID the ID returned by @ref requestFlush
+		/// @param[in] timeoutMillis maximum number of milliseconds to wait
+		/// @returns @c true if the flush was completed, @c false otherwise
+		///
+		bool waitForFlush(int64_t flushID, int64_t timeoutMillis);
+
+		///
+		/// Get the ID of the flush requested last
+		/// @returns the ID of the flush requested last or @c 0 if no flush was requested yet
+		///
+		virtual int64_t getLastRequestedFlushID() const;
+
+		///
+		/// Get the ID of the flush completed last
+		/// @returns the ID of the flush completed last or @c 0 if no flush was completed yet
+		///
+		virtual int64_t getLastCompletedFlushID() const;
+
+		///
+		/// Mark all flushes up to the given ID as completed and wake up the threads waiting for them.
+		/// @param[in] flushID the ID of the completed flush
+		///
+		virtual void setFlushCompleted(int64_t flushID);
+
+		///
+		/// Request to send the data of the given open session without waiting for the send interval to expire
+		/// and wake up the sending thread.
+		/// @param[in] session the session to send
+		///
+		virtual void flushSession(std::shared_ptr<core::Session> session);
+
+		///
+		/// Check whether sending single sessions was requested via @ref flushSession and reset the request.
+		/// @returns @c true if sending was requested since the last call, @c false otherwise
+		///
+		virtual bool consumeSessionFlushRequest();
+
+		///
+		/// Restore the request consumed by @ref consumeSessionFlushRequest, without waking up the sending thread.
+		///
+		/// This is used if a flushed session could not be sent yet, since it's not configured.
+		///
+		virtual void keepSessionFlushRequest();
+
 		///
 		/// Get timestamp when open sessions were sent last
 		/// @returns timestamp of last sending of open session
@@ -276,7 +361,7 @@ namespace communication
 
 		///
 		/// Start a new session.
-		/// This add the @c session to the internal container of open sessions.
+		/// This add the @c session to the internal container of open sessions and wakes up the sending thread.
 		/// @param[in] session The new session to start.
 		///
 		virtual void startSession(std::shared_ptr<core::Session> session);
@@ -285,6 +370,7 @@ namespace communication
 		/// Finish a session which has been started previously using startSession(std::shared_ptr<core::Session>)
 		/// If the session cannot be found in the container storing all open sessions, the parameter is ignored,
 		/// otherwise it's removed from the container storing open sessions and added to the finished session container.
+		/// The sending thread is woken up to send the finished session.
 		/// @param[in] session The session to finish.
 		///
 		virtual void finishSession(std::shared_ptr<core::Session> session);
@@ -333,12 +419,27 @@ namespace communication
 		/// Boolean indicating shutdown flag.
 		bool mShutdown;
 
-		/// mutex used for sychronisation access to mShutdown
+		/// flag indicating that the sending thread shall stop waiting in @ref waitForWakeup
+		bool mWakeupRequested;
+
+		/// mutex used for sychronisation access to mShutdown, mWakeupRequested and the flush IDs
 		mutable std::mutex mShutdownMutex;
 
-		/// condition variable used to wait on when calling sleep.
+		/// condition variable used to wait on when calling sleep or waitForWakeup.
 		std::condition_variable mSleepConditionVariable;
 
+		/// flag indicating that open sessions shall be sent before the send interval expires
+		std::atomic<bool> mOpenSessionsSendingRequested;
+
+		/// flag indicating that single sessions shall be sent before the send interval expires
+		std::atomic<bool> mSessionFlushRequested;
+
+		/// ID of the flush requested last
+		int64_t mLastRequestedFlushID;
+
+		/// ID of the flush completed last
+		int64_t mLastCompletedFlushID;
+
 		/// Atomic flag for successful initialization
 		std::atomic<bool> mInitSucceeded;
 
@@ -366,8 +467,8 @@ namespace communication
 		/// timestamp of the last time sync
 		int64_t mLastTimeSyncTime;
 
-		/// container storing all session wrappers
-		core::util::SynchronizedQueue<std::shared_ptr<core::SessionWrapper>> mSessions;
+		/// registry storing all session wrappers partitioned by their state
+		core::SessionRegistry mSessions;
 	};
 }
 #endif
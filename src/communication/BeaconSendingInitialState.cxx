@@ -30,8 +30,6 @@
 #include "protocol/StatusResponse.h"
 using namespace communication;
 
-constexpr uint32_t MAX_INITIAL_STATUS_REQUEST_RETRIES = 5;
-
 const std::vector<std::chrono::milliseconds> BeaconSendingInitialState::REINIT_DELAY_MILLISECONDS =
 {
 	std::chrono::minutes(1),
@@ -41,8 +39,6 @@ const std::vector<std::chrono::milliseconds> BeaconSendingInitialState::REINIT_D
 	std::chrono::hours(2)
 };
 
-const std::chrono::milliseconds BeaconSendingInitialState::INITIAL_RETRY_SLEEP_TIME_MILLISECONDS(std::chrono::seconds(1));
-
 BeaconSendingInitialState::BeaconSendingInitialState()
 	: AbstractBeaconSendingState(AbstractBeaconSendingState::StateType::BEACON_SENDING_INIT_STATE)
 	, mReinitializeDelayIndex(0)
@@ -88,7 +84,8 @@ std::shared_ptr<protocol::StatusResponse> BeaconSendingInitialState::executeStat
 		context.setLastOpenSessionBeaconSendTime(currentTimestamp);
 		context.setLastStatusCheckTime(currentTimestamp);
 
-		statusResponse = BeaconSendingRequestUtil::sendStatusRequest(context, MAX_INITIAL_STATUS_REQUEST_RETRIES, INITIAL_RETRY_SLEEP_TIME_MILLISECONDS.count());
+		auto retryPolicy = context.getConfiguration()->getHTTPClientConfiguration()->getStatusRequestRetryPolicy();
+		statusResponse = BeaconSendingRequestUtil::sendStatusRequest(context, *retryPolicy);
 		if (BeaconSendingResponseUtil::isSuccessfulResponse(statusResponse))
 		{
 			// successful status response was received
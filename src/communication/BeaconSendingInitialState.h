@@ -53,9 +53,6 @@ namespace communication
 
 		virtual const char* getStateName() const override;
 
-		/// The initial delay which is later on doubled between one unsuccessful attempt and the next retry
-		static const std::chrono::milliseconds INITIAL_RETRY_SLEEP_TIME_MILLISECONDS;
-
 		/// Times to use as delay between consecutive re-executions of this state, when no state transition is performed
 		static const std::vector<std::chrono::milliseconds> REINIT_DELAY_MILLISECONDS;
 
@@ -20,10 +20,9 @@
 using namespace communication;
 using namespace protocol;
 
-std::shared_ptr<StatusResponse> BeaconSendingRequestUtil::sendStatusRequest(BeaconSendingContext& context, uint32_t numRetries, uint64_t initialRetryDelayInMillis)
+std::shared_ptr<StatusResponse> BeaconSendingRequestUtil::sendStatusRequest(BeaconSendingContext& context, const RetryPolicy& retryPolicy)
 {
 	std::shared_ptr<StatusResponse> statusResponse = nullptr;
-	uint64_t sleepTimeInMillis = initialRetryDelayInMillis;
 	uint32_t retry = 0;
 
 	while (!context.isShutdownRequested()) 
@@ -37,15 +36,13 @@ std::shared_ptr<StatusResponse> BeaconSendingRequestUtil::sendStatusRequest(Beac
 		statusResponse = httpClient->sendStatusRequest();
 		if (BeaconSendingResponseUtil::isSuccessfulResponse(statusResponse)
 			|| BeaconSendingResponseUtil::isTooManyRequestsResponse(statusResponse) // is handled by the states
-			|| retry >= numRetries)
+			|| !retryPolicy.isRetryAllowed(retry))
 		{
 			break;
 		}
 
-		// if no (valid) status response was received -> sleep and double the delay for each retry
-		context.sleep(sleepTimeInMillis);
-
-		sleepTimeInMillis *= 2;
+		// if no (valid) status response was received -> sleep as long as the retry policy demands
+		context.sleep(retryPolicy.getRetryDelayInMilliseconds(retry, statusResponse));
 		retry++;
 	}
 
@@ -21,6 +21,7 @@
 
 #include "BeaconSendingContext.h"
 #include  "protocol/StatusResponse.h"
+#include "protocol/RetryPolicy.h"
 
 namespace communication
 {
@@ -33,11 +34,12 @@ namespace communication
 
 		///
 		/// Send a status request and capture the response
+		///
+		/// Between two attempts the context sleeps for the delay given by the retry policy, which is interrupted on shutdown.
 		/// @param[in] context the BeaconSendingContext containing HTTPClient and configuration
-		/// @param[in] numRetries number of retries when failing
-		/// @param[in] initialRetryDelayInMillis if retries are necesarry this in the initial time to sleep between two retries, it is doubled every time
+		/// @param[in] retryPolicy policy defining how often and after which delay a failed request is retried
 		///
-		static std::shared_ptr<protocol::StatusResponse> sendStatusRequest(BeaconSendingContext& context, uint32_t numRetries, uint64_t initialRetryDelayInMillis);
+		static std::shared_ptr<protocol::StatusResponse> sendStatusRequest(BeaconSendingContext& context, const protocol::RetryPolicy& retryPolicy);
 
 	private:
 
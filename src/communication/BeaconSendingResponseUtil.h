@@ -45,6 +45,13 @@ namespace communication
 		///
 		static bool isTooManyRequestsResponse(std::shared_ptr<protocol::Response> response);
 
+		///
+		/// Test if the given Response indicates that the request failed on connection level.
+		/// @param response The given response to check whether it is a connection error response or not.
+		/// @return @c true if the server could not be reached, @c false otherwise.
+		///
+		static bool isConnectionErrorResponse(std::shared_ptr<protocol::Response> response);
+
 	private:
 
 		///
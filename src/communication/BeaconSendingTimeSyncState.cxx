@@ -16,7 +16,6 @@
 
 #include "communication/BeaconSendingTimeSyncState.h"
 
-#include <cmath>
 #include <algorithm>
 
 #include "communication/BeaconSendingContext.h"
@@ -31,8 +30,6 @@ using namespace communication;
 
 std::chrono::milliseconds BeaconSendingTimeSyncState::TIME_SYNC_INTERVAL_IN_MILLIS = std::chrono::minutes(1);
 uint32_t BeaconSendingTimeSyncState::REQUIRED_TIME_SYNC_REQUESTS = 5;
-std::chrono::milliseconds BeaconSendingTimeSyncState::INITIAL_RETRY_SLEEP_TIME_MILLISECONDS = std::chrono::seconds(1);
-constexpr uint32_t TIME_SYNC_RETRY_COUNT = 5;
 
 BeaconSendingTimeSyncState::BeaconSendingTimeSyncState()
 	: BeaconSendingTimeSyncState(true)
@@ -116,13 +113,13 @@ void BeaconSendingTimeSyncState::handleTimeSyncResponses(BeaconSendingContext& c
 	// the server does not support time sync at all (e.g. AppMon).
 	//
 	// -> handle this case
-	if (response.mTimeSyncOffsets.size() < REQUIRED_TIME_SYNC_REQUESTS) 
+	if (response.mTimeSyncSamples.size() < REQUIRED_TIME_SYNC_REQUESTS) 
 	{
 		handleErroneousTimeSyncRequest(response.mResponse, context);
 		return;
 	}
 
-	auto calculatedOffset = computeClusterTimeOffset(response.mTimeSyncOffsets);
+	auto calculatedOffset = computeClusterTimeOffset(response.mTimeSyncSamples);
 	if (calculatedOffset < 0)
 	{
 		return;
@@ -138,42 +135,13 @@ void BeaconSendingTimeSyncState::handleTimeSyncResponses(BeaconSendingContext& c
 	setNextState(context);
 }
 
-int64_t BeaconSendingTimeSyncState::computeClusterTimeOffset(std::vector<int64_t>& timeSyncOffsets) 
+int64_t BeaconSendingTimeSyncState::computeClusterTimeOffset(const std::vector<TimeSyncSample>& timeSyncSamples)
 {
-	// time sync requests were successful -> calculate cluster time offset
-	std::sort(timeSyncOffsets.begin(), timeSyncOffsets.end());
+	// time sync requests were successful -> take the offset of the request least affected by network delays
+	auto bestSample = std::min_element(timeSyncSamples.begin(), timeSyncSamples.end(),
+		[](const TimeSyncSample& lhs, const TimeSyncSample& rhs) { return lhs.roundTripTime < rhs.roundTripTime; });
 
-	// take median value from sorted offset list
-	auto median = timeSyncOffsets.at(REQUIRED_TIME_SYNC_REQUESTS / 2);
-
-	// calculate variance from median
-	int64_t medianVariance = 0;
-	for (uint32_t i = 0; i < REQUIRED_TIME_SYNC_REQUESTS; i++)
-	{
-		auto diff = timeSyncOffsets[i] - median;
-		medianVariance += diff * diff;
-	}
-	medianVariance = medianVariance / REQUIRED_TIME_SYNC_REQUESTS;
-
-	// calculate cluster time offset as arithmetic mean of all offsets that are in range of 1x standard deviation
-	int64_t sum = 0;
-	int64_t count = 0;
-	for (uint32_t i = 0; i < REQUIRED_TIME_SYNC_REQUESTS; i++)
-	{
-		auto diff = timeSyncOffsets[i] - median;
-		if (diff * diff <= medianVariance)
-		{
-			sum += timeSyncOffsets[i];
-			count++;
-		}
-	}
-
-	if (count == 0)
-	{ // shouldn't come here under normal circumstances
-		return 0; // prevents div/0
-	}
-
-	return static_cast<int64_t>(std::round(sum / static_cast<double>(count)));
+	return bestSample->offset;
 }
 
 void BeaconSendingTimeSyncState::handleErroneousTimeSyncRequest(std::shared_ptr<protocol::TimeSyncResponse> response,  BeaconSendingContext& context)
@@ -206,15 +174,18 @@ BeaconSendingTimeSyncState::TimeSyncRequestsResponse BeaconSendingTimeSyncState:
 {
 	TimeSyncRequestsResponse response;
 
+	auto retryPolicy = context.getConfiguration()->getHTTPClientConfiguration()->getTimeSyncRequestRetryPolicy();
 	uint32_t retry = 0;
-	int64_t sleepTimeInMillis = INITIAL_RETRY_SLEEP_TIME_MILLISECONDS.count();
+
+	// one client for all requests keeps the connection to the server alive in between
+	auto httpClient = context.getHTTPClient();
 
 	// no check for shutdown here, time sync has to be completed
-	while (response.mTimeSyncOffsets.size() < REQUIRED_TIME_SYNC_REQUESTS && !context.isShutdownRequested())
+	while (response.mTimeSyncSamples.size() < REQUIRED_TIME_SYNC_REQUESTS && !context.isShutdownRequested())
 	{
 		// doExecute time-sync request and take timestamps
 		auto requestSendTime = context.getCurrentTimestamp();
-		auto timeSyncResponse = context.getHTTPClient()->sendTimeSyncRequest();
+		auto timeSyncResponse = httpClient->sendTimeSyncRequest();
 		int64_t responseReceiveTime = context.getCurrentTimestamp();
 
 		if (BeaconSendingResponseUtil::isSuccessfulResponse(timeSyncResponse))
@@ -227,9 +198,9 @@ BeaconSendingTimeSyncState::TimeSyncRequestsResponse BeaconSendingTimeSyncState:
 			{
 				// if yes -> continue time-sync
 				auto offset = ((requestReceiveTime - requestSendTime) + (responseSendTime - responseReceiveTime)) / 2;
-				response.mTimeSyncOffsets.push_back(offset);
-				retry = 0; // on successful response reset the retry count & initial sleep time
-				sleepTimeInMillis = INITIAL_RETRY_SLEEP_TIME_MILLISECONDS.count();
+				auto roundTripTime = (responseReceiveTime - requestSendTime) - (responseSendTime - requestReceiveTime);
+				response.mTimeSyncSamples.push_back({ offset, roundTripTime });
+				retry = 0; // on successful response reset the retry count & thereby the retry delay
 			}
 			else
 			{
@@ -238,7 +209,7 @@ BeaconSendingTimeSyncState::TimeSyncRequestsResponse BeaconSendingTimeSyncState:
 				break;
 			}
 		}
-		else if (retry >= TIME_SYNC_RETRY_COUNT)
+		else if (!retryPolicy->isRetryAllowed(retry))
 		{
 			// retry limits exceeded
 			break;
@@ -247,14 +218,13 @@ BeaconSendingTimeSyncState::TimeSyncRequestsResponse BeaconSendingTimeSyncState:
 		{
 			// special handling for too many requests
 			// clear all time sync offsets captured so far and store the response, which is handled later
-			response.mTimeSyncOffsets.clear();
+			response.mTimeSyncSamples.clear();
 			response.mResponse = timeSyncResponse;
 			break;
 		}
 		else
 		{
-			context.sleep(sleepTimeInMillis);
-			sleepTimeInMillis *= 2;
+			context.sleep(retryPolicy->getRetryDelayInMilliseconds(retry, timeSyncResponse));
 			retry++;
 		}
 	}
@@ -263,8 +233,8 @@ BeaconSendingTimeSyncState::TimeSyncRequestsResponse BeaconSendingTimeSyncState:
 }
 
 BeaconSendingTimeSyncState::TimeSyncRequestsResponse::TimeSyncRequestsResponse()
-	: mTimeSyncOffsets()
+	: mTimeSyncSamples()
 	, mResponse(nullptr)
 {
-	mTimeSyncOffsets.reserve(REQUIRED_TIME_SYNC_REQUESTS);
+	mTimeSyncSamples.reserve(REQUIRED_TIME_SYNC_REQUESTS);
 }
@@ -69,6 +69,18 @@ namespace communication {
 
 	private:
 
+		///
+		/// Result of a single time sync request
+		///
+		struct TimeSyncSample
+		{
+			/// estimated offset between the cluster time and the local time
+			int64_t offset;
+
+			/// round trip time excluding the server's processing time
+			int64_t roundTripTime;
+		};
+
 		///
 		/// Container class storing data for processing requests.
 		///
@@ -83,9 +95,9 @@ namespace communication {
 
 
 			///
-			/// List storing time sync offsets.
+			/// List storing the results of the successful time sync requests.
 			///
-			std::vector<int64_t> mTimeSyncOffsets;
+			std::vector<TimeSyncSample> mTimeSyncSamples;
 
 			///
 			/// TimeSync response which is only stored in case of "too many requests" response, otherwise it's always @c nullptr.
@@ -107,11 +119,14 @@ namespace communication {
 		void handleTimeSyncResponses(BeaconSendingContext& context, TimeSyncRequestsResponse& response);
 
 		///
-		/// Calculates the cluster time offset from the list of time sync offsets 
-		/// @param[in] timeSyncOffsets list of the retrieved offsets
+		/// Calculates the cluster time offset from the list of time sync samples
+		///
+		/// Like NTP's clock filter, the offset of the sample with the smallest round trip time is used,
+		/// since queuing delays make the offset of the other samples less accurate.
+		/// @param[in] timeSyncSamples list of the retrieved samples
 		/// @returns the cluster time offset
 		///
-		int64_t computeClusterTimeOffset(std::vector<int64_t>& timeSyncOffsets);
+		int64_t computeClusterTimeOffset(const std::vector<TimeSyncSample>& timeSyncSamples);
 
 		///
 		/// In case of a erroneous time sync request 
@@ -121,8 +136,11 @@ namespace communication {
 
 		///
 		/// Execute the time synchronisation requests (HTTP requests).
+		///
+		/// All requests are sent back-to-back by the same HTTP client, so that they reuse one connection
+		/// and only the first request pays for the connection setup.
 		/// @param[in] context the @ref BeaconSendingContext used
-		/// @returns a vector of integers with the time sync offsets
+		/// @returns the time sync samples or the erroneous response
 		///
 		TimeSyncRequestsResponse executeTimeSyncRequests(BeaconSendingContext& context);
 
@@ -137,11 +155,6 @@ namespace communication {
 		///
 		static uint32_t REQUIRED_TIME_SYNC_REQUESTS;
 
-		///
-		/// initial retry sleep time
-		///
-		static std::chrono::milliseconds INITIAL_RETRY_SLEEP_TIME_MILLISECONDS;
-
 	private:
 		///
 		/// Flag if this is the first time time sync is performed
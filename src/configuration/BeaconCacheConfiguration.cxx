@@ -25,11 +25,23 @@ using namespace configuration;
 const std::chrono::milliseconds BeaconCacheConfiguration::DEFAULT_MAX_RECORD_AGE_IN_MILLIS = std::chrono::minutes(105);	// 1hour and 45 minutes
 const int64_t BeaconCacheConfiguration::DEFAULT_UPPER_MEMORY_BOUNDARY_IN_BYTES = 100 * 1024 * 1024;			// 100 MiB
 const int64_t BeaconCacheConfiguration::DEFAULT_LOWER_MEMORY_BOUNDARY_IN_BYTES = 80 * 1024 * 1024;			// 80 MiB
+const std::chrono::milliseconds BeaconCacheConfiguration::DEFAULT_EVICTION_NOTIFICATION_INTERVAL_IN_MILLIS = std::chrono::seconds(1);
 
 BeaconCacheConfiguration::BeaconCacheConfiguration(int64_t maxRecordAge, int64_t cacheSizeLowerBound, int64_t cacheSizeUpperBound)
+	: BeaconCacheConfiguration(maxRecordAge, cacheSizeLowerBound, cacheSizeUpperBound,
+		cacheSizeUpperBound,	// the space eviction strategy does not run below the upper bound anyway
+		DEFAULT_EVICTION_NOTIFICATION_INTERVAL_IN_MILLIS.count())
+{
+
+}
+
+BeaconCacheConfiguration::BeaconCacheConfiguration(int64_t maxRecordAge, int64_t cacheSizeLowerBound, int64_t cacheSizeUpperBound,
+	int64_t evictionNotificationThreshold, int64_t evictionNotificationInterval)
 	: mMaxRecordAge(maxRecordAge)
 	, mCacheSizeLowerBound(cacheSizeLowerBound)
 	, mCacheSizeUpperBound(cacheSizeUpperBound)
+	, mEvictionNotificationThreshold(evictionNotificationThreshold)
+	, mEvictionNotificationInterval(evictionNotificationInterval)
 {
 
 }
@@ -47,4 +59,14 @@ int64_t BeaconCacheConfiguration::getCacheSizeLowerBound() const
 int64_t BeaconCacheConfiguration::getCacheSizeUpperBound() const
 {
 	return mCacheSizeUpperBound;
-}
\ No newline at end of file
+}
+
+int64_t BeaconCacheConfiguration::getEvictionNotificationThreshold() const
+{
+	return mEvictionNotificationThreshold;
+}
+
+int64_t BeaconCacheConfiguration::getEvictionNotificationInterval() const
+{
+	return mEvictionNotificationInterval;
+}
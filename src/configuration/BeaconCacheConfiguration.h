@@ -36,6 +36,17 @@ namespace configuration
 		///
 		BeaconCacheConfiguration(int64_t maxRecordAge, int64_t cacheSizeLowerBound, int64_t cacheSizeUpperBound);
 
+		///
+		/// Constructor
+		/// @param[in] maxRecordAge Maximum record age
+		/// @param[in] cacheSizeLowerBound lower memory limit for cache
+		/// @param[in] cacheSizeUpperBound upper memory limit for cache
+		/// @param[in] evictionNotificationThreshold cache size in bytes from which on the evictor is woken up immediately
+		/// @param[in] evictionNotificationInterval interval in milliseconds in which the evictor checks for new data otherwise
+		///
+		BeaconCacheConfiguration(int64_t maxRecordAge, int64_t cacheSizeLowerBound, int64_t cacheSizeUpperBound,
+			int64_t evictionNotificationThreshold, int64_t evictionNotificationInterval);
+
 		///
 		/// Get maximum record age.
 		///
@@ -52,6 +63,16 @@ namespace configuration
 		///
 		int64_t getCacheSizeUpperBound() const;
 
+		///
+		/// Get the cache size in bytes, from which on adding data immediately wakes up the evictor.
+		///
+		int64_t getEvictionNotificationThreshold() const;
+
+		///
+		/// Get the interval in milliseconds, in which the evictor processes data added below the notification threshold.
+		///
+		int64_t getEvictionNotificationInterval() const;
+
 	private:
 		/// maximum record age
 		int64_t mMaxRecordAge;
@@ -62,6 +83,12 @@ namespace configuration
 		/// upper memory limit for the cache
 		int64_t mCacheSizeUpperBound;
 
+		/// cache size from which on the evictor is notified immediately
+		int64_t mEvictionNotificationThreshold;
+
+		/// interval in which the evictor checks for data added below the notification threshold
+		int64_t mEvictionNotificationInterval;
+
 	public:
 	
 		//default value for maximum record age
@@ -72,6 +99,9 @@ namespace configuration
 
 		//default value for lower memory boundary
 		static const int64_t DEFAULT_LOWER_MEMORY_BOUNDARY_IN_BYTES;
+
+		//default value for the eviction notification interval
+		static const std::chrono::milliseconds DEFAULT_EVICTION_NOTIFICATION_INTERVAL_IN_MILLIS;
 	};
 }
 
@@ -28,8 +28,13 @@ constexpr bool DEFAULT_CAPTURE_CRASHES = true;                    // default: ca
 
 Configuration::Configuration(std::shared_ptr<configuration::Device> device, OpenKitType openKitType, const core::UTF8String& applicationName, const core::UTF8String& applicationVersion, const core::UTF8String& applicationID, const core::UTF8String& deviceID, const core::UTF8String& endpointURL,
 	std::shared_ptr<providers::ISessionIDProvider> sessionIDProvider, std::shared_ptr<openkit::ISSLTrustManager> sslTrustManager,
-	std::shared_ptr<configuration::BeaconCacheConfiguration> beaconCacheConfiguration, std::shared_ptr<configuration::BeaconConfiguration> beaconConfiguration)
-	: mHTTPClientConfiguration(std::make_shared<configuration::HTTPClientConfiguration>(endpointURL, openKitType.getDefaultServerID(), applicationID, sslTrustManager))
+	std::shared_ptr<configuration::BeaconCacheConfiguration> beaconCacheConfiguration, std::shared_ptr<configuration::BeaconConfiguration> beaconConfiguration,
+	uint32_t httpClientPoolSize, int64_t httpClientIdleTimeout, uint32_t maxConcurrentBeaconRequests, int64_t newSessionRequestBatchWindow,
+	bool useKernelThreadIDs, std::shared_ptr<const protocol::RetryPolicy> statusRequestRetryPolicy,
+	std::shared_ptr<const protocol::RetryPolicy> timeSyncRequestRetryPolicy, std::shared_ptr<const protocol::RetryPolicy> beaconRequestRetryPolicy)
+	: mHTTPClientConfiguration(std::make_shared<configuration::HTTPClientConfiguration>(endpointURL, openKitType.getDefaultServerID(), applicationID, sslTrustManager,
+		httpClientPoolSize, httpClientIdleTimeout, maxConcurrentBeaconRequests, newSessionRequestBatchWindow,
+		statusRequestRetryPolicy, timeSyncRequestRetryPolicy, beaconRequestRetryPolicy))
 	, mSessionIDProvider(sessionIDProvider)
 	, mIsCapture(false)
 	, mSendInterval(DEFAULT_SEND_INTERVAL)
@@ -45,6 +50,7 @@ Configuration::Configuration(std::shared_ptr<configuration::Device> device, Open
 	, mDevice(device)
 	, mBeaconCacheConfiguration(beaconCacheConfiguration)
 	, mBeaconConfiguration(beaconConfiguration)
+	, mUseKernelThreadIDs(useKernelThreadIDs)
 {
 }
 
@@ -82,7 +88,14 @@ void Configuration::updateSettings(std::shared_ptr<protocol::StatusResponse> sta
 		mHTTPClientConfiguration = std::make_shared<configuration::HTTPClientConfiguration>(mEndpointURL, 
 																							newServerID,
 																							mApplicationID, 
-																							mHTTPClientConfiguration->getSSLTrustManager());
+																							mHTTPClientConfiguration->getSSLTrustManager(),
+																							mHTTPClientConfiguration->getHTTPClientPoolSize(),
+																							mHTTPClientConfiguration->getHTTPClientIdleTimeout(),
+																							mHTTPClientConfiguration->getMaxConcurrentBeaconRequests(),
+																							mHTTPClientConfiguration->getNewSessionRequestBatchWindow(),
+																							mHTTPClientConfiguration->getStatusRequestRetryPolicy(),
+																							mHTTPClientConfiguration->getTimeSyncRequestRetryPolicy(),
+																							mHTTPClientConfiguration->getBeaconRequestRetryPolicy());
 	}
 
 	// use send interval from beacon response or default
@@ -207,4 +220,9 @@ std::shared_ptr<configuration::BeaconCacheConfiguration> Configuration::getBeaco
 std::shared_ptr<configuration::BeaconConfiguration> Configuration::getBeaconConfiguration() const
 {
 	return mBeaconConfiguration;
+}
+
+bool Configuration::isUsingKernelThreadIDs() const
+{
+	return mUseKernelThreadIDs;
 }
\ No newline at end of file
@@ -49,10 +49,26 @@ namespace configuration
 		/// @param[in] sslTrustManager the openkit::ISSLTrustManager instance to use
 		/// @param[in] beaconCacheConfiguration beacon cache configuration
 		/// @param[in] beaconConfiguration beacon configuration
+		/// @param[in] httpClientPoolSize maximum number of idle HTTP connections kept for reuse
+		/// @param[in] httpClientIdleTimeout time in milliseconds after which unused HTTP connections are discarded
+		/// @param[in] maxConcurrentBeaconRequests maximum number of beacon requests sent concurrently
+		/// @param[in] newSessionRequestBatchWindow time in milliseconds a new session request's response is applied to further new sessions
+		/// @param[in] useKernelThreadIDs flag if the operating system's thread IDs are reported instead of hashed thread IDs
+		/// @param[in] statusRequestRetryPolicy retry policy for status requests, @c nullptr to use the default
+		/// @param[in] timeSyncRequestRetryPolicy retry policy for time sync requests, @c nullptr to use the default
+		/// @param[in] beaconRequestRetryPolicy retry policy for beacon requests failing on connection level, @c nullptr to use the default
 		///
 		Configuration(std::shared_ptr<configuration::Device> device, OpenKitType openKitType, const core::UTF8String& applicationName, const core::UTF8String& applicationVersion, const core::UTF8String& applicationID, const core::UTF8String& deviceID, const core::UTF8String& endpointURL,
 			std::shared_ptr<providers::ISessionIDProvider> sessionIDProvider, std::shared_ptr<openkit::ISSLTrustManager> sslTrustManager,
-			std::shared_ptr<configuration::BeaconCacheConfiguration> beaconCacheConfiguration, std::shared_ptr<configuration::BeaconConfiguration> beaconConfiguration);
+			std::shared_ptr<configuration::BeaconCacheConfiguration> beaconCacheConfiguration, std::shared_ptr<configuration::BeaconConfiguration> beaconConfiguration,
+			uint32_t httpClientPoolSize = HTTPClientConfiguration::DEFAULT_HTTP_CLIENT_POOL_SIZE,
+			int64_t httpClientIdleTimeout = HTTPClientConfiguration::DEFAULT_HTTP_CLIENT_IDLE_TIMEOUT_IN_MILLIS,
+			uint32_t maxConcurrentBeaconRequests = HTTPClientConfiguration::DEFAULT_MAX_CONCURRENT_BEACON_REQUESTS,
+			int64_t newSessionRequestBatchWindow = HTTPClientConfiguration::DEFAULT_NEW_SESSION_REQUEST_BATCH_WINDOW_IN_MILLIS,
+			bool useKernelThreadIDs = false,
+			std::shared_ptr<const protocol::RetryPolicy> statusRequestRetryPolicy = nullptr,
+			std::shared_ptr<const protocol::RetryPolicy> timeSyncRequestRetryPolicy = nullptr,
+			std::shared_ptr<const protocol::RetryPolicy> beaconRequestRetryPolicy = nullptr);
 
 		virtual ~Configuration() {}
 
@@ -175,6 +191,12 @@ namespace configuration
 		///
 		std::shared_ptr<configuration::BeaconConfiguration> getBeaconConfiguration() const;
 
+		///
+		/// Returns a flag if the operating system's thread IDs are reported
+		/// @returns @c true if kernel thread IDs are reported, @c false if hashed thread IDs are reported
+		///
+		bool isUsingKernelThreadIDs() const;
+
 	private:
 		/// HTTP client configuration
 		std::shared_ptr<HTTPClientConfiguration> mHTTPClientConfiguration;
@@ -223,6 +245,9 @@ namespace configuration
 
 		/// configuration options for @ref protocol::Beacon
 		std::shared_ptr<configuration::BeaconConfiguration> mBeaconConfiguration;
+
+		/// flag if the operating system's thread IDs are reported
+		bool mUseKernelThreadIDs;
 	};
 }
 
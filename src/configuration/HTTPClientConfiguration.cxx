@@ -18,11 +18,42 @@
 
 using namespace configuration;
 
-HTTPClientConfiguration::HTTPClientConfiguration(const core::UTF8String& url, uint32_t serverID, const core::UTF8String& applicationID, std::shared_ptr<openkit::ISSLTrustManager> sslTrustManager)
+constexpr uint32_t HTTPClientConfiguration::DEFAULT_HTTP_CLIENT_POOL_SIZE;
+constexpr int64_t HTTPClientConfiguration::DEFAULT_HTTP_CLIENT_IDLE_TIMEOUT_IN_MILLIS;
+constexpr uint32_t HTTPClientConfiguration::DEFAULT_MAX_CONCURRENT_BEACON_REQUESTS;
+constexpr int64_t HTTPClientConfiguration::DEFAULT_NEW_SESSION_REQUEST_BATCH_WINDOW_IN_MILLIS;
+constexpr uint32_t HTTPClientConfiguration::DEFAULT_STATUS_REQUEST_MAX_RETRIES;
+constexpr int64_t HTTPClientConfiguration::DEFAULT_STATUS_REQUEST_INITIAL_RETRY_DELAY_IN_MILLIS;
+constexpr int64_t HTTPClientConfiguration::DEFAULT_STATUS_REQUEST_MAX_RETRY_DELAY_IN_MILLIS;
+constexpr uint32_t HTTPClientConfiguration::DEFAULT_TIME_SYNC_REQUEST_MAX_RETRIES;
+constexpr int64_t HTTPClientConfiguration::DEFAULT_TIME_SYNC_REQUEST_INITIAL_RETRY_DELAY_IN_MILLIS;
+constexpr int64_t HTTPClientConfiguration::DEFAULT_TIME_SYNC_REQUEST_MAX_RETRY_DELAY_IN_MILLIS;
+constexpr uint32_t HTTPClientConfiguration::DEFAULT_BEACON_REQUEST_MAX_RETRIES;
+constexpr int64_t HTTPClientConfiguration::DEFAULT_BEACON_REQUEST_INITIAL_RETRY_DELAY_IN_MILLIS;
+constexpr int64_t HTTPClientConfiguration::DEFAULT_BEACON_REQUEST_MAX_RETRY_DELAY_IN_MILLIS;
+
+HTTPClientConfiguration::HTTPClientConfiguration(const core::UTF8String& url, uint32_t serverID, const core::UTF8String& applicationID, std::shared_ptr<openkit::ISSLTrustManager> sslTrustManager,
+	uint32_t httpClientPoolSize, int64_t httpClientIdleTimeout, uint32_t maxConcurrentBeaconRequests, int64_t newSessionRequestBatchWindow,
+	std::shared_ptr<const protocol::RetryPolicy> statusRequestRetryPolicy,
+	std::shared_ptr<const protocol::RetryPolicy> timeSyncRequestRetryPolicy,
+	std::shared_ptr<const protocol::RetryPolicy> beaconRequestRetryPolicy)
 	: mBaseURL(url)
 	, mServerID(serverID)
 	, mApplicationID(applicationID)
 	, mSSLTrustManager(sslTrustManager)
+	, mHTTPClientPoolSize(httpClientPoolSize)
+	, mHTTPClientIdleTimeout(httpClientIdleTimeout)
+	, mMaxConcurrentBeaconRequests(maxConcurrentBeaconRequests)
+	, mNewSessionRequestBatchWindow(newSessionRequestBatchWindow)
+	, mStatusRequestRetryPolicy(statusRequestRetryPolicy != nullptr
+		? statusRequestRetryPolicy
+		: std::make_shared<protocol::RetryPolicy>(DEFAULT_STATUS_REQUEST_MAX_RETRIES, DEFAULT_STATUS_REQUEST_INITIAL_RETRY_DELAY_IN_MILLIS, DEFAULT_STATUS_REQUEST_MAX_RETRY_DELAY_IN_MILLIS))
+	, mTimeSyncRequestRetryPolicy(timeSyncRequestRetryPolicy != nullptr
+		? timeSyncRequestRetryPolicy
+		: std::make_shared<protocol::RetryPolicy>(DEFAULT_TIME_SYNC_REQUEST_MAX_RETRIES, DEFAULT_TIME_SYNC_REQUEST_INITIAL_RETRY_DELAY_IN_MILLIS, DEFAULT_TIME_SYNC_REQUEST_MAX_RETRY_DELAY_IN_MILLIS))
+	, mBeaconRequestRetryPolicy(beaconRequestRetryPolicy != nullptr
+		? beaconRequestRetryPolicy
+		: std::make_shared<protocol::RetryPolicy>(DEFAULT_BEACON_REQUEST_MAX_RETRIES, DEFAULT_BEACON_REQUEST_INITIAL_RETRY_DELAY_IN_MILLIS, DEFAULT_BEACON_REQUEST_MAX_RETRY_DELAY_IN_MILLIS))
 {
 }
 
@@ -46,3 +77,38 @@ std::shared_ptr<openkit::ISSLTrustManager> HTTPClientConfiguration::getSSLTrustM
 	return mSSLTrustManager;
 }
 
+
+uint32_t HTTPClientConfiguration::getHTTPClientPoolSize() const
+{
+	return mHTTPClientPoolSize;
+}
+
+int64_t HTTPClientConfiguration::getHTTPClientIdleTimeout() const
+{
+	return mHTTPClientIdleTimeout;
+}
+
+uint32_t HTTPClientConfiguration::getMaxConcurrentBeaconRequests() const
+{
+	return mMaxConcurrentBeaconRequests;
+}
+
+int64_t HTTPClientConfiguration::getNewSessionRequestBatchWindow() const
+{
+	return mNewSessionRequestBatchWindow;
+}
+
+std::shared_ptr<const protocol::RetryPolicy> HTTPClientConfiguration::getStatusRequestRetryPolicy() const
+{
+	return mStatusRequestRetryPolicy;
+}
+
+std::shared_ptr<const protocol::RetryPolicy> HTTPClientConfiguration::getTimeSyncRequestRetryPolicy() const
+{
+	return mTimeSyncRequestRetryPolicy;
+}
+
+std::shared_ptr<const protocol::RetryPolicy> HTTPClientConfiguration::getBeaconRequestRetryPolicy() const
+{
+	return mBeaconRequestRetryPolicy;
+}
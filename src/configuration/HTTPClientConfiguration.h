@@ -19,9 +19,11 @@
 
 #include "OpenKit/ISSLTrustManager.h"
 
+#include <cstdint>
 #include <memory>
 
 #include "core/UTF8String.h"
+#include "protocol/RetryPolicy.h"
 #include "protocol/ssl/SSLBlindTrustManager.h"
 
 namespace configuration
@@ -38,8 +40,21 @@ namespace configuration
 		/// @param[in] serverID server id
 		/// @param[in] applicationID the application id
 		/// @param[in] sslTrustManager optional
+		/// @param[in] httpClientPoolSize maximum number of idle curl handles kept for reuse
+		/// @param[in] httpClientIdleTimeout time in milliseconds after which unused connections are discarded
+		/// @param[in] maxConcurrentBeaconRequests maximum number of beacon requests sent concurrently
+		/// @param[in] newSessionRequestBatchWindow time in milliseconds a new session request's response is applied to further new sessions
+		/// @param[in] statusRequestRetryPolicy retry policy for status requests, @c nullptr to use the default
+		/// @param[in] timeSyncRequestRetryPolicy retry policy for time sync requests, @c nullptr to use the default
+		/// @param[in] beaconRequestRetryPolicy retry policy for beacon requests failing on connection level, @c nullptr to use the default
 		///
-		HTTPClientConfiguration(const core::UTF8String& url, uint32_t serverID, const core::UTF8String& applicationID, std::shared_ptr<openkit::ISSLTrustManager> sslTrustManager = nullptr);
+		HTTPClientConfiguration(const core::UTF8String& url, uint32_t serverID, const core::UTF8String& applicationID, std::shared_ptr<openkit::ISSLTrustManager> sslTrustManager = nullptr,
+			uint32_t httpClientPoolSize = DEFAULT_HTTP_CLIENT_POOL_SIZE, int64_t httpClientIdleTimeout = DEFAULT_HTTP_CLIENT_IDLE_TIMEOUT_IN_MILLIS,
+			uint32_t maxConcurrentBeaconRequests = DEFAULT_MAX_CONCURRENT_BEACON_REQUESTS,
+			int64_t newSessionRequestBatchWindow = DEFAULT_NEW_SESSION_REQUEST_BATCH_WINDOW_IN_MILLIS,
+			std::shared_ptr<const protocol::RetryPolicy> statusRequestRetryPolicy = nullptr,
+			std::shared_ptr<const protocol::RetryPolicy> timeSyncRequestRetryPolicy = nullptr,
+			std::shared_ptr<const protocol::RetryPolicy> beaconRequestRetryPolicy = nullptr);
 
 		///
 		/// Returns the base url for the http client
@@ -65,6 +80,87 @@ namespace configuration
 		///
 		std::shared_ptr<openkit::ISSLTrustManager> getSSLTrustManager() const;
 
+		///
+		/// Returns the maximum number of idle curl handles kept for reuse
+		/// @returns the maximum number of idle curl handles kept for reuse
+		///
+		uint32_t getHTTPClientPoolSize() const;
+
+		///
+		/// Returns the time in milliseconds after which unused connections are discarded
+		/// @returns the time in milliseconds after which unused connections are discarded
+		///
+		int64_t getHTTPClientIdleTimeout() const;
+
+		///
+		/// Returns the maximum number of beacon requests sent concurrently
+		/// @returns the maximum number of beacon requests sent concurrently
+		///
+		uint32_t getMaxConcurrentBeaconRequests() const;
+
+		///
+		/// Returns the time in milliseconds a new session request's response is applied to further new sessions
+		/// @returns the time in milliseconds a new session request's response is applied to further new sessions
+		///
+		int64_t getNewSessionRequestBatchWindow() const;
+
+		///
+		/// Returns the retry policy for status requests
+		/// @returns the retry policy for status requests
+		///
+		std::shared_ptr<const protocol::RetryPolicy> getStatusRequestRetryPolicy() const;
+
+		///
+		/// Returns the retry policy for time sync requests
+		/// @returns the retry policy for time sync requests
+		///
+		std::shared_ptr<const protocol::RetryPolicy> getTimeSyncRequestRetryPolicy() const;
+
+		///
+		/// Returns the retry policy for beacon requests, which failed on connection level
+		/// @returns the retry policy for beacon requests
+		///
+		std::shared_ptr<const protocol::RetryPolicy> getBeaconRequestRetryPolicy() const;
+
+		/// default value for the maximum number of idle curl handles
+		static constexpr uint32_t DEFAULT_HTTP_CLIENT_POOL_SIZE = 4;
+
+		/// default value for the time after which unused connections are discarded
+		static constexpr int64_t DEFAULT_HTTP_CLIENT_IDLE_TIMEOUT_IN_MILLIS = 60 * 1000;
+
+		/// default value for the maximum number of beacon requests sent concurrently
+		static constexpr uint32_t DEFAULT_MAX_CONCURRENT_BEACON_REQUESTS = 4;
+
+		/// default value for the new session request batch window, where 0 sends one request per new session
+		static constexpr int64_t DEFAULT_NEW_SESSION_REQUEST_BATCH_WINDOW_IN_MILLIS = 0;
+
+		/// default number of retries of a status request
+		static constexpr uint32_t DEFAULT_STATUS_REQUEST_MAX_RETRIES = 5;
+
+		/// default delay before the first retry of a status request
+		static constexpr int64_t DEFAULT_STATUS_REQUEST_INITIAL_RETRY_DELAY_IN_MILLIS = 1000;
+
+		/// default upper bound for the delay between two status requests
+		static constexpr int64_t DEFAULT_STATUS_REQUEST_MAX_RETRY_DELAY_IN_MILLIS = 30 * 1000;
+
+		/// default number of retries of a time sync request
+		static constexpr uint32_t DEFAULT_TIME_SYNC_REQUEST_MAX_RETRIES = 5;
+
+		/// default delay before the first retry of a time sync request
+		static constexpr int64_t DEFAULT_TIME_SYNC_REQUEST_INITIAL_RETRY_DELAY_IN_MILLIS = 1000;
+
+		/// default upper bound for the delay between two time sync requests
+		static constexpr int64_t DEFAULT_TIME_SYNC_REQUEST_MAX_RETRY_DELAY_IN_MILLIS = 30 * 1000;
+
+		/// default number of retries of a beacon request failing on connection level
+		static constexpr uint32_t DEFAULT_BEACON_REQUEST_MAX_RETRIES = 2;
+
+		/// default delay before the first retry of a beacon request
+		static constexpr int64_t DEFAULT_BEACON_REQUEST_INITIAL_RETRY_DELAY_IN_MILLIS = 200;
+
+		/// default upper bound for the delay between two attempts of a beacon request
+		static constexpr int64_t DEFAULT_BEACON_REQUEST_MAX_RETRY_DELAY_IN_MILLIS = 2 * 1000;
+
 	private:
 		/// the beacon URL
 		const core::UTF8String mBaseURL;
@@ -77,6 +173,27 @@ namespace configuration
 
 		/// how the peer's TSL/SSL certificate and the hostname shall be trusted
 		std::shared_ptr<openkit::ISSLTrustManager> mSSLTrustManager;
+
+		/// maximum number of idle curl handles kept for reuse
+		uint32_t mHTTPClientPoolSize;
+
+		/// time in milliseconds after which unused connections are discarded
+		int64_t mHTTPClientIdleTimeout;
+
+		/// maximum number of beacon requests sent concurrently
+		uint32_t mMaxConcurrentBeaconRequests;
+
+		/// time in milliseconds a new session request's response is applied to further new sessions
+		int64_t mNewSessionRequestBatchWindow;
+
+		/// retry policy for status requests
+		std::shared_ptr<const protocol::RetryPolicy> mStatusRequestRetryPolicy;
+
+		/// retry policy for time sync requests
+		std::shared_ptr<const protocol::RetryPolicy> mTimeSyncRequestRetryPolicy;
+
+		/// retry policy for beacon requests
+		std::shared_ptr<const protocol::RetryPolicy> mBeaconRequestRetryPolicy;
 	};
 
 }
@@ -16,6 +16,7 @@
 
 #include "ActionCommonImpl.h"
 #include "core/UTF8String.h"
+#include "core/UTF8StringView.h"
 #include "protocol/Beacon.h"
 #include "core/WebRequestTracerStringURL.h"
 
@@ -32,7 +33,8 @@ ActionCommonImpl::ActionCommonImpl(std::shared_ptr<openkit::ILogger> logger, std
 
 void ActionCommonImpl::reportEvent(const char* eventName)
 {
-	UTF8String eventNameString(eventName);
+	UTF8String eventNameStorage;
+	UTF8StringView eventNameString = UTF8StringView::validate(eventName, eventNameStorage);
 	if (eventNameString.empty())
 	{
 		mLogger->warning("%s reportEvent: eventName must not be null or empty", mObjectID.c_str());
@@ -48,7 +50,8 @@ void ActionCommonImpl::reportEvent(const char* eventName)
 
 void ActionCommonImpl::reportValue(const char* valueName, int32_t value)
 {
-	UTF8String valueNameString(valueName);
+	UTF8String valueNameStorage;
+	UTF8StringView valueNameString = UTF8StringView::validate(valueName, valueNameStorage);
 	if (valueNameString.empty())
 	{
 		mLogger->warning("%s reportValue (int): valueName must not be null or empty", mObjectID.c_str());
@@ -65,7 +68,8 @@ void ActionCommonImpl::reportValue(const char* valueName, int32_t value)
 
 void ActionCommonImpl::reportValue(const char* valueName, double value)
 {
-	UTF8String valueNameString(valueName);
+	UTF8String valueNameStorage;
+	UTF8StringView valueNameString = UTF8StringView::validate(valueName, valueNameStorage);
 	if (valueNameString.empty())
 	{
 		mLogger->warning("%s reportValue (double): valueName must not be null or empty", mObjectID.c_str());
@@ -81,7 +85,8 @@ void ActionCommonImpl::reportValue(const char* valueName, double value)
 
 void ActionCommonImpl::reportValue(const char* valueName, const char* value)
 {
-	UTF8String valueNameString(valueName);
+	UTF8String valueNameStorage;
+	UTF8StringView valueNameString = UTF8StringView::validate(valueName, valueNameStorage);
 	if (valueNameString.empty())
 	{
 		mLogger->warning("%s reportValue (string): valueName must not be null or empty", mObjectID.c_str());
@@ -92,14 +97,17 @@ void ActionCommonImpl::reportValue(const char* valueName, const char* value)
 		mLogger->debug("%s reportValue (string) (%s, %s))", mObjectID.c_str(), valueName, (value != nullptr ? value : "null"));
 	}
 
-	mBeacon->reportValue(mActionID, valueNameString, value);
+	UTF8String valueStorage;
+	mBeacon->reportValue(mActionID, valueNameString, UTF8StringView::validate(value, valueStorage));
 }
 
 
 void ActionCommonImpl::reportError(const char* errorName, int32_t errorCode, const char* reason)
 {
-	UTF8String errorNameString(errorName);
-	UTF8String reasonString(reason);
+	UTF8String errorNameStorage;
+	UTF8StringView errorNameString = UTF8StringView::validate(errorName, errorNameStorage);
+	UTF8String reasonStorage;
+	UTF8StringView reasonString = UTF8StringView::validate(reason, reasonStorage);
 	if (errorNameString.empty())
 	{
 		mLogger->warning("%s reportError: errorName must not be null or empty", mObjectID.c_str());
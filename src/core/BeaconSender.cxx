@@ -38,6 +38,9 @@ BeaconSender::BeaconSender(std::shared_ptr<openkit::ILogger> logger,
 	, mSendingThread()
 	, mShutdownTrigger(false)
 	, mTimingProvider(timingProvider)
+	, mBeaconCache(nullptr)
+	, mSendThreshold(0)
+	, mSendThresholdExceeded(false)
 {
 
 }
@@ -125,3 +128,50 @@ void BeaconSender::finishSession(std::shared_ptr<Session> session)
 	}
 	mBeaconSendingContext->finishSession(session);
 }
+
+void BeaconSender::flushSession(std::shared_ptr<Session> session)
+{
+	if (mLogger->isDebugEnabled())
+	{
+		mLogger->debug("BeaconSender flushSession");
+	}
+	mBeaconSendingContext->flushSession(session);
+}
+
+bool BeaconSender::flush(int64_t timeoutMillis)
+{
+	if (mLogger->isDebugEnabled())
+	{
+		mLogger->debug("BeaconSender flush");
+	}
+	auto flushID = mBeaconSendingContext->requestFlush();
+	return mBeaconSendingContext->waitForFlush(flushID, timeoutMillis);
+}
+
+void BeaconSender::observeBeaconCache(std::shared_ptr<caching::IBeaconCache> beaconCache, int64_t sendThreshold)
+{
+	mBeaconCache = beaconCache;
+	mSendThreshold = sendThreshold;
+	mBeaconCache->addObserver(this);
+}
+
+void BeaconSender::update()
+{
+	if (mBeaconCache->getNumBytesInCache() < mSendThreshold)
+	{
+		// only write the shared flag if it's set, to avoid cache line ping-pong between reporting threads
+		if (mSendThresholdExceeded.load(std::memory_order_relaxed))
+		{
+			mSendThresholdExceeded.store(false);
+		}
+		return;
+	}
+
+	if (mSendThresholdExceeded.load(std::memory_order_relaxed) || mSendThresholdExceeded.exchange(true))
+	{
+		// early sending was already requested, since the threshold was exceeded
+		return;
+	}
+
+	mBeaconSendingContext->requestOpenSessionsSending();
+}
@@ -19,7 +19,10 @@
 
 #include <memory>
 #include <future>
+#include <atomic>
 
+#include "caching/IBeaconCache.h"
+#include "caching/IObserver.h"
 #include "communication/BeaconSendingContext.h"
 #include "configuration/Configuration.h"
 #include "providers/IHTTPClientProvider.h"
@@ -32,7 +35,7 @@ namespace core
 	///
 	/// The BeaconSender runs a thread executing the beacon sending states
 	///
-	class BeaconSender
+	class BeaconSender : caching::IObserver
 	{
 	public:
 		///
@@ -96,7 +99,35 @@ namespace core
 		///
 		virtual void finishSession(std::shared_ptr<Session> session);
 
+		///
+		/// Send the data of the given open Session without waiting for the send interval to expire.
+		/// This method does not block.
+		/// @param[in] session Session to send
+		///
+		virtual void flushSession(std::shared_ptr<Session> session);
+
+		///
+		/// Send the data of all Sessions without waiting for the send interval to expire.
+		/// NOTE: this is a blocking operation
+		/// @param[in] timeoutMillis The maximum number of milliseconds to wait for the data being sent.
+		/// @return @c true if all data was sent, @c false if shutdown was requested or timeout occured
+		///
+		bool flush(int64_t timeoutMillis);
+
+		///
+		/// Observe the given beacon cache and send the data of open sessions without waiting for the send interval,
+		/// once the cache size reaches the given threshold.
+		/// @param[in] beaconCache the beacon cache to observe
+		/// @param[in] sendThreshold cache size in bytes from which on open sessions are sent early
+		///
+		void observeBeaconCache(std::shared_ptr<caching::IBeaconCache> beaconCache, int64_t sendThreshold);
+
 	private:
+		///
+		/// Called by the observed beacon cache, whenever data was added.
+		///
+		virtual void update() override;
+
 		/// Logger to write traces to
 		std::shared_ptr<openkit::ILogger> mLogger;
 
@@ -111,6 +142,15 @@ namespace core
 
 		/// timing provider for shutdown timeout
 		std::shared_ptr<providers::ITimingProvider> mTimingProvider;
+
+		/// the observed beacon cache or @c nullptr
+		std::shared_ptr<caching::IBeaconCache> mBeaconCache;
+
+		/// cache size in bytes from which on open sessions are sent early
+		int64_t mSendThreshold;
+
+		/// flag indicating that the send threshold was exceeded and early sending was already requested
+		std::atomic<bool> mSendThresholdExceeded;
 	};
 }
 #endif
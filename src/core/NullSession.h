@@ -62,6 +62,11 @@ namespace core
 			return std::make_shared<NullWebRequestTracer>();
 		}
 
+		virtual void flush() override
+		{
+			// intentionally left empty, due to NullObject pattern
+		}
+
 		virtual void end() override
 		{
 			// intentionally left empty, due to NullObject pattern
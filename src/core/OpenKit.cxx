@@ -19,6 +19,7 @@
 #include "providers/DefaultHTTPClientProvider.h"
 #include "providers/DefaultTimingProvider.h"
 #include "providers/DefaultThreadIDProvider.h"
+#include "providers/DefaultPRNGenerator.h"
 #include "caching/BeaconCache.h"
 
 #include <inttypes.h> // for PRId64 macro
@@ -33,7 +34,7 @@ OpenKit::OpenKit(std::shared_ptr<openkit::ILogger> logger, std::shared_ptr<confi
 	: OpenKit(logger, configuration,
 		std::make_shared<providers::DefaultHTTPClientProvider>(),
 		std::make_shared<providers::DefaultTimingProvider>(),
-		std::make_shared<providers::DefaultThreadIDProvider>()
+		std::make_shared<providers::DefaultThreadIDProvider>(configuration->isUsingKernelThreadIDs())
 	)
 {
 
@@ -51,6 +52,8 @@ OpenKit::OpenKit(std::shared_ptr<openkit::ILogger> logger, std::shared_ptr<confi
 	, mBeaconCache(std::make_shared<caching::BeaconCache>(logger))
 	, mBeaconSender(std::make_shared<core::BeaconSender>(logger, configuration, httpClientProvider, timingProvider))
 	, mBeaconCacheEvictor(std::make_shared<caching::BeaconCacheEvictor>(logger, mBeaconCache, configuration->getBeaconCacheConfiguration(), timingProvider))
+	, mImmutableBeaconData(std::make_shared<protocol::ImmutableBeaconData>(configuration))
+	, mRandomGenerator(std::make_shared<providers::DefaultPRNGenerator>())
 	, mIsShutdown(0)
 	, NULL_SESSION(std::make_shared<core::NullSession>())
 {
@@ -79,6 +82,13 @@ OpenKit::~OpenKit()
 void OpenKit::initialize()
 {
 	mBeaconCacheEvictor->start();
+
+	// send open sessions before the cache grows into the range where data gets evicted
+	auto cacheSizeLowerBound = mConfiguration->getBeaconCacheConfiguration()->getCacheSizeLowerBound();
+	if (cacheSizeLowerBound > 0)
+	{
+		mBeaconSender->observeBeaconCache(mBeaconCache, cacheSizeLowerBound);
+	}
 	mBeaconSender->initialize();
 }
 
@@ -108,12 +118,27 @@ std::shared_ptr<openkit::ISession> OpenKit::createSession(const char* clientIPAd
 		return NULL_SESSION;
 	}
 
-	std::shared_ptr<protocol::Beacon> beacon = std::make_shared<protocol::Beacon>(mLogger, mBeaconCache, mConfiguration, clientIPAddress, mThreadIDProvider, mTimingProvider);
+	std::shared_ptr<protocol::Beacon> beacon = std::make_shared<protocol::Beacon>(mLogger, mBeaconCache, mConfiguration, clientIPAddress, mThreadIDProvider, mTimingProvider,
+		mRandomGenerator, mImmutableBeaconData);
 	auto newSession = std::make_shared<core::Session>(mLogger, mBeaconSender, beacon);
 	newSession->startSession();
 	return newSession;
 }
 
+bool OpenKit::flush(int64_t timeoutMillis)
+{
+	if (mLogger->isDebugEnabled())
+	{
+		mLogger->debug("OpenKit flush(%" PRId64 ")", timeoutMillis);
+	}
+	if (mIsShutdown)
+	{
+		return false;
+	}
+
+	return mBeaconSender->flush(timeoutMillis);
+}
+
 void OpenKit::shutdown()
 {
 	if (mLogger->isDebugEnabled())
@@ -25,10 +25,12 @@
 #include "providers/IHTTPClientProvider.h"
 #include "providers/ITimingProvider.h"
 #include "providers/IThreadIDProvider.h"
+#include "providers/IPRNGenerator.h"
 #include "caching/IBeaconCache.h"
 #include "caching/BeaconCacheEvictor.h"
 #include "core/BeaconSender.h"
 #include "core/NullSession.h"
+#include "protocol/ImmutableBeaconData.h"
 
 #include <mutex>
 
@@ -78,6 +80,8 @@ namespace core
 
 		virtual std::shared_ptr<openkit::ISession> createSession(const char* clientIPAddress) override;
 
+		virtual bool flush(int64_t timeoutMillis) override;
+
 		virtual void shutdown() override;
 
 	private:
@@ -120,6 +124,12 @@ namespace core
 		/// beacon cache evictor
 		std::shared_ptr<caching::BeaconCacheEvictor> mBeaconCacheEvictor;
 
+		/// basic beacon data shared by all sessions
+		std::shared_ptr<const protocol::ImmutableBeaconData> mImmutableBeaconData;
+
+		/// random number generator shared by all sessions
+		std::shared_ptr<providers::IPRNGenerator> mRandomGenerator;
+
 		/// atomic flag for shutdown state
 		std::atomic<int32_t> mIsShutdown;
 
@@ -20,6 +20,7 @@
 #include "Action.h"
 #include "RootAction.h"
 #include "WebRequestTracerStringURL.h"
+#include "UTF8StringView.h"
 
 #include <sstream>
 
@@ -34,6 +35,8 @@ Session::Session(std::shared_ptr<openkit::ILogger> logger, std::shared_ptr<Beaco
 	, mEndTime(-1)
 	, mOpenRootActions()
 	, NULL_ROOT_ACTION(std::make_shared<NullRootAction>())
+	, mSessionWrapper()
+	, mSessionWrapperMutex()
 {
 
 }
@@ -68,7 +71,8 @@ std::shared_ptr<openkit::IRootAction> Session::enterAction(const char* actionNam
 
 void Session::identifyUser(const char* userTag)
 {
-	UTF8String userTagString(userTag);
+	UTF8String userTagStorage;
+	UTF8StringView userTagString = UTF8StringView::validate(userTag, userTagStorage);
 
 	if (userTag == nullptr || userTagString.empty())
 	{
@@ -88,7 +92,8 @@ void Session::identifyUser(const char* userTag)
 
 void Session::reportCrash(const char* errorName, const char* reason, const char* stacktrace)
 {
-	UTF8String errorNameString(errorName);
+	UTF8String errorNameStorage;
+	UTF8StringView errorNameString = UTF8StringView::validate(errorName, errorNameStorage);
 
 	if (errorName == nullptr || errorNameString.empty())
 	{
@@ -102,7 +107,9 @@ void Session::reportCrash(const char* errorName, const char* reason, const char*
 
 	if (!isSessionEnded())
 	{
-		mBeacon->reportCrash(errorNameString, UTF8String(reason), UTF8String(stacktrace));
+		UTF8String reasonStorage;
+		UTF8String stacktraceStorage;
+		mBeacon->reportCrash(errorNameString, UTF8StringView::validate(reason, reasonStorage), UTF8StringView::validate(stacktrace, stacktraceStorage));
 	}
 }
 
@@ -131,6 +138,21 @@ std::shared_ptr<openkit::IWebRequestTracer> Session::traceWebRequest(const char*
 	return NULL_WEB_REQUEST_TRACER;
 }
 
+void Session::flush()
+{
+	if (mLogger->isDebugEnabled())
+	{
+		mLogger->debug("%s flush()", toString().c_str());
+	}
+	if (isSessionEnded())
+	{
+		// ended sessions are sent immediately anyway
+		return;
+	}
+
+	mBeaconSender->flushSession(shared_from_this());
+}
+
 void Session::end()
 {
 	if (mLogger->isDebugEnabled())
@@ -174,6 +196,16 @@ std::shared_ptr<protocol::StatusResponse> Session::sendBeacon(std::shared_ptr<pr
 	return mBeacon->send(clientProvider);
 }
 
+protocol::IHTTPMultiClient::RequestID Session::sendNextBeaconChunk(std::shared_ptr<protocol::IHTTPMultiClient> multiClient)
+{
+	return mBeacon->sendNextChunk(multiClient);
+}
+
+bool Session::handleBeaconChunkResponse(std::shared_ptr<protocol::StatusResponse> response)
+{
+	return mBeacon->handleChunkResponse(response);
+}
+
 bool Session::isEmpty() const
 {
 	return mBeacon->isEmpty();
@@ -184,6 +216,18 @@ void Session::clearCapturedData()
 	mBeacon->clearData();
 }
 
+void Session::setSessionWrapper(std::weak_ptr<SessionWrapper> sessionWrapper)
+{
+	std::lock_guard<std::mutex> lock(mSessionWrapperMutex);
+	mSessionWrapper = sessionWrapper;
+}
+
+std::shared_ptr<SessionWrapper> Session::getSessionWrapper() const
+{
+	std::lock_guard<std::mutex> lock(mSessionWrapperMutex);
+	return mSessionWrapper.lock();
+}
+
 const std::string Session::toString() const
 {
 	std::stringstream ss;
@@ -35,6 +35,7 @@
 
 #include <memory>
 #include <atomic>
+#include <mutex>
 
 namespace protocol
 {
@@ -47,6 +48,8 @@ namespace core
 
 	class RootAction;
 
+	class SessionWrapper;
+
 	///
 	///  Actual implementation of the ISession interface.
 	///
@@ -75,6 +78,8 @@ namespace core
 
 		virtual std::shared_ptr<openkit::IWebRequestTracer> traceWebRequest(const char* url) override;
 
+		virtual void flush() override;
+
 		virtual void end() override;
 
 		///
@@ -102,6 +107,20 @@ namespace core
 		///
 		virtual std::shared_ptr<protocol::StatusResponse> sendBeacon(std::shared_ptr<providers::IHTTPClientProvider> clientProvider);
 
+		///
+		/// Start sending the next chunk of the current Beacon state
+		/// @param[in] multiClient the client used for sending the chunk
+		/// @returns the ID of the request or @ref protocol::IHTTPMultiClient::INVALID_REQUEST_ID if there is no more data
+		///
+		virtual protocol::IHTTPMultiClient::RequestID sendNextBeaconChunk(std::shared_ptr<protocol::IHTTPMultiClient> multiClient);
+
+		///
+		/// Handle the response received for the Beacon chunk sent last
+		/// @param[in] response the response received or @c nullptr if sending was aborted
+		/// @returns @c true if the chunk was sent successfully, @c false otherwise
+		///
+		virtual bool handleBeaconChunkResponse(std::shared_ptr<protocol::StatusResponse> response);
+
 		///
 		/// Test if this session is empty or not
 		///
@@ -136,6 +155,18 @@ namespace core
 		///
 		virtual std::shared_ptr<configuration::BeaconConfiguration> getBeaconConfiguration() const;
 
+		///
+		/// Set the wrapper representing this session in the beacon sending thread's session registry
+		/// @param[in] sessionWrapper the session's wrapper
+		///
+		void setSessionWrapper(std::weak_ptr<SessionWrapper> sessionWrapper);
+
+		///
+		/// Get the wrapper representing this session in the beacon sending thread's session registry
+		/// @returns the session's wrapper or @c nullptr if the session was not registered
+		///
+		std::shared_ptr<SessionWrapper> getSessionWrapper() const;
+
 	private:
 		///
 		/// Returns a string describing the object, based on some important fields.
@@ -164,6 +195,12 @@ namespace core
 
 		/// Null WebRequestTracer
 		static std::shared_ptr<NullWebRequestTracer> NULL_WEB_REQUEST_TRACER;
+
+		/// back-reference to the wrapper of this session, not owning it to avoid a reference cycle
+		std::weak_ptr<SessionWrapper> mSessionWrapper;
+
+		/// mutex guarding mSessionWrapper
+		mutable std::mutex mSessionWrapperMutex;
 	};
 }
 
@@ -0,0 +1,152 @@
+/**
+* Copyright 2018 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#include "SessionRegistry.h"
+#include "SessionWrapper.h"
+
+using namespace core;
+
+SessionRegistry::SessionRegistry()
+	: mMutex()
+	, mNewSessions()
+	, mOpenSessions()
+	, mFinishedSessions()
+{
+}
+
+SessionRegistry::~SessionRegistry()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	detach(mNewSessions);
+	detach(mOpenSessions);
+	detach(mFinishedSessions);
+}
+
+void SessionRegistry::add(std::shared_ptr<SessionWrapper> sessionWrapper)
+{
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mNewSessions.push_back(sessionWrapper);
+		sessionWrapper->mRegistryList = &mNewSessions;
+		sessionWrapper->mRegistryPosition = std::prev(mNewSessions.end());
+		sessionWrapper->mRegistry = this;
+	}
+	sessionWrapper->getWrappedSession()->setSessionWrapper(sessionWrapper);
+
+	// the session might have been configured or finished before it was registered
+	if (sessionWrapper->isBeaconConfigurationSet())
+	{
+		onBeaconConfigurationSet(*sessionWrapper);
+	}
+}
+
+bool SessionRegistry::remove(std::shared_ptr<SessionWrapper> sessionWrapper)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	if (sessionWrapper->mRegistry != this || sessionWrapper->mRegistryList == nullptr)
+	{
+		return false;
+	}
+
+	// keep the wrapper alive until it is detached, the list might hold the last reference
+	auto keepAlive = sessionWrapper;
+	sessionWrapper->mRegistryList->erase(sessionWrapper->mRegistryPosition);
+	sessionWrapper->mRegistryList = nullptr;
+	sessionWrapper->mRegistry = nullptr;
+	return true;
+}
+
+std::shared_ptr<SessionWrapper> SessionRegistry::find(std::shared_ptr<Session> session) const
+{
+	auto sessionWrapper = session->getSessionWrapper();
+	if (sessionWrapper == nullptr)
+	{
+		return nullptr;
+	}
+
+	std::lock_guard<std::mutex> lock(mMutex);
+	if (sessionWrapper->mRegistry != this || sessionWrapper->mRegistryList == nullptr)
+	{
+		return nullptr;
+	}
+	return sessionWrapper;
+}
+
+std::vector<std::shared_ptr<SessionWrapper>> SessionRegistry::getNewSessions() const
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	return std::vector<std::shared_ptr<SessionWrapper>>(mNewSessions.begin(), mNewSessions.end());
+}
+
+std::vector<std::shared_ptr<SessionWrapper>> SessionRegistry::getOpenAndConfiguredSessions() const
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	return std::vector<std::shared_ptr<SessionWrapper>>(mOpenSessions.begin(), mOpenSessions.end());
+}
+
+std::vector<std::shared_ptr<SessionWrapper>> SessionRegistry::getFinishedAndConfiguredSessions() const
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	return std::vector<std::shared_ptr<SessionWrapper>>(mFinishedSessions.begin(), mFinishedSessions.end());
+}
+
+std::vector<std::shared_ptr<SessionWrapper>> SessionRegistry::getAllSessions() const
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	std::vector<std::shared_ptr<SessionWrapper>> sessions;
+	sessions.reserve(mNewSessions.size() + mOpenSessions.size() + mFinishedSessions.size());
+	sessions.insert(sessions.end(), mNewSessions.begin(), mNewSessions.end());
+	sessions.insert(sessions.end(), mOpenSessions.begin(), mOpenSessions.end());
+	sessions.insert(sessions.end(), mFinishedSessions.begin(), mFinishedSessions.end());
+	return sessions;
+}
+
+void SessionRegistry::onBeaconConfigurationSet(SessionWrapper& sessionWrapper)
+{
+	// the state flags are set before the lock is taken, therefore the last transition sees both of them
+	std::lock_guard<std::mutex> lock(mMutex);
+	if (sessionWrapper.mRegistryList == &mNewSessions)
+	{
+		moveTo(sessionWrapper, sessionWrapper.isSessionFinished() ? mFinishedSessions : mOpenSessions);
+	}
+}
+
+void SessionRegistry::onSessionFinished(SessionWrapper& sessionWrapper)
+{
+	// new sessions stay new until they are configured
+	std::lock_guard<std::mutex> lock(mMutex);
+	if (sessionWrapper.mRegistryList == &mOpenSessions)
+	{
+		moveTo(sessionWrapper, mFinishedSessions);
+	}
+}
+
+void SessionRegistry::moveTo(SessionWrapper& sessionWrapper, SessionList& targetList)
+{
+	// splicing keeps the iterator valid, it now refers to the element within the target list
+	targetList.splice(targetList.end(), *sessionWrapper.mRegistryList, sessionWrapper.mRegistryPosition);
+	sessionWrapper.mRegistryList = &targetList;
+}
+
+void SessionRegistry::detach(SessionList& sessionList)
+{
+	for (auto& sessionWrapper : sessionList)
+	{
+		sessionWrapper->mRegistryList = nullptr;
+		sessionWrapper->mRegistry = nullptr;
+	}
+}
@@ -0,0 +1,147 @@
+/**
+* Copyright 2018 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#ifndef _CORE_SESSIONREGISTRY_H
+#define _CORE_SESSIONREGISTRY_H
+
+#include "Session.h"
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace core
+{
+	class SessionWrapper;
+
+	///
+	/// Registry of the sessions known to the beacon sending thread, partitioned by their sending state.
+	///
+	/// Each session is kept in exactly one of three lists: new sessions, which have not been configured by the server yet,
+	/// open and configured sessions and finished and configured sessions. A @ref SessionWrapper remembers its position,
+	/// so that moving it to another list when it is configured or finished, as well as removing it, takes constant time.
+	/// Retrieving the sessions of one state only copies that state's list.
+	///
+	/// This class is thread safe.
+	///
+	class SessionRegistry
+	{
+	public:
+		///
+		/// Default constructor
+		///
+		SessionRegistry();
+
+		///
+		/// Destructor, detaching all registered session wrappers
+		///
+		~SessionRegistry();
+
+		SessionRegistry(const SessionRegistry&) = delete;
+		SessionRegistry& operator=(const SessionRegistry&) = delete;
+
+		///
+		/// Register a session wrapper as new session.
+		///
+		/// The wrapped session gets a back-reference to the wrapper, which is used by @ref find.
+		/// A session wrapper can be registered only once.
+		/// @param[in] sessionWrapper the session wrapper to register
+		///
+		void add(std::shared_ptr<SessionWrapper> sessionWrapper);
+
+		///
+		/// Remove a session wrapper from the registry
+		/// @param[in] sessionWrapper the session wrapper to remove
+		/// @returns @c true if the session wrapper was registered and has been removed, @c false otherwise
+		///
+		bool remove(std::shared_ptr<SessionWrapper> sessionWrapper);
+
+		///
+		/// Get the registered wrapper of the given session
+		/// @param[in] session the session to look up
+		/// @returns the wrapper of the given session or @c nullptr if the session is not registered
+		///
+		std::shared_ptr<SessionWrapper> find(std::shared_ptr<Session> session) const;
+
+		///
+		/// Get all sessions, which have not been configured yet, in the order they were added
+		/// @returns the new sessions
+		///
+		std::vector<std::shared_ptr<SessionWrapper>> getNewSessions() const;
+
+		///
+		/// Get all configured sessions, which are not finished yet
+		/// @returns the open and configured sessions
+		///
+		std::vector<std::shared_ptr<SessionWrapper>> getOpenAndConfiguredSessions() const;
+
+		///
+		/// Get all configured sessions, which have been finished
+		/// @returns the finished and configured sessions
+		///
+		std::vector<std::shared_ptr<SessionWrapper>> getFinishedAndConfiguredSessions() const;
+
+		///
+		/// Get all registered sessions regardless of their state
+		/// @returns all sessions
+		///
+		std::vector<std::shared_ptr<SessionWrapper>> getAllSessions() const;
+
+		///
+		/// Called by a registered @ref SessionWrapper after its beacon configuration was set.
+		/// @param[in] sessionWrapper the configured session wrapper
+		///
+		void onBeaconConfigurationSet(SessionWrapper& sessionWrapper);
+
+		///
+		/// Called by a registered @ref SessionWrapper after its session was finished.
+		/// @param[in] sessionWrapper the finished session wrapper
+		///
+		void onSessionFinished(SessionWrapper& sessionWrapper);
+
+	private:
+		using SessionList = std::list<std::shared_ptr<SessionWrapper>>;
+
+		///
+		/// Move the session wrapper to the end of the given list
+		/// @param[in] sessionWrapper the session wrapper to move
+		/// @param[in] targetList the list to move the session wrapper to
+		///
+		void moveTo(SessionWrapper& sessionWrapper, SessionList& targetList);
+
+		///
+		/// Detach all session wrappers of the given list from this registry
+		/// @param[in] sessionList the list to detach
+		///
+		static void detach(SessionList& sessionList);
+
+		/// mutex guarding the lists and the position of the session wrappers within them
+		mutable std::mutex mMutex;
+
+		/// sessions which have not been configured yet
+		SessionList mNewSessions;
+
+		/// configured sessions, which are not finished yet
+		SessionList mOpenSessions;
+
+		/// configured sessions, which have been finished
+		SessionList mFinishedSessions;
+	};
+}
+
+#endif
@@ -15,6 +15,7 @@
 */
 
 #include "SessionWrapper.h"
+#include "SessionRegistry.h"
 #include "configuration/BeaconConfiguration.h"
 
 using namespace core;
@@ -23,9 +24,13 @@ constexpr uint32_t MAX_NEW_SESSION_REQUESTS = 4;
 
 SessionWrapper::SessionWrapper(std::shared_ptr<Session> session)
 	: mWrappedSession(session)
+	, mRegistry(nullptr)
+	, mRegistryList(nullptr)
+	, mRegistryPosition()
 	, mBeaconConfiguration()
 	, mIsBeaconConfigurationSet(false)
 	, mSessionFinished(false)
+	, mFlushRequested(false)
 	, mNumNewSessionRequestsLeft(MAX_NEW_SESSION_REQUESTS)
 {
 
@@ -35,6 +40,12 @@ void SessionWrapper::updateBeaconConfiguration(std::shared_ptr<configuration::Be
 {
 	mWrappedSession->setBeaconConfiguration(beaconConfiguration);
 	mIsBeaconConfigurationSet = true;
+
+	auto registry = mRegistry.load();
+	if (registry != nullptr)
+	{
+		registry->onBeaconConfigurationSet(*this);
+	}
 }
 
 std::shared_ptr<configuration::BeaconConfiguration> SessionWrapper::getBeaconConfiguration() const
@@ -50,6 +61,12 @@ bool SessionWrapper::isBeaconConfigurationSet() const
 void SessionWrapper::finishSession()
 {
 	mSessionFinished = true;
+
+	auto registry = mRegistry.load();
+	if (registry != nullptr)
+	{
+		registry->onSessionFinished(*this);
+	}
 }
 
 bool SessionWrapper::isSessionFinished() const
@@ -57,6 +74,21 @@ bool SessionWrapper::isSessionFinished() const
 	return mSessionFinished;
 }
 
+void SessionWrapper::requestFlush()
+{
+	mFlushRequested = true;
+}
+
+bool SessionWrapper::consumeFlushRequest()
+{
+	return mFlushRequested.load(std::memory_order_relaxed) && mFlushRequested.exchange(false);
+}
+
+bool SessionWrapper::isFlushRequested() const
+{
+	return mFlushRequested;
+}
+
 void SessionWrapper::decreaseNumberOfNewSessionRequests()
 {
 	mNumNewSessionRequestsLeft--;
@@ -96,3 +128,13 @@ std::shared_ptr<protocol::StatusResponse> SessionWrapper::sendBeacon(std::shared
 {
 	return mWrappedSession->sendBeacon(httpClientProvider);
 }
+
+protocol::IHTTPMultiClient::RequestID SessionWrapper::sendNextBeaconChunk(std::shared_ptr<protocol::IHTTPMultiClient> multiClient)
+{
+	return mWrappedSession->sendNextBeaconChunk(multiClient);
+}
+
+bool SessionWrapper::handleBeaconChunkResponse(std::shared_ptr<protocol::StatusResponse> response)
+{
+	return mWrappedSession->handleBeaconChunkResponse(response);
+}
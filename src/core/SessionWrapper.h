@@ -20,6 +20,8 @@
 #include "Session.h"
 #include "protocol/StatusResponse.h"
 
+#include <atomic>
+#include <list>
 #include <memory>
 
 namespace configuration {
@@ -28,11 +30,16 @@ namespace configuration {
 
 namespace core
 {
+	class SessionRegistry;
+
 	///
 	/// Wrapper around the @ref core::Session which holds additional data
 	/// required only in the communication package
 	class SessionWrapper
 	{
+		/// the registry maintains the wrapper's position within its lists
+		friend class SessionRegistry;
+
 	public:
 
 		///
@@ -73,6 +80,23 @@ namespace core
 		///
 		bool isSessionFinished() const;
 
+		///
+		/// Request to send this session's data without waiting for the send interval to expire.
+		///
+		void requestFlush();
+
+		///
+		/// Check whether sending this session's data was requested via @ref requestFlush and reset the request.
+		/// @returns @c true if sending was requested since the last call, @c false otherwise
+		///
+		bool consumeFlushRequest();
+
+		///
+		/// Check whether sending this session's data was requested via @ref requestFlush, without resetting the request.
+		/// @returns @c true if sending was requested, @c false otherwise
+		///
+		bool isFlushRequested() const;
+
 		///
 		/// Will be called each time a new session request was made for a session.
 		///
@@ -120,11 +144,34 @@ namespace core
 		///
 		std::shared_ptr<protocol::StatusResponse> sendBeacon(std::shared_ptr<providers::IHTTPClientProvider> httpClientProvider);
 
+		///
+		/// Send next beacon chunk forward call
+		/// @param[in] multiClient the client used for sending the chunk
+		/// @returns the ID of the request or @ref protocol::IHTTPMultiClient::INVALID_REQUEST_ID if there is no more data
+		///
+		protocol::IHTTPMultiClient::RequestID sendNextBeaconChunk(std::shared_ptr<protocol::IHTTPMultiClient> multiClient);
+
+		///
+		/// Handle beacon chunk response forward call
+		/// @param[in] response the response received or @c nullptr if sending was aborted
+		/// @returns @c true if the chunk was sent successfully, @c false otherwise
+		///
+		bool handleBeaconChunkResponse(std::shared_ptr<protocol::StatusResponse> response);
+
 	private:
 
 		/// pointer to wrapped session
 		std::shared_ptr<Session> mWrappedSession;
 
+		/// the registry this wrapper is registered in or @c nullptr
+		std::atomic<SessionRegistry*> mRegistry;
+
+		/// the registry's list currently containing this wrapper, guarded by the registry's mutex
+		std::list<std::shared_ptr<SessionWrapper>>* mRegistryList;
+
+		/// position of this wrapper within @c mRegistryList, guarded by the registry's mutex
+		std::list<std::shared_ptr<SessionWrapper>>::iterator mRegistryPosition;
+
 		/// the beacon configuration used by the session
 		std::shared_ptr<configuration::BeaconConfiguration> mBeaconConfiguration;
 
@@ -134,6 +181,9 @@ namespace core
 		/// atomic flag if the session has been ended
 		std::atomic<bool> mSessionFinished;
 
+		/// atomic flag if the session's data shall be sent before the send interval expires
+		std::atomic<bool> mFlushRequested;
+
 		/// number of remaining session requests before giving up
 		uint32_t mNumNewSessionRequestsLeft;
 	};
@@ -15,9 +15,11 @@
 */
 
 #include "UTF8String.h"
+#include "core/util/SIMDSupport.h"
 #include "memory.h"
 
 #include <stdio.h>
+#include <cstring>
 #include <sstream>
 
 using namespace core;
@@ -45,6 +47,22 @@ UTF8String::UTF8String(std::string stringData)
 UTF8String::~UTF8String()
 {
 	mData.clear();
+}
+
+UTF8String UTF8String::fromASCII(const std::string& data)
+{
+	UTF8String string;
+	string.mData = data;
+	string.mStringLength = data.size();
+	return string;
+}
+
+UTF8String UTF8String::fromValidatedData(const char* data, size_t byteLength, size_type stringLength)
+{
+	UTF8String string;
+	string.mData.assign(data, byteLength);
+	string.mStringLength = stringLength;
+	return string;
 }
 
 UTF8String::size_type UTF8String::getStringLength() const
@@ -145,35 +163,83 @@ size_t UTF8String::getByteWidthOfCharacter(const unsigned char character) const
 	return 0;
 }
 
-void UTF8String::validateString(const char* stringData)
+///
+/// Returns the number of consecutive US-ASCII characters at the beginning of @c data.
+/// @param[in] data pointer to the data to inspect
+/// @param[in] length number of bytes available at @c data
+/// @returns the length of the US-ASCII run, which is at most @c length
+///
+static size_t getASCIIRunLength(const char* data, size_t length)
 {
-	auto replacementCharacterASCII = "\xEF\xBF\xBD";
-	if (stringData == nullptr || stringData[0] == '\0')
+	size_t runLength = 0;
+
+#if defined(OPENKIT_HAVE_SSE2)
+	// check 32 bytes per step, the most significant bit of all US-ASCII characters is cleared
+	while (length - runLength >= 32)
 	{
-		mStringLength = 0;
-		return;
+		const __m128i first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + runLength));
+		const __m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + runLength + 16));
+		if (_mm_movemask_epi8(_mm_or_si128(first, second)) != 0)
+		{
+			break;
+		}
+		runLength += 32;
 	}
 
-	auto byteLength = 0;
+	while (length - runLength >= 16)
+	{
+		const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + runLength));
+		auto mask = static_cast<uint32_t>(_mm_movemask_epi8(block));
+		if (mask != 0)
+		{
+			return runLength + core::util::countTrailingZeros(mask);
+		}
+		runLength += 16;
+	}
+#endif
 
-	while (*(stringData + byteLength) != '\0')
+	while (runLength < length && (static_cast<unsigned char>(data[runLength]) & 0x80) == 0)
 	{
-		byteLength++;
+		runLength++;
 	}
 
-	if (byteLength <= 0)
+	return runLength;
+}
+
+void UTF8String::validateString(const char* stringData)
+{
+	auto replacementCharacterASCII = "\xEF\xBF\xBD";
+	if (stringData == nullptr || stringData[0] == '\0')
 	{
+		mStringLength = 0;
 		return;
 	}
-		
+
+	auto byteLength = strlen(stringData);
+
 	mData.clear();
+	mData.reserve(byteLength);
 
 	auto multibyteSeqenceLength = -1;
 	auto multibyteSequencePosition = -1;
 
-	auto characterCount = 0; //number of characters, either UTF8 multibyte or ASCII single byte
-	for (auto i = 0; i < byteLength; i++)//omit \0 at the end of the array
+	size_type characterCount = 0; //number of characters, either UTF8 multibyte or ASCII single byte
+	size_t i = 0;
+	while (i < byteLength)//omit \0 at the end of the array
 	{
+		if (multibyteSeqenceLength == -1)
+		{
+			// fast path - not within a multi-byte character, copy a run of US-ASCII characters at once
+			auto runLength = getASCIIRunLength(stringData + i, byteLength - i);
+			if (runLength > 0)
+			{
+				mData.append(stringData + i, runLength);
+				characterCount += runLength;
+				i += runLength;
+				continue;
+			}
+		}
+
 		auto byteWidthOfCurrentCharacter = getByteWidthOfCharacter(static_cast<unsigned char>(stringData[i]));
 
 		if (isPartOfPreviousUtf8Multibyte(static_cast<unsigned char>(stringData[i])))
@@ -190,10 +256,7 @@ void UTF8String::validateString(const char* stringData)
 			else if (multibyteSequencePosition == multibyteSeqenceLength - 1)
 			{
 				auto offset = i - multibyteSeqenceLength + 1;
-				for (auto j = 0; j < multibyteSeqenceLength; j++)
-				{
-					this->mData.push_back(stringData[offset + j]);
-				}
+				this->mData.append(stringData + offset, multibyteSeqenceLength);
 
 				multibyteSeqenceLength = -1;
 				multibyteSequencePosition = -1;
@@ -226,12 +289,63 @@ void UTF8String::validateString(const char* stringData)
 				multibyteSequencePosition = -1;
 			}
 
-			multibyteSeqenceLength = byteWidthOfCurrentCharacter;
+			multibyteSeqenceLength = static_cast<int>(byteWidthOfCurrentCharacter);
 			multibyteSequencePosition = 0;
 		}
+
+		i++;
 	}
 
 	mStringLength = characterCount;
+}
+
+bool UTF8String::isWellFormed(const char* stringData, size_t& byteLength, size_type& stringLength)
+{
+	byteLength = 0;
+	stringLength = 0;
+	if (stringData == nullptr)
+	{
+		return true;
+	}
+
+	auto length = strlen(stringData);
+	size_t i = 0;
+	size_type characterCount = 0;
+	while (i < length)
+	{
+		auto runLength = getASCIIRunLength(stringData + i, length - i);
+		characterCount += runLength;
+		i += runLength;
+		if (i == length)
+		{
+			break;
+		}
+
+		// multi-byte character - lead byte must be followed by the exact number of continuation bytes
+		auto leadByte = static_cast<unsigned char>(stringData[i]);
+		size_t width = (leadByte & 0xE0) == 0xC0 ? 2
+			: (leadByte & 0xF0) == 0xE0 ? 3
+			: (leadByte & 0xF8) == 0xF0 ? 4
+			: 0;
+		if (width == 0 || length - i < width)
+		{
+			return false;
+		}
+		for (size_t j = 1; j < width; j++)
+		{
+			if ((static_cast<unsigned char>(stringData[i + j]) & 0xC0) != 0x80)
+			{
+				return false;
+			}
+		}
+
+		characterCount++;
+		i += width;
+	}
+
+	byteLength = length;
+	stringLength = characterCount;
+	return true;
 }
 
 bool UTF8String::equals(const UTF8String& other) const
@@ -59,6 +59,37 @@ namespace core
 		///
 		~UTF8String();
 
+		///
+		/// Create a string from data which is known to consist of US-ASCII characters only.
+		///
+		/// No UTF8 validation is performed, therefore the caller must ensure that @c data
+		/// does not contain any byte with the most significant bit set.
+		/// @param[in] data US-ASCII data used to initialize the string
+		/// @return a new string initialized to the provided value
+		///
+		static UTF8String fromASCII(const std::string& data);
+
+		///
+		/// Create a string from data which has already been validated.
+		///
+		/// No UTF8 validation is performed, therefore the caller must ensure that @c data
+		/// only contains complete UTF8 characters, e.g. by taking it from another @ref UTF8String.
+		/// @param[in] data pointer to the validated data
+		/// @param[in] byteLength number of bytes at @c data
+		/// @param[in] stringLength number of characters at @c data
+		/// @return a new string initialized to the provided value
+		///
+		static UTF8String fromValidatedData(const char* data, size_t byteLength, size_type stringLength);
+
+		///
+		/// Test if the given data is well-formed, which means @ref validateString would take it over unchanged.
+		/// @param[in] stringData the null-terminated string data to test
+		/// @param[out] byteLength number of bytes at @c stringData, excluding the terminating null character
+		/// @param[out] stringLength number of characters at @c stringData
+		/// @return @c true if @c stringData does not need any modification, @c false otherwise
+		///
+		static bool isWellFormed(const char* stringData, size_t& byteLength, size_type& stringLength);
+
 		///
 		/// Returns the string size. For UTF8 this is not necessarily the number of bytes
 		/// @returns the number of characters
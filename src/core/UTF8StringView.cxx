@@ -0,0 +1,133 @@
+/**
+* Copyright 2018 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "UTF8StringView.h"
+
+#include <cstring>
+
+using namespace core;
+
+UTF8StringView::UTF8StringView()
+	: mData("")
+	, mByteLength(0)
+	, mStringLength(0)
+{
+}
+
+UTF8StringView::UTF8StringView(const UTF8String& string)
+	: mData(string.getStringData().data())
+	, mByteLength(string.getStringData().size())
+	, mStringLength(string.getStringLength())
+{
+}
+
+UTF8StringView UTF8StringView::fromValidatedData(const char* data, size_t byteLength, UTF8String::size_type stringLength)
+{
+	UTF8StringView view;
+	if (data != nullptr)
+	{
+		view.mData = data;
+		view.mByteLength = byteLength;
+		view.mStringLength = stringLength;
+	}
+	return view;
+}
+
+UTF8StringView UTF8StringView::validate(const char* stringData, UTF8String& storage)
+{
+	size_t byteLength = 0;
+	UTF8String::size_type stringLength = 0;
+	if (UTF8String::isWellFormed(stringData, byteLength, stringLength))
+	{
+		return fromValidatedData(stringData, byteLength, stringLength);
+	}
+
+	storage = UTF8String(stringData);
+	return UTF8StringView(storage);
+}
+
+const char* UTF8StringView::getData() const
+{
+	return mData;
+}
+
+size_t UTF8StringView::getByteLength() const
+{
+	return mByteLength;
+}
+
+UTF8String::size_type UTF8StringView::getStringLength() const
+{
+	return mStringLength;
+}
+
+bool UTF8StringView::empty() const
+{
+	return mStringLength == 0;
+}
+
+UTF8StringView UTF8StringView::prefix(UTF8String::size_type length) const
+{
+	if (mStringLength <= length)
+	{
+		return *this;
+	}
+
+	if (mByteLength == mStringLength)
+	{
+		// US-ASCII only, each character is exactly one byte
+		return fromValidatedData(mData, length, length);
+	}
+
+	// the data is validated, therefore each byte which is not a continuation byte starts a new character
+	size_t byteIndex = 0;
+	UTF8String::size_type characterCount = 0;
+	while (byteIndex < mByteLength)
+	{
+		if ((static_cast<unsigned char>(mData[byteIndex]) & 0xC0) != 0x80)
+		{
+			if (characterCount == length)
+			{
+				break;
+			}
+			characterCount++;
+		}
+		byteIndex++;
+	}
+
+	return fromValidatedData(mData, byteIndex, characterCount);
+}
+
+UTF8String UTF8StringView::toUTF8String() const
+{
+	return UTF8String::fromValidatedData(mData, mByteLength, mStringLength);
+}
+
+bool core::operator ==(const UTF8StringView& lhs, const UTF8StringView& rhs)
+{
+	return lhs.getByteLength() == rhs.getByteLength()
+		&& (lhs.getByteLength() == 0 || memcmp(lhs.getData(), rhs.getData(), lhs.getByteLength()) == 0);
+}
+
+bool core::operator !=(const UTF8StringView& lhs, const UTF8StringView& rhs)
+{
+	return !(lhs == rhs);
+}
+
+std::ostream& core::operator <<(std::ostream& stream, const UTF8StringView& view)
+{
+	return stream.write(view.getData(), static_cast<std::streamsize>(view.getByteLength()));
+}
@@ -0,0 +1,135 @@
+/**
+* Copyright 2018 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef _CORE_UTF8STRINGVIEW_H
+#define _CORE_UTF8STRINGVIEW_H
+
+#include "core/UTF8String.h"
+
+#include <cstddef>
+#include <ostream>
+
+namespace core
+{
+	///
+	/// Non-owning reference to already validated UTF8 data.
+	///
+	/// A view never validates or copies the referenced data, therefore the data must outlive the view.
+	/// Views are either created from an @ref UTF8String, or from a caller provided buffer via @ref validate,
+	/// which only falls back to an owning @ref UTF8String if the buffer is not well-formed.
+	///
+	class UTF8StringView
+	{
+	public:
+
+		///
+		/// Default constructor creating an empty view
+		///
+		UTF8StringView();
+
+		///
+		/// Create a view referencing the data of the given string
+		/// @param[in] string the validated string to reference
+		///
+		UTF8StringView(const UTF8String& string);
+
+		///
+		/// Create a view from data which has already been validated
+		/// @param[in] data pointer to the validated data
+		/// @param[in] byteLength number of bytes at @c data
+		/// @param[in] stringLength number of characters at @c data
+		/// @return a view referencing the given data
+		///
+		static UTF8StringView fromValidatedData(const char* data, size_t byteLength, UTF8String::size_type stringLength);
+
+		///
+		/// Validate the user provided @c stringData exactly once.
+		///
+		/// If @c stringData is well-formed, the returned view directly references @c stringData.
+		/// Otherwise @c storage is initialized with the validated string and the returned view references @c storage.
+		/// @param[in] stringData the null-terminated string data to validate, might be @c nullptr
+		/// @param[out] storage storage used for strings requiring modification
+		/// @return a view referencing the validated data
+		///
+		static UTF8StringView validate(const char* stringData, UTF8String& storage);
+
+		///
+		/// Returns the pointer to the referenced data, which is not null-terminated
+		/// @returns the referenced data
+		///
+		const char* getData() const;
+
+		///
+		/// Returns the number of bytes referenced by this view
+		/// @returns the number of bytes
+		///
+		size_t getByteLength() const;
+
+		///
+		/// Returns the number of characters referenced by this view
+		/// @returns the number of characters
+		///
+		UTF8String::size_type getStringLength() const;
+
+		///
+		/// Returns whether the view is empty or not.
+		/// @returns @c true if the view is empty, @c false otherwise
+		///
+		bool empty() const;
+
+		///
+		/// Create a view on the first @c length characters without copying any data.
+		/// @param[in] length the maximum number of characters to include
+		/// @returns a view on the first @c length characters, or this view if it is not longer than @c length
+		///
+		UTF8StringView prefix(UTF8String::size_type length) const;
+
+		///
+		/// Create an owning copy of the referenced data without validating it again.
+		/// @returns a new @ref UTF8String containing the referenced data
+		///
+		UTF8String toUTF8String() const;
+
+	private:
+		/// referenced data
+		const char* mData;
+
+		/// number of referenced bytes
+		size_t mByteLength;
+
+		/// number of referenced characters
+		UTF8String::size_type mStringLength;
+	};
+
+	///
+	/// Compare the referenced data of two views
+	/// @return @c true if both views reference equal data, @c false otherwise
+	///
+	bool operator ==(const UTF8StringView& lhs, const UTF8StringView& rhs);
+
+	///
+	/// Compare the referenced data of two views
+	/// @return @c true if the views reference different data, @c false otherwise
+	///
+	bool operator !=(const UTF8StringView& lhs, const UTF8StringView& rhs);
+
+	///
+	/// Write the referenced data to an output stream
+	///
+	std::ostream& operator <<(std::ostream& stream, const UTF8StringView& view);
+}
+
+#endif
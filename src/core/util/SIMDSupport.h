@@ -0,0 +1,64 @@
+/**
+* Copyright 2018 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef _CORE_UTIL_SIMDSUPPORT_H
+#define _CORE_UTIL_SIMDSUPPORT_H
+
+#include <cstdint>
+
+///
+/// OPENKIT_HAVE_SSE2 is defined, if the target architecture guarantees SSE2 support.
+/// This is the case for all x86-64 targets and for 32-bit x86 builds with SSE2 code generation enabled.
+///
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define OPENKIT_HAVE_SSE2
+#include <emmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+namespace core
+{
+	namespace util
+	{
+		///
+		/// Returns the number of trailing zero bits of a non-zero 32-bit value.
+		/// @param[in] value the value to inspect, which must not be @c 0
+		/// @returns the index of the least significant bit set
+		///
+		inline uint32_t countTrailingZeros(uint32_t value)
+		{
+#if defined(_MSC_VER)
+			unsigned long index;
+			_BitScanForward(&index, value);
+			return static_cast<uint32_t>(index);
+#elif defined(__GNUC__) || defined(__clang__)
+			return static_cast<uint32_t>(__builtin_ctz(value));
+#else
+			uint32_t count = 0;
+			while ((value & 1) == 0)
+			{
+				value >>= 1;
+				count++;
+			}
+			return count;
+#endif
+		}
+	}
+}
+
+#endif
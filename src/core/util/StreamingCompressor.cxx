@@ -0,0 +1,154 @@
+/**
+* Copyright 2018 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "StreamingCompressor.h"
+
+#include <algorithm>
+#include <limits>
+#include <zlib.h>
+
+using namespace base::util;
+
+#define WINDOW_BITS   15
+#define GZIP_ENCODING 16
+
+StreamingCompressor::StreamingCompressor()
+	: mStream()
+	, mInputSegments()
+	, mNextInputSegment(0)
+	, mNextInputSegmentOffset(0)
+	, mIsFinished(true)
+	, mHasError(false)
+{
+}
+
+StreamingCompressor::~StreamingCompressor()
+{
+	if (mStream != nullptr)
+	{
+		deflateEnd(mStream.get());
+	}
+}
+
+bool StreamingCompressor::reset(const void* inData, size_t inDataSize)
+{
+	mInputSegments.clear();
+	if (inData != nullptr && inDataSize > 0)
+	{
+		mInputSegments.emplace_back(static_cast<const unsigned char*>(inData), inDataSize);
+	}
+
+	return resetStream();
+}
+
+bool StreamingCompressor::reset(const std::vector<core::UTF8StringView>& segments)
+{
+	mInputSegments.clear();
+	mInputSegments.reserve(segments.size());
+	for (const auto& segment : segments)
+	{
+		if (segment.getByteLength() > 0)
+		{
+			mInputSegments.emplace_back(reinterpret_cast<const unsigned char*>(segment.getData()), segment.getByteLength());
+		}
+	}
+
+	return resetStream();
+}
+
+bool StreamingCompressor::resetStream()
+{
+	if (mStream == nullptr)
+	{
+		std::unique_ptr<z_stream> stream(new z_stream());
+		stream->zalloc = Z_NULL;
+		stream->zfree = Z_NULL;
+		stream->opaque = Z_NULL;
+
+		// Use GZIP with default compresssion
+		if (deflateInit2(stream.get(), Z_DEFAULT_COMPRESSION, Z_DEFLATED, WINDOW_BITS | GZIP_ENCODING, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+		{
+			mHasError = true;
+			return false;
+		}
+		mStream = std::move(stream);
+	}
+	else if (deflateReset(mStream.get()) != Z_OK)
+	{
+		mHasError = true;
+		return false;
+	}
+
+	mStream->next_in = Z_NULL;
+	mStream->avail_in = 0;
+	mNextInputSegment = 0;
+	mNextInputSegmentOffset = 0;
+	mIsFinished = false;
+	mHasError = false;
+
+	return true;
+}
+
+size_t StreamingCompressor::read(void* outBuffer, size_t outBufferSize)
+{
+	if (mIsFinished || mHasError || outBufferSize == 0)
+	{
+		return 0;
+	}
+
+	auto maxChunkSize = static_cast<size_t>(std::numeric_limits<uInt>::max());
+	mStream->next_out = static_cast<Bytef*>(outBuffer);
+	mStream->avail_out = static_cast<uInt>(std::min(outBufferSize, maxChunkSize));
+	auto outSize = static_cast<size_t>(mStream->avail_out);
+
+	while (mStream->avail_out > 0)
+	{
+		if (mStream->avail_in == 0 && mNextInputSegment < mInputSegments.size())
+		{
+			// zlib's sizes are limited to uInt, hand over large inputs piecewise
+			const auto& segment = mInputSegments[mNextInputSegment];
+			auto chunkSize = std::min(segment.second - mNextInputSegmentOffset, maxChunkSize);
+			mStream->next_in = const_cast<Bytef*>(segment.first + mNextInputSegmentOffset);
+			mStream->avail_in = static_cast<uInt>(chunkSize);
+			mNextInputSegmentOffset += chunkSize;
+			if (mNextInputSegmentOffset == segment.second)
+			{
+				mNextInputSegment++;
+				mNextInputSegmentOffset = 0;
+			}
+		}
+
+		auto flush = (mStream->avail_in == 0 && mNextInputSegment == mInputSegments.size()) ? Z_FINISH : Z_NO_FLUSH;
+		auto result = deflate(mStream.get(), flush);
+		if (result == Z_STREAM_END)
+		{
+			mIsFinished = true;
+			break;
+		}
+		if (result != Z_OK)
+		{
+			mHasError = true;
+			break;
+		}
+	}
+
+	return outSize - mStream->avail_out;
+}
+
+bool StreamingCompressor::hasError() const
+{
+	return mHasError;
+}
@@ -0,0 +1,121 @@
+/**
+* Copyright 2018 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef _CORE_UTIL_STREAMINGCOMPRESSOR_H
+#define _CORE_UTIL_STREAMINGCOMPRESSOR_H
+
+#include "core/UTF8StringView.h"
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+struct z_stream_s;
+
+namespace base
+{
+	namespace util
+	{
+		///
+		/// Gzip compressor producing its output piecewise into caller provided buffers.
+		///
+		/// The compressed data is never held in memory as a whole,
+		/// it is produced on demand, e.g. from within curl's read callback.
+		/// The zlib stream is allocated once and reused by @ref reset for subsequent inputs.
+		///
+		class StreamingCompressor
+		{
+		public:
+			///
+			/// Constructor
+			///
+			StreamingCompressor();
+
+			///
+			/// Destructor
+			///
+			~StreamingCompressor();
+
+			StreamingCompressor(const StreamingCompressor&) = delete;
+			StreamingCompressor& operator=(const StreamingCompressor&) = delete;
+
+			///
+			/// Start compressing new input, discarding any state of the previous input.
+			///
+			/// The input is not copied, it must stay valid until it is completely read or @c reset is called again.
+			/// @param[in] inData pointer to the data to compress
+			/// @param[in] inDataSize size of the data to compress (measured in bytes)
+			/// @returns @c true on success, @c false if the zlib stream could not be set up
+			///
+			bool reset(const void* inData, size_t inDataSize);
+
+			///
+			/// Start compressing new input made up of several segments, discarding any state of the previous input.
+			///
+			/// The segments are compressed in the given order as if they were one contiguous input.
+			/// Their data is not copied, it must stay valid until it is completely read or @c reset is called again.
+			/// @param[in] segments the data to compress
+			/// @returns @c true on success, @c false if the zlib stream could not be set up
+			///
+			bool reset(const std::vector<core::UTF8StringView>& segments);
+
+			///
+			/// Compress the next part of the input.
+			/// @param[out] outBuffer buffer receiving the compressed data
+			/// @param[in] outBufferSize size of @c outBuffer (measured in bytes)
+			/// @returns the number of bytes written to @c outBuffer, @c 0 if all compressed data was read
+			///
+			size_t read(void* outBuffer, size_t outBufferSize);
+
+			///
+			/// Check if compressing failed
+			/// @returns @c true if zlib reported an error, @c false otherwise
+			///
+			bool hasError() const;
+
+		private:
+			/// a piece of input data, given by its start and its size in bytes
+			typedef std::pair<const unsigned char*, size_t> InputSegment;
+
+			///
+			/// Set up the zlib stream for new input
+			/// @returns @c true on success, @c false if the zlib stream could not be set up
+			///
+			bool resetStream();
+
+			/// the zlib stream, allocated on first use
+			std::unique_ptr<z_stream_s> mStream;
+
+			/// the input data, the part not yet passed to zlib starts at @c mNextInputSegment
+			std::vector<InputSegment> mInputSegments;
+
+			/// index of the next input segment not yet passed to zlib
+			size_t mNextInputSegment;
+
+			/// number of bytes of the next input segment already passed to zlib
+			size_t mNextInputSegmentOffset;
+
+			/// @c true if all compressed data was produced
+			bool mIsFinished;
+
+			/// @c true if zlib reported an error
+			bool mHasError;
+		};
+	}
+}
+
+#endif
@@ -15,48 +15,131 @@
 */
 
 #include "URLEncoding.h"
+#include "SIMDSupport.h"
 
-#include <sstream>
-#include <iomanip>
 #include <cctype>
 #include <cstdint>
 
 using namespace core::util;
 
-const std::unordered_set<unsigned char> URLEncoding::sUnreservedCharactersRFC3986 = std::unordered_set<unsigned char>({ 'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
-																					'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i',
-																					'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z', '0', '1',
-																					'2', '3', '4', '5', '6', '7', '8', '9', '-', '_', '.', '~' });
+///
+/// Classification of all byte values, a non-zero entry marks an unreserved character (RFC 3986),
+/// which does not need escaping. These are the characters [A-Za-z0-9] and '-', '_', '.', '~'.
+///
+static constexpr unsigned char UNRESERVED_CHARACTERS_RFC3986[256] =
+{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x00 - 0x0F
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x10 - 0x1F
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0,  // 0x20 - 0x2F
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,  // 0x30 - 0x3F
+	0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  // 0x40 - 0x4F
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1,  // 0x50 - 0x5F
+	0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  // 0x60 - 0x6F
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 0,  // 0x70 - 0x7F
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x80 - 0x8F
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0x90 - 0x9F
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0xA0 - 0xAF
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0xB0 - 0xBF
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0xC0 - 0xCF
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0xD0 - 0xDF
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0xE0 - 0xEF
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 0xF0 - 0xFF
+};
+
+static constexpr char HEX_DIGITS[] = "0123456789ABCDEF";
 
-static std::string escapeHexValueInPercentEncoding(unsigned char c)
+#if defined(OPENKIT_HAVE_SSE2)
+
+///
+/// Classify 16 bytes at once and return a bit mask where bit @c i is set, if byte @c i is an unreserved character.
+///
+/// Bytes with the most significant bit set are negative when compared as signed 8 bit integers
+/// and therefore never fall into one of the checked ranges.
+///
+static inline uint32_t unreservedCharacterMask(const char* data)
 {
-	std::stringstream ss;
-	ss << "%" << std::uppercase << std::setfill('0') << std::setw(2) << std::hex << static_cast<int32_t>(c);
-	return ss.str();
+	const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+
+	const __m128i isDigit = _mm_and_si128(_mm_cmpgt_epi8(bytes, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(bytes, _mm_set1_epi8('9' + 1)));
+	const __m128i isUpper = _mm_and_si128(_mm_cmpgt_epi8(bytes, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(bytes, _mm_set1_epi8('Z' + 1)));
+	const __m128i isLower = _mm_and_si128(_mm_cmpgt_epi8(bytes, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(bytes, _mm_set1_epi8('z' + 1)));
+	const __m128i isMark = _mm_or_si128(
+		_mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8('-')), _mm_cmpeq_epi8(bytes, _mm_set1_epi8('_'))),
+		_mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8('.')), _mm_cmpeq_epi8(bytes, _mm_set1_epi8('~'))));
+
+	const __m128i isUnreserved = _mm_or_si128(_mm_or_si128(isDigit, isUpper), _mm_or_si128(isLower, isMark));
+	return static_cast<uint32_t>(_mm_movemask_epi8(isUnreserved));
 }
 
- core::UTF8String URLEncoding::urlencode(const core::UTF8String& string)
- {
+#endif
+
+///
+/// Append the percent encoding of the given byte.
+///
+static inline void appendEscaped(unsigned char character, std::string& encoded)
+{
+	const char escaped[3] = { '%', HEX_DIGITS[character >> 4], HEX_DIGITS[character & 0x0F] };
+	encoded.append(escaped, sizeof(escaped));
+}
+
+core::UTF8String URLEncoding::urlencode(const core::UTF8String& string)
+{
 	std::string encoded;
-	encoded.reserve(string.getStringLength());
+	encoded.reserve(string.getStringData().size());
+	urlencode(string, encoded);
 
-	auto stringData = string.getStringData();
+	return core::UTF8String::fromASCII(encoded);
+}
 
-	for (auto it = stringData.begin(); it < stringData.end(); it++)
+void URLEncoding::urlencode(const core::UTF8String& string, std::string& encoded)
+{
+	auto& stringData = string.getStringData();
+	urlencode(stringData.data(), stringData.size(), encoded);
+}
+
+void URLEncoding::urlencode(const char* data, size_t length, std::string& encoded)
+{
+	size_t position = 0;
+
+#if defined(OPENKIT_HAVE_SSE2)
+	// fast path - copy whole runs of unreserved characters, 16 bytes at a time
+	constexpr size_t BLOCK_SIZE = 16;
+	constexpr uint32_t ALL_UNRESERVED = 0xFFFF;
+	while (length - position >= BLOCK_SIZE)
 	{
-		auto character = *it;
-		if (sUnreservedCharactersRFC3986.find(character) !=sUnreservedCharactersRFC3986.end()) //character is in the list of unreserved characters -> copy
+		auto mask = unreservedCharacterMask(data + position);
+		if (mask == ALL_UNRESERVED)
+		{
+			encoded.append(data + position, BLOCK_SIZE);
+			position += BLOCK_SIZE;
+			continue;
+		}
+
+		// copy the run of unreserved characters and escape the first reserved one
+		auto runLength = countTrailingZeros(~mask);
+		encoded.append(data + position, runLength);
+		position += runLength;
+		appendEscaped(static_cast<unsigned char>(data[position]), encoded);
+		position++;
+	}
+#endif
+
+	// copy runs of unreserved characters for the remaining bytes
+	while (position < length)
+	{
+		auto runStart = position;
+		while (position < length && UNRESERVED_CHARACTERS_RFC3986[static_cast<unsigned char>(data[position])])
 		{
-			encoded += character;
+			position++;
 		}
-		else // character must be escaped
+		encoded.append(data + runStart, position - runStart);
+
+		if (position < length)
 		{
-			auto escaped = escapeHexValueInPercentEncoding(character);
-			encoded += escaped.c_str();
+			appendEscaped(static_cast<unsigned char>(data[position]), encoded);
+			position++;
 		}
 	}
-
-	return encoded;
 }
 
 
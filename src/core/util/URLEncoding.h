@@ -19,7 +19,8 @@
 
 #include "core/UTF8String.h"
 
-#include <unordered_set>
+#include <cstddef>
+#include <string>
 
 namespace core
 {
@@ -38,14 +39,26 @@ namespace core
 			///
 			static core::UTF8String urlencode(const core::UTF8String& string);
 
+			///
+			/// URL-Encode the given string and append the result to @c encoded
+			/// @param[in] string the string to encode
+			/// @param[in,out] encoded the buffer to which the url-encoded data is appended
+			///
+			static void urlencode(const core::UTF8String& string, std::string& encoded);
+
+			///
+			/// URL-Encode @c length bytes starting at @c data and append the result to @c encoded
+			/// @param[in] data pointer to the data to encode
+			/// @param[in] length number of bytes to encode
+			/// @param[in,out] encoded the buffer to which the url-encoded data is appended
+			///
+			static void urlencode(const char* data, size_t length, std::string& encoded);
+
 			///
 			/// URL-Decode the given string
 			/// @returns url-decoded version of the current string
 			///
 			static core::UTF8String urldecode(const core::UTF8String& string);
-		private:
-			/// list of characters that don't need escaping
-			static const std::unordered_set<unsigned char> sUnreservedCharactersRFC3986;
 		};
 	}
 }
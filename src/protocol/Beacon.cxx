@@ -23,27 +23,43 @@
 #include "core/util/InetAddressValidator.h"
 #include "providers/DefaultPRNGenerator.h"
 
+#include <limits>
+#include <typeinfo>
 #include <random>
 #include <sstream>
 
 using namespace protocol;
 
+/// maximum length of the mutable beacon data, which consists of four integer key/value pairs
+static constexpr std::string::size_type MAX_MUTABLE_BEACON_DATA_LENGTH = 4 * (sizeof("&xx=") - 1 + std::numeric_limits<int64_t>::digits10 + 2);
+
 Beacon::Beacon(std::shared_ptr<openkit::ILogger> logger, std::shared_ptr<caching::IBeaconCache> beaconCache, std::shared_ptr<configuration::Configuration> configuration, const core::UTF8String clientIPAddress, std::shared_ptr<providers::IThreadIDProvider> threadIDProvider, std::shared_ptr<providers::ITimingProvider> timingProvider)
 	: Beacon(logger, beaconCache, configuration, clientIPAddress, threadIDProvider, timingProvider, std::make_shared<providers::DefaultPRNGenerator>())
 {
 }
 
 Beacon::Beacon(std::shared_ptr<openkit::ILogger> logger, std::shared_ptr<caching::IBeaconCache> beaconCache, std::shared_ptr<configuration::Configuration> configuration, const core::UTF8String clientIPAddress, std::shared_ptr<providers::IThreadIDProvider> threadIDProvider, std::shared_ptr<providers::ITimingProvider> timingProvider, std::shared_ptr<providers::IPRNGenerator> randomGenerator)
+	: Beacon(logger, beaconCache, configuration, clientIPAddress, threadIDProvider, timingProvider, randomGenerator, std::make_shared<ImmutableBeaconData>(configuration))
+{
+}
+
+Beacon::Beacon(std::shared_ptr<openkit::ILogger> logger, std::shared_ptr<caching::IBeaconCache> beaconCache, std::shared_ptr<configuration::Configuration> configuration, const core::UTF8String clientIPAddress, std::shared_ptr<providers::IThreadIDProvider> threadIDProvider, std::shared_ptr<providers::ITimingProvider> timingProvider, std::shared_ptr<providers::IPRNGenerator> randomGenerator, std::shared_ptr<const ImmutableBeaconData> immutableBeaconData)
 	: mLogger(logger)
 	, mConfiguration(configuration)
 	, mClientIPAddress(core::UTF8String(""))
 	, mTimingProvider(timingProvider)
 	, mThreadIDProvider(threadIDProvider)
+	, mDefaultThreadIDProvider(threadIDProvider != nullptr && typeid(*threadIDProvider) == typeid(providers::DefaultThreadIDProvider)
+		? static_cast<providers::DefaultThreadIDProvider*>(threadIDProvider.get())
+		: nullptr)
 	, mSequenceNumber(0)
 	, mID(0)
 	, mSessionNumber()
 	, mSessionStartTime(timingProvider->provideTimestampInMilliseconds())
-	, mImmutableBasicBeaconData()
+	, mImmutableBeaconData(immutableBeaconData)
+	, mSessionBeaconData()
+	, mPrefixBuffer()
+	, mImmutablePrefixLength(0)
 	, mBeaconCache(beaconCache)
 	, mHTTPClientConfiguration(configuration->getHTTPClientConfiguration())
 	, mBeaconConfiguration(configuration->getBeaconConfiguration())
@@ -64,7 +80,7 @@ Beacon::Beacon(std::shared_ptr<openkit::ILogger> logger, std::shared_ptr<caching
 
 	if (mBeaconConfiguration->getDataCollectionLevel() == openkit::DataCollectionLevel::USER_BEHAVIOR)
 	{
-		mDeviceID = truncate(mConfiguration->getDeviceID());
+		mDeviceID = truncate(mConfiguration->getDeviceID()).toUTF8String();
 		mSessionNumber = configuration->createSessionNumber();
 	}
 	else
@@ -73,122 +89,59 @@ Beacon::Beacon(std::shared_ptr<openkit::ILogger> logger, std::shared_ptr<caching
 		mSessionNumber = 1;
 	}
 
-	mImmutableBasicBeaconData = createImmutableBeaconData();
+	mSessionBeaconData = createSessionBeaconData();
 }
 
-core::UTF8String Beacon::createImmutableBeaconData()
+core::UTF8String Beacon::createSessionBeaconData()
 {
-	core::UTF8String basicBeaconData;
-
-	//version and application information 
-	addKeyValuePair(basicBeaconData, protocol::BEACON_KEY_PROTOCOL_VERSION, protocol::PROTOCOL_VERSION);
-	addKeyValuePair(basicBeaconData, protocol::BEACON_KEY_OPENKIT_VERSION, protocol::OPENKIT_VERSION);
-	addKeyValuePair(basicBeaconData, protocol::BEACON_KEY_APPLICATION_ID, mConfiguration->getApplicationID());
-	addKeyValuePair(basicBeaconData, protocol::BEACON_KEY_APPLICATION_NAME, mConfiguration->getApplicationName());
-	auto applicationVersion = mConfiguration->getApplicationVersion();
-	if (!applicationVersion.empty())
-	{
-		addKeyValuePair(basicBeaconData, protocol::BEACON_KEY_APPLICATION_VERSION, applicationVersion);
-	}
-	addKeyValuePair(basicBeaconData, protocol::BEACON_KEY_PLATFORM_TYPE, PLATFORM_TYPE_OPENKIT);
-	addKeyValuePair(basicBeaconData, protocol::BEACON_KEY_AGENT_TECHNOLOGY_TYPE, AGENT_TECHNOLOGY_TYPE);
+	EventWriter sessionBeaconData;
 
 	// device/visitor ID, session number and IP address
-	addKeyValuePair(basicBeaconData, protocol::BEACON_KEY_VISITOR_ID, getDeviceID());
-	addKeyValuePair(basicBeaconData, protocol::BEACON_KEY_SESSION_NUMBER, getSessionNumber());
-	addKeyValuePair(basicBeaconData, protocol::BEACON_KEY_CLIENT_IP_ADDRESS, mClientIPAddress);
+	sessionBeaconData.addKeyValuePair(protocol::BEACON_KEY_VISITOR_ID, getDeviceID());
+	sessionBeaconData.addKeyValuePair(protocol::BEACON_KEY_SESSION_NUMBER, getSessionNumber());
+	sessionBeaconData.addKeyValuePair(protocol::BEACON_KEY_CLIENT_IP_ADDRESS, mClientIPAddress);
 
-	// platform information
-	auto deviceOS = mConfiguration->getDevice()->getOperatingSystem();
-	if (!deviceOS.empty())
-	{
-		addKeyValuePair(basicBeaconData, BEACON_KEY_DEVICE_OS, deviceOS);
-	}
-	auto deviceManufacturer = mConfiguration->getDevice()->getManufacturer();
-	if (!deviceManufacturer.empty())
-	{
-		addKeyValuePair(basicBeaconData, BEACON_KEY_DEVICE_MANUFACTURER, deviceManufacturer);
-	}
-	auto deviceModel = mConfiguration->getDevice()->getModelID();
-	if (!deviceModel.empty())
-	{
-		addKeyValuePair(basicBeaconData, BEACON_KEY_DEVICE_MODEL, deviceModel);
-	}
-
-	auto beaconConfiguration = mConfiguration->getBeaconConfiguration();
-	addKeyValuePair(basicBeaconData, BEACON_KEY_DATA_COLLECTION_LEVEL, (int32_t)beaconConfiguration->getDataCollectionLevel());
-	addKeyValuePair(basicBeaconData, BEACON_KEY_CRASH_REPORTING_LEVEL, (int32_t)beaconConfiguration->getCrashReportingLevel());
-	
-	return basicBeaconData;
+	core::UTF8String data(BEACON_DATA_DELIMITER);
+	data.concatenate(sessionBeaconData.getData());
+	return data;
 }
 
-core::UTF8String Beacon::createBasicEventData(protocol::EventType eventType, const core::UTF8String& eventName)
+void Beacon::writeBasicEventData(EventWriter& writer, protocol::EventType eventType, const core::UTF8StringView& eventName)
 {
-	core::UTF8String eventData;
-	addKeyValuePair(eventData, BEACON_KEY_EVENT_TYPE, static_cast<int32_t>(eventType));
+	writer.addKeyValuePair(BEACON_KEY_EVENT_TYPE, static_cast<int32_t>(eventType));
 
 	if (!eventName.empty())
 	{
-		addKeyValuePair(eventData, BEACON_KEY_NAME, truncate(eventName));
+		if (eventName.getStringLength() > static_cast<core::UTF8String::size_type>(protocol::MAX_NAME_LEN))
+		{
+			writer.addKeyValuePair(BEACON_KEY_NAME, truncate(eventName));
+		}
+		else
+		{
+			writer.addKeyValuePair(BEACON_KEY_NAME, eventName);
+		}
 	}
-	addKeyValuePair(eventData, BEACON_KEY_THREAD_ID, mThreadIDProvider->getThreadID());
-	return eventData;
+	writer.addKeyValuePair(BEACON_KEY_THREAD_ID, getThreadID());
 }
 
-core::UTF8String Beacon::createTimestampData()
+void Beacon::writeTimestampData(EventWriter& writer)
 {
-	core::UTF8String timestampData;
-	addKeyValuePair(timestampData, BEACON_KEY_SESSION_START_TIME, mTimingProvider->convertToClusterTime(mSessionStartTime));
-	addKeyValuePair(timestampData, BEACON_KEY_TIMESYNC_TIME, mTimingProvider->convertToClusterTime(mSessionStartTime));
+	writer.addKeyValuePair(BEACON_KEY_SESSION_START_TIME, mTimingProvider->convertToClusterTime(mSessionStartTime));
+	writer.addKeyValuePair(BEACON_KEY_TIMESYNC_TIME, mTimingProvider->convertToClusterTime(mSessionStartTime));
 	if (!mTimingProvider->isTimeSyncSupported())
 	{
-		addKeyValuePair(timestampData, BEACON_KEY_TRANSMISSION_TIME, mTimingProvider->provideTimestampInMilliseconds());
+		writer.addKeyValuePair(BEACON_KEY_TRANSMISSION_TIME, mTimingProvider->provideTimestampInMilliseconds());
 	}
-	return timestampData;
 }
 
-core::UTF8String Beacon::buildEvent(EventType eventType, const core::UTF8String& name, int32_t parentActionID, uint64_t& eventTimestamp)
+void Beacon::buildEvent(EventWriter& writer, EventType eventType, const core::UTF8StringView& name, int32_t parentActionID, uint64_t& eventTimestamp)
 {
-	core::UTF8String eventData = createBasicEventData(eventType, name);
+	writeBasicEventData(writer, eventType, name);
 
 	eventTimestamp = mTimingProvider->provideTimestampInMilliseconds();
-	addKeyValuePair(eventData, BEACON_KEY_PARENT_ACTION_ID, parentActionID);
-	addKeyValuePair(eventData, BEACON_KEY_START_SEQUENCE_NUMBER, createSequenceNumber());
-	addKeyValuePair(eventData, BEACON_KEY_TIME_0, getTimeSinceSessionStartTime(eventTimestamp));
-
-	return eventData;
-}
-
-void Beacon::appendKey(core::UTF8String& s, const core::UTF8String& key)
-{
-	if (!s.empty())
-	{
-		s.concatenate("&");
-	}
-
-	s.concatenate(key);
-	s.concatenate("=");
-}
-
-void Beacon::addKeyValuePair(core::UTF8String& s, const core::UTF8String& key, const core::UTF8String& value)
-{
-	appendKey(s, key);
-	s.concatenate(core::util::URLEncoding::urlencode(value));
-}
-
-void Beacon::addKeyValuePair(core::UTF8String& s, const core::UTF8String& key, int32_t value)
-{
-	addKeyValuePair(s, key, std::to_string(value));
-}
-
-void Beacon::addKeyValuePair(core::UTF8String& s, const core::UTF8String& key, int64_t value)
-{
-	addKeyValuePair(s, key, std::to_string(value));
-}
-
-void Beacon::addKeyValuePair(core::UTF8String& s, const core::UTF8String& key, double value)
-{
-	addKeyValuePair(s, key, std::to_string(value));
+	writer.addKeyValuePair(BEACON_KEY_PARENT_ACTION_ID, parentActionID);
+	writer.addKeyValuePair(BEACON_KEY_START_SEQUENCE_NUMBER, createSequenceNumber());
+	writer.addKeyValuePair(BEACON_KEY_TIME_0, getTimeSinceSessionStartTime(eventTimestamp));
 }
 
 int32_t Beacon::createSequenceNumber()
@@ -228,7 +181,7 @@ core::UTF8String Beacon::createTag(int32_t parentActionID, int32_t sequenceNumbe
 	webRequestTag.concatenate("_");
 	webRequestTag.concatenate(std::to_string(parentActionID));
 	webRequestTag.concatenate("_");
-	webRequestTag.concatenate(std::to_string(mThreadIDProvider->getThreadID()));
+	webRequestTag.concatenate(std::to_string(getThreadID()));
 	webRequestTag.concatenate("_");
 	webRequestTag.concatenate(std::to_string(sequenceNumber));
 
@@ -242,16 +195,17 @@ void Beacon::addAction(std::shared_ptr<core::Action> action)
 		return;
 	}
 
-	core::UTF8String actionData = createBasicEventData(EventType::ACTION, action->getName());
+	EventWriter actionData;
+	writeBasicEventData(actionData, EventType::ACTION, action->getName());
 
-	addKeyValuePair(actionData, BEACON_KEY_ACTION_ID, action->getID());
-	addKeyValuePair(actionData, BEACON_KEY_PARENT_ACTION_ID, action->getParentID());
-	addKeyValuePair(actionData, BEACON_KEY_START_SEQUENCE_NUMBER, action->getStartSequenceNo());
-	addKeyValuePair(actionData, BEACON_KEY_TIME_0, getTimeSinceSessionStartTime(action->getStartTime()));
-	addKeyValuePair(actionData, BEACON_KEY_END_SEQUENCE_NUMBER, action->getEndSequenceNo());
-	addKeyValuePair(actionData, BEACON_KEY_TIME_1, action->getEndTime() - action->getStartTime());
+	actionData.addKeyValuePair(BEACON_KEY_ACTION_ID, action->getID());
+	actionData.addKeyValuePair(BEACON_KEY_PARENT_ACTION_ID, action->getParentID());
+	actionData.addKeyValuePair(BEACON_KEY_START_SEQUENCE_NUMBER, action->getStartSequenceNo());
+	actionData.addKeyValuePair(BEACON_KEY_TIME_0, getTimeSinceSessionStartTime(action->getStartTime()));
+	actionData.addKeyValuePair(BEACON_KEY_END_SEQUENCE_NUMBER, action->getEndSequenceNo());
+	actionData.addKeyValuePair(BEACON_KEY_TIME_1, action->getEndTime() - action->getStartTime());
 	
-	addActionData(action->getStartTime(), actionData);
+	addActionData(action->getStartTime(), actionData.getData());
 }
 
 void Beacon::addAction(std::shared_ptr<core::RootAction> action)
@@ -261,16 +215,17 @@ void Beacon::addAction(std::shared_ptr<core::RootAction> action)
 		return;
 	}
 
-	core::UTF8String actionData = createBasicEventData(EventType::ACTION, action->getName());
+	EventWriter actionData;
+	writeBasicEventData(actionData, EventType::ACTION, action->getName());
 
-	addKeyValuePair(actionData, BEACON_KEY_ACTION_ID, action->getID());
-	addKeyValuePair(actionData, BEACON_KEY_PARENT_ACTION_ID, 0);
-	addKeyValuePair(actionData, BEACON_KEY_START_SEQUENCE_NUMBER, action->getStartSequenceNo());
-	addKeyValuePair(actionData, BEACON_KEY_TIME_0, getTimeSinceSessionStartTime(action->getStartTime()));
-	addKeyValuePair(actionData, BEACON_KEY_END_SEQUENCE_NUMBER, action->getEndSequenceNo());
-	addKeyValuePair(actionData, BEACON_KEY_TIME_1, action->getEndTime() - action->getStartTime());
+	actionData.addKeyValuePair(BEACON_KEY_ACTION_ID, action->getID());
+	actionData.addKeyValuePair(BEACON_KEY_PARENT_ACTION_ID, 0);
+	actionData.addKeyValuePair(BEACON_KEY_START_SEQUENCE_NUMBER, action->getStartSequenceNo());
+	actionData.addKeyValuePair(BEACON_KEY_TIME_0, getTimeSinceSessionStartTime(action->getStartTime()));
+	actionData.addKeyValuePair(BEACON_KEY_END_SEQUENCE_NUMBER, action->getEndSequenceNo());
+	actionData.addKeyValuePair(BEACON_KEY_TIME_1, action->getEndTime() - action->getStartTime());
 
-	addActionData(action->getStartTime(), actionData);
+	addActionData(action->getStartTime(), actionData.getData());
 }
 
 void Beacon::addActionData(int64_t timestamp, const core::UTF8String& actionData)
@@ -283,13 +238,14 @@ void Beacon::addActionData(int64_t timestamp, const core::UTF8String& actionData
 
 void Beacon::startSession()
 {
-	core::UTF8String eventData = createBasicEventData(EventType::SESSION_START, nullptr);
+	EventWriter eventData;
+	writeBasicEventData(eventData, EventType::SESSION_START, core::UTF8StringView());
 
-	addKeyValuePair(eventData, BEACON_KEY_PARENT_ACTION_ID, 0);
-	addKeyValuePair(eventData, BEACON_KEY_START_SEQUENCE_NUMBER, createSequenceNumber());
-	addKeyValuePair(eventData, BEACON_KEY_TIME_0, int64_t(0));
+	eventData.addKeyValuePair(BEACON_KEY_PARENT_ACTION_ID, 0);
+	eventData.addKeyValuePair(BEACON_KEY_START_SEQUENCE_NUMBER, createSequenceNumber());
+	eventData.addKeyValuePair(BEACON_KEY_TIME_0, int64_t(0));
 
-	addEventData(mSessionStartTime, eventData);
+	addEventData(mSessionStartTime, eventData.getData());
 }
 
 void Beacon::endSession(std::shared_ptr<core::Session> session)
@@ -299,16 +255,17 @@ void Beacon::endSession(std::shared_ptr<core::Session> session)
 		return;
 	}
 
-	core::UTF8String eventData = createBasicEventData(EventType::SESSION_END, nullptr);
+	EventWriter eventData;
+	writeBasicEventData(eventData, EventType::SESSION_END, core::UTF8StringView());
 
-	addKeyValuePair(eventData, BEACON_KEY_PARENT_ACTION_ID, 0);
-	addKeyValuePair(eventData, BEACON_KEY_START_SEQUENCE_NUMBER, createSequenceNumber());
-	addKeyValuePair(eventData, BEACON_KEY_TIME_0, getTimeSinceSessionStartTime(session->getEndTime()));
+	eventData.addKeyValuePair(BEACON_KEY_PARENT_ACTION_ID, 0);
+	eventData.addKeyValuePair(BEACON_KEY_START_SEQUENCE_NUMBER, createSequenceNumber());
+	eventData.addKeyValuePair(BEACON_KEY_TIME_0, getTimeSinceSessionStartTime(session->getEndTime()));
 
-	addEventData(session->getEndTime(), eventData);
+	addEventData(session->getEndTime(), eventData.getData());
 }
 
-void Beacon::reportValue(int32_t actionID, const core::UTF8String& valueName, int32_t value)
+void Beacon::reportValue(int32_t actionID, const core::UTF8StringView& valueName, int32_t value)
 {
 	if (std::atomic_load(&mBeaconConfiguration)->getDataCollectionLevel() != openkit::DataCollectionLevel::USER_BEHAVIOR)
 	{
@@ -316,13 +273,14 @@ void Beacon::reportValue(int32_t actionID, const core::UTF8String& valueName, in
 	}
 
 	uint64_t eventTimestamp;
-	core::UTF8String eventData = buildEvent(EventType::VALUE_INT, valueName, actionID, eventTimestamp);
-	addKeyValuePair(eventData, BEACON_KEY_VALUE, value);
+	EventWriter eventData;
+	buildEvent(eventData, EventType::VALUE_INT, valueName, actionID, eventTimestamp);
+	eventData.addKeyValuePair(BEACON_KEY_VALUE, value);
 
-	addEventData(eventTimestamp, eventData);
+	addEventData(eventTimestamp, eventData.getData());
 }
 
-void Beacon::reportValue(int32_t actionID, const core::UTF8String& valueName, double value)
+void Beacon::reportValue(int32_t actionID, const core::UTF8StringView& valueName, double value)
 {
 	if (std::atomic_load(&mBeaconConfiguration)->getDataCollectionLevel() != openkit::DataCollectionLevel::USER_BEHAVIOR)
 	{
@@ -330,14 +288,15 @@ void Beacon::reportValue(int32_t actionID, const core::UTF8String& valueName, do
 	}
 
 	uint64_t eventTimestamp;
-	core::UTF8String eventData = buildEvent(EventType::VALUE_DOUBLE, valueName, actionID, eventTimestamp);
+	EventWriter eventData;
+	buildEvent(eventData, EventType::VALUE_DOUBLE, valueName, actionID, eventTimestamp);
 
-	addKeyValuePair(eventData, BEACON_KEY_VALUE, value);
+	eventData.addKeyValuePair(BEACON_KEY_VALUE, value);
 
-	addEventData(eventTimestamp, eventData);
+	addEventData(eventTimestamp, eventData.getData());
 }
 
-void Beacon::reportValue(int32_t actionID, const core::UTF8String& valueName, const core::UTF8String& value)
+void Beacon::reportValue(int32_t actionID, const core::UTF8StringView& valueName, const core::UTF8StringView& value)
 {
 	if (std::atomic_load(&mBeaconConfiguration)->getDataCollectionLevel() != openkit::DataCollectionLevel::USER_BEHAVIOR)
 	{
@@ -345,14 +304,15 @@ void Beacon::reportValue(int32_t actionID, const core::UTF8String& valueName, co
 	}
 
 	uint64_t eventTimestamp;
-	core::UTF8String eventData = buildEvent(EventType::VALUE_STRING, valueName, actionID, eventTimestamp);
+	EventWriter eventData;
+	buildEvent(eventData, EventType::VALUE_STRING, valueName, actionID, eventTimestamp);
 
-	addKeyValuePair(eventData, BEACON_KEY_VALUE, value);
+	eventData.addKeyValuePair(BEACON_KEY_VALUE, value);
 
-	addEventData(eventTimestamp, eventData);
+	addEventData(eventTimestamp, eventData.getData());
 }
 
-void Beacon::reportEvent(int32_t actionID, const core::UTF8String& eventName)
+void Beacon::reportEvent(int32_t actionID, const core::UTF8StringView& eventName)
 {
 	if (std::atomic_load(&mBeaconConfiguration)->getDataCollectionLevel() != openkit::DataCollectionLevel::USER_BEHAVIOR)
 	{
@@ -360,12 +320,13 @@ void Beacon::reportEvent(int32_t actionID, const core::UTF8String& eventName)
 	}
 
 	uint64_t eventTimestamp;
-	core::UTF8String eventData = buildEvent(EventType::NAMED_EVENT, eventName, actionID, eventTimestamp);
+	EventWriter eventData;
+	buildEvent(eventData, EventType::NAMED_EVENT, eventName, actionID, eventTimestamp);
 
-	addEventData(eventTimestamp, eventData);
+	addEventData(eventTimestamp, eventData.getData());
 }
 
-void Beacon::reportError(int32_t actionID, const core::UTF8String& errorName, int32_t errorCode, const core::UTF8String& reason)
+void Beacon::reportError(int32_t actionID, const core::UTF8StringView& errorName, int32_t errorCode, const core::UTF8StringView& reason)
 {
 	if (!mConfiguration->isCaptureErrors())
 	{
@@ -377,21 +338,22 @@ void Beacon::reportError(int32_t actionID, const core::UTF8String& errorName, in
 		return;
 	}
 
-	core::UTF8String eventData = createBasicEventData(EventType::FAILURE_ERROR, errorName);
+	EventWriter eventData;
+	writeBasicEventData(eventData, EventType::FAILURE_ERROR, errorName);
 	uint64_t timestamp = mTimingProvider->provideTimestampInMilliseconds();
-	addKeyValuePair(eventData, BEACON_KEY_PARENT_ACTION_ID, actionID);
-	addKeyValuePair(eventData, BEACON_KEY_START_SEQUENCE_NUMBER, createSequenceNumber());
-	addKeyValuePair(eventData, BEACON_KEY_TIME_0, getTimeSinceSessionStartTime(timestamp));
-	addKeyValuePair(eventData, BEACON_KEY_ERROR_CODE, errorCode);
-	if (reason != nullptr)
+	eventData.addKeyValuePair(BEACON_KEY_PARENT_ACTION_ID, actionID);
+	eventData.addKeyValuePair(BEACON_KEY_START_SEQUENCE_NUMBER, createSequenceNumber());
+	eventData.addKeyValuePair(BEACON_KEY_TIME_0, getTimeSinceSessionStartTime(timestamp));
+	eventData.addKeyValuePair(BEACON_KEY_ERROR_CODE, errorCode);
+	if (!reason.empty())
 	{
-		addKeyValuePair(eventData, BEACON_KEY_ERROR_REASON, reason);
+		eventData.addKeyValuePair(BEACON_KEY_ERROR_REASON, reason);
 	}
 
-	addEventData(timestamp, eventData);
+	addEventData(timestamp, eventData.getData());
 }
 
-void Beacon::reportCrash(const core::UTF8String& errorName, const core::UTF8String& reason, const core::UTF8String& stacktrace)
+void Beacon::reportCrash(const core::UTF8StringView& errorName, const core::UTF8StringView& reason, const core::UTF8StringView& stacktrace)
 {
 	if (!mConfiguration->isCaptureCrashes())
 	{
@@ -403,17 +365,18 @@ void Beacon::reportCrash(const core::UTF8String& errorName, const core::UTF8Stri
 		return;
 	}
 
-	core::UTF8String eventData = createBasicEventData(EventType::FAILURE_CRASH, errorName);
+	EventWriter eventData;
+	writeBasicEventData(eventData, EventType::FAILURE_CRASH, errorName);
 
 	auto timestamp = mTimingProvider->provideTimestampInMilliseconds();
 
-	addKeyValuePair(eventData, BEACON_KEY_PARENT_ACTION_ID, 0);                                  // no parent action
-	addKeyValuePair(eventData, BEACON_KEY_START_SEQUENCE_NUMBER, createSequenceNumber());
-	addKeyValuePair(eventData, BEACON_KEY_TIME_0, getTimeSinceSessionStartTime(timestamp));
-	addKeyValuePair(eventData, BEACON_KEY_ERROR_REASON, reason);
-	addKeyValuePair(eventData, BEACON_KEY_ERROR_STACKTRACE, stacktrace);
+	eventData.addKeyValuePair(BEACON_KEY_PARENT_ACTION_ID, 0);                                  // no parent action
+	eventData.addKeyValuePair(BEACON_KEY_START_SEQUENCE_NUMBER, createSequenceNumber());
+	eventData.addKeyValuePair(BEACON_KEY_TIME_0, getTimeSinceSessionStartTime(timestamp));
+	eventData.addKeyValuePair(BEACON_KEY_ERROR_REASON, reason);
+	eventData.addKeyValuePair(BEACON_KEY_ERROR_STACKTRACE, stacktrace);
 
-	addEventData(timestamp, eventData);
+	addEventData(timestamp, eventData.getData());
 }
 
 void Beacon::addWebRequest(int32_t parentActionID, std::shared_ptr<core::WebRequestTracerBase> webRequestTracer)
@@ -423,111 +386,148 @@ void Beacon::addWebRequest(int32_t parentActionID, std::shared_ptr<core::WebRequ
 		return;
 	}
 
-	core::UTF8String eventData = createBasicEventData(EventType::WEBREQUEST, webRequestTracer->getURL());
+	EventWriter eventData;
+	writeBasicEventData(eventData, EventType::WEBREQUEST, webRequestTracer->getURL());
 
-	addKeyValuePair(eventData, BEACON_KEY_PARENT_ACTION_ID, parentActionID);
-	addKeyValuePair(eventData, BEACON_KEY_START_SEQUENCE_NUMBER, webRequestTracer->getStartSequenceNo());
-	addKeyValuePair(eventData, BEACON_KEY_TIME_0, getTimeSinceSessionStartTime(webRequestTracer->getStartTime()));
-	addKeyValuePair(eventData, BEACON_KEY_END_SEQUENCE_NUMBER, webRequestTracer->getEndSequenceNo());
-	addKeyValuePair(eventData, BEACON_KEY_TIME_1, webRequestTracer->getEndTime() - webRequestTracer->getStartTime());
+	eventData.addKeyValuePair(BEACON_KEY_PARENT_ACTION_ID, parentActionID);
+	eventData.addKeyValuePair(BEACON_KEY_START_SEQUENCE_NUMBER, webRequestTracer->getStartSequenceNo());
+	eventData.addKeyValuePair(BEACON_KEY_TIME_0, getTimeSinceSessionStartTime(webRequestTracer->getStartTime()));
+	eventData.addKeyValuePair(BEACON_KEY_END_SEQUENCE_NUMBER, webRequestTracer->getEndSequenceNo());
+	eventData.addKeyValuePair(BEACON_KEY_TIME_1, webRequestTracer->getEndTime() - webRequestTracer->getStartTime());
 
 	int32_t bytesSent = webRequestTracer->getBytesSent();
 	if (bytesSent > -1)
 	{
-		addKeyValuePair(eventData, BEACON_KEY_WEBREQUEST_BYTES_SENT, bytesSent);
+		eventData.addKeyValuePair(BEACON_KEY_WEBREQUEST_BYTES_SENT, bytesSent);
 	}
 
 	int32_t bytesReceived = webRequestTracer->getBytesReceived();
 	if (bytesReceived > -1)
 	{
-		addKeyValuePair(eventData, BEACON_KEY_WEBREQUEST_BYTES_RECEIVED, bytesReceived);
+		eventData.addKeyValuePair(BEACON_KEY_WEBREQUEST_BYTES_RECEIVED, bytesReceived);
 	}
 
 	int32_t responseCode = webRequestTracer->getResponseCode();
 	if (responseCode > -1)
 	{
-		addKeyValuePair(eventData, BEACON_KEY_WEBREQUEST_RESPONSE_CODE, responseCode);
+		eventData.addKeyValuePair(BEACON_KEY_WEBREQUEST_RESPONSE_CODE, responseCode);
 	}
 
-	addEventData(webRequestTracer->getStartTime(), eventData);
+	addEventData(webRequestTracer->getStartTime(), eventData.getData());
 }
 
-void Beacon::identifyUser(const core::UTF8String& userTag)
+void Beacon::identifyUser(const core::UTF8StringView& userTag)
 {
 	if (std::atomic_load(&mBeaconConfiguration)->getDataCollectionLevel() != openkit::DataCollectionLevel::USER_BEHAVIOR)
 	{
 		return;
 	}
 
-	core::UTF8String eventData = createBasicEventData(EventType::IDENTIFY_USER, userTag);
+	EventWriter eventData;
+	writeBasicEventData(eventData, EventType::IDENTIFY_USER, userTag);
 
 	auto timestamp = mTimingProvider->provideTimestampInMilliseconds();
 
-	addKeyValuePair(eventData, BEACON_KEY_PARENT_ACTION_ID, 0);
-	addKeyValuePair(eventData, BEACON_KEY_START_SEQUENCE_NUMBER, createSequenceNumber());
-	addKeyValuePair(eventData, BEACON_KEY_TIME_0, getTimeSinceSessionStartTime(timestamp));
+	eventData.addKeyValuePair(BEACON_KEY_PARENT_ACTION_ID, 0);
+	eventData.addKeyValuePair(BEACON_KEY_START_SEQUENCE_NUMBER, createSequenceNumber());
+	eventData.addKeyValuePair(BEACON_KEY_TIME_0, getTimeSinceSessionStartTime(timestamp));
 
-	addEventData(timestamp, eventData);
+	addEventData(timestamp, eventData.getData());
 }
 
-core::UTF8String Beacon::createMultiplicityData()
+void Beacon::writeMultiplicityData(EventWriter& writer)
 {
-	core::UTF8String multiplicityData;
-	addKeyValuePair(multiplicityData, BEACON_KEY_MULTIPLICITY, mBeaconConfiguration->getMultiplicity());
-	return multiplicityData;
+	writer.addKeyValuePair(BEACON_KEY_MULTIPLICITY, mBeaconConfiguration->getMultiplicity());
 }
 
-core::UTF8String Beacon::getMutableBeaconData()
+core::UTF8String Beacon::createChunkPrefix()
 {
-	core::UTF8String delimiter = core::UTF8String(BEACON_DATA_DELIMITER);
-
-	core::UTF8String mutableBeaconData;
+	if (mPrefixBuffer.empty())
+	{
+		// the immutable part is copied once, the buffer's capacity also covers the mutable part
+		const auto& applicationData = mImmutableBeaconData->getApplicationData().getStringData();
+		const auto& deviceData = mImmutableBeaconData->getDeviceData().getStringData();
+		const auto& sessionData = mSessionBeaconData.getStringData();
+		mPrefixBuffer.reserve(applicationData.size() + sessionData.size() + deviceData.size() + MAX_MUTABLE_BEACON_DATA_LENGTH);
+		mPrefixBuffer.append(applicationData).append(sessionData).append(deviceData);
+		mImmutablePrefixLength = mPrefixBuffer.size();
+	}
 
-	mutableBeaconData.concatenate(delimiter);
-	mutableBeaconData.concatenate(createTimestampData());
-	mutableBeaconData.concatenate(delimiter);
-	mutableBeaconData.concatenate(createMultiplicityData());
+	// only the timestamps and the multiplicity are rewritten for each chunk
+	mPrefixBuffer.resize(mImmutablePrefixLength);
+	EventWriter writer(mPrefixBuffer);
+	writeTimestampData(writer);
+	writeMultiplicityData(writer);
 
-	return mutableBeaconData;
+	return writer.getData();
 }
 
 std::shared_ptr<protocol::StatusResponse> Beacon::send(std::shared_ptr<providers::IHTTPClientProvider> clientProvider)
 {
 	std::shared_ptr<protocol::IHTTPClient> httpClient = clientProvider->createClient(mLogger, mHTTPClientConfiguration);
+	auto retryPolicy = mHTTPClientConfiguration->getBeaconRequestRetryPolicy();
 
 	std::shared_ptr<protocol::StatusResponse> response = nullptr;
 
 	while (true)
 	{
-		// prefix for this chunk - must be built up newly, due to changing timestamps
-		core::UTF8String prefix = mImmutableBasicBeaconData;
-		prefix.concatenate( getMutableBeaconData());
-
-		core::UTF8String chunk = mBeaconCache->getNextBeaconChunk(mSessionNumber, prefix, mConfiguration->getMaxBeaconSize() - 1024, BEACON_DATA_DELIMITER);
-		if (chunk == nullptr || chunk.empty())
+		auto chunk = getNextChunk();
+		if (chunk == nullptr)
 		{
 			return response;
 		}
 
-		// send the request
+		// send the request, retry transient connection failures with backoff
 		response = httpClient->sendBeaconRequest(mClientIPAddress, chunk);
-		if (response == nullptr || response->isErroneousResponse())
+		for (uint32_t retry = 0; response != nullptr && response->isConnectionErrorResponse() && retryPolicy->isRetryAllowed(retry); retry++)
 		{
-			// error happened - but don't know what exactly
-			// reset the previously retrieved chunk (restore it in internal cache) & retry another time
-			mBeaconCache->resetChunkedData(mSessionNumber);
-			break;
+			mTimingProvider->sleep(retryPolicy->getRetryDelayInMilliseconds(retry));
+			response = httpClient->sendBeaconRequest(mClientIPAddress, chunk);
 		}
-		else
+		if (!handleChunkResponse(response))
 		{
-			// worked -> remove previously retrieved chunk from cache
-			mBeaconCache->removeChunkedData(mSessionNumber);
+			break;
 		}
 	}
 
 	return response;
 }
 
+IHTTPMultiClient::RequestID Beacon::sendNextChunk(std::shared_ptr<protocol::IHTTPMultiClient> multiClient)
+{
+	auto chunk = getNextChunk();
+	if (chunk == nullptr)
+	{
+		return IHTTPMultiClient::INVALID_REQUEST_ID;
+	}
+
+	return multiClient->addBeaconRequest(mHTTPClientConfiguration, mClientIPAddress, chunk);
+}
+
+bool Beacon::handleChunkResponse(std::shared_ptr<protocol::StatusResponse> response)
+{
+	if (response == nullptr || response->isErroneousResponse())
+	{
+		// error happened - but don't know what exactly
+		// reset the previously retrieved chunk (restore it in internal cache) & retry another time
+		mBeaconCache->resetChunkedData(mSessionNumber);
+		return false;
+	}
+
+	// worked -> remove previously retrieved chunk from cache
+	mBeaconCache->removeChunkedData(mSessionNumber);
+	return true;
+}
+
+std::shared_ptr<caching::BeaconChunk> Beacon::getNextChunk()
+{
+	// prefix for this chunk - must be updated, due to changing timestamps
+	auto prefix = createChunkPrefix();
+
+	// the chunk's size is measured in bytes including the prefix, so it can be filled up to the server's limit
+	return mBeaconCache->getNextBeaconChunk(mSessionNumber, prefix, mConfiguration->getMaxBeaconSize(), BEACON_DATA_DELIMITER);
+}
+
 void Beacon::addEventData(int64_t timestamp, const core::UTF8String& eventData)
 {
 	if (mConfiguration->isCapture())
@@ -536,13 +536,9 @@ void Beacon::addEventData(int64_t timestamp, const core::UTF8String& eventData)
 	}
 }
 
-core::UTF8String Beacon::truncate(const core::UTF8String& string)
+core::UTF8StringView Beacon::truncate(const core::UTF8StringView& string)
 {
-	if (string.getStringLength() > protocol::MAX_NAME_LEN)
-	{
-		return string.substring(0, protocol::MAX_NAME_LEN);
-	}
-	return string;
+	return string.prefix(protocol::MAX_NAME_LEN);
 }
 
 int64_t Beacon::getTimeSinceSessionStartTime(int64_t timestamp)
@@ -550,6 +546,17 @@ int64_t Beacon::getTimeSinceSessionStartTime(int64_t timestamp)
 	return timestamp - mSessionStartTime;
 }
 
+int32_t Beacon::getThreadID()
+{
+	if (mDefaultThreadIDProvider != nullptr)
+	{
+		// the qualified call avoids the virtual dispatch for the default provider
+		return mDefaultThreadIDProvider->DefaultThreadIDProvider::getThreadID();
+	}
+
+	return mThreadIDProvider->getThreadID();
+}
+
 bool Beacon::isEmpty() const
 {
 	return mBeaconCache->isEmpty(mSessionNumber);
@@ -19,8 +19,10 @@
 
 #include "OpenKit/ILogger.h"
 #include "core/UTF8String.h"
+#include "core/UTF8StringView.h"
 #include "providers/ITimingProvider.h"
 #include "providers/IThreadIDProvider.h"
+#include "providers/DefaultThreadIDProvider.h"
 #include "providers/IPRNGenerator.h"
 #include "configuration/Configuration.h"
 #include "configuration/HTTPClientConfiguration.h"
@@ -30,6 +32,9 @@
 #include "core/WebRequestTracerBase.h"
 #include "caching/BeaconCache.h"
 #include "EventType.h"
+#include "EventWriter.h"
+#include "ImmutableBeaconData.h"
+#include "IHTTPMultiClient.h"
 
 #include <memory>
 #include <map>
@@ -73,6 +78,24 @@ namespace protocol
 			std::shared_ptr<providers::ITimingProvider> timingProvider, 
 			std::shared_ptr<providers::IPRNGenerator> randomGenerator);
 
+		///
+		/// Constructor for Beacon
+		/// @param[in] logger to write traces to
+		/// @param[in] beaconCache Cache storing beacon related data.
+		/// @param[in] configuration Configuration object
+		/// @param[in] clientIPAddress IP Address of the client
+		/// @param[in] threadIDProvider provider for thread ids
+		/// @param[in] timingProvider timing provider used to retrieve timestamps
+		/// @param[in] randomGenerator random number generator
+		/// @param[in] immutableBeaconData serialized basic beacon data shared by all sessions of the configuration
+		///
+		Beacon(std::shared_ptr<openkit::ILogger> logger, std::shared_ptr<caching::IBeaconCache> beaconCache,
+			std::shared_ptr<configuration::Configuration> configuration, const core::UTF8String clientIPAddress,
+			std::shared_ptr<providers::IThreadIDProvider> threadIDProvider,
+			std::shared_ptr<providers::ITimingProvider> timingProvider,
+			std::shared_ptr<providers::IPRNGenerator> randomGenerator,
+			std::shared_ptr<const ImmutableBeaconData> immutableBeaconData);
+
 		///
 		/// Destructor 
 		///
@@ -143,7 +166,7 @@ namespace protocol
 		/// @param valueName Value's name.
 		/// @param value Actual value to report.
 		///
-		virtual void reportValue(int32_t actionID, const core::UTF8String& valueName, int32_t value);
+		virtual void reportValue(int32_t actionID, const core::UTF8StringView& valueName, int32_t value);
 
 		///
 		/// Add key-value-pair to Beacon.
@@ -154,7 +177,7 @@ namespace protocol
 		/// @param valueName Value's name.
 		/// @param value Actual value to report.
 		///
-		virtual void reportValue(int32_t actionID, const core::UTF8String& valueName, double value);
+		virtual void reportValue(int32_t actionID, const core::UTF8StringView& valueName, double value);
 
 		///
 		/// Add key-value-pair to Beacon.
@@ -165,7 +188,7 @@ namespace protocol
 		/// @param valueName Value's name.
 		/// @param value Actual value to report.
 		///
-		virtual void reportValue(int32_t actionID, const core::UTF8String& valueName, const core::UTF8String& value);
+		virtual void reportValue(int32_t actionID, const core::UTF8StringView& valueName, const core::UTF8StringView& value);
 
 		///
 		/// Add event (aka. named event) to Beacon.
@@ -175,7 +198,7 @@ namespace protocol
 		/// @param actionID The id of the @ref core::Action on which this event was reported.
 		/// @param eventName Event's name.
 		///
-		virtual void reportEvent(int32_t actionID, const core::UTF8String& eventName);
+		virtual void reportEvent(int32_t actionID, const core::UTF8StringView& eventName);
 
 		///
 		/// Add error to Beacon.
@@ -187,7 +210,7 @@ namespace protocol
 		/// @param errorCode Some error code.
 		/// @param reason Reason for that error.
 		///
-		virtual void reportError(int32_t actionID, const core::UTF8String& errorName, int32_t errorCode, const core::UTF8String& reason);
+		virtual void reportError(int32_t actionID, const core::UTF8StringView& errorName, int32_t errorCode, const core::UTF8StringView& reason);
 
 		///
 		/// Add crash to Beacon
@@ -196,7 +219,7 @@ namespace protocol
 		/// @param[in] reason Reason for that error.
 		/// @param[in] stacktrace Crash stacktrace.
 		///
-		virtual void reportCrash(const core::UTF8String& errorName, const core::UTF8String& reason, const core::UTF8String& stacktrace);
+		virtual void reportCrash(const core::UTF8StringView& errorName, const core::UTF8StringView& reason, const core::UTF8StringView& stacktrace);
 
 		///
 		/// Add @ref core::WebRequestTracerBase to Beacon
@@ -211,15 +234,34 @@ namespace protocol
 		/// The serialized data is added to @ref caching::BeaconCache
 		/// @param[in] userTag User tag containing data to serialize.
 		///
-		virtual void identifyUser(const core::UTF8String& userTag);
+		virtual void identifyUser(const core::UTF8StringView& userTag);
 
 		/// 
 		/// Sends the current Beacon state
+		/// Chunks failing on connection level are retried according to the beacon request retry policy.
 		/// @param[in] clientProvider the @ref providers::IHTTPClientProvider to use for sending
 		/// @returns the status response returned for the Beacon data
 		///
 		virtual std::shared_ptr<protocol::StatusResponse> send(std::shared_ptr<providers::IHTTPClientProvider> clientProvider);
 
+		///
+		/// Start sending the next chunk of the current Beacon state, without waiting for the response.
+		///
+		/// The response must be passed to @ref handleChunkResponse, before the next chunk can be sent.
+		/// @param[in] multiClient the client used for sending the chunk
+		/// @returns the ID of the request sending the chunk or @ref IHTTPMultiClient::INVALID_REQUEST_ID if there is no more data
+		///
+		virtual IHTTPMultiClient::RequestID sendNextChunk(std::shared_ptr<protocol::IHTTPMultiClient> multiClient);
+
+		///
+		/// Handle the response received for the chunk sent last.
+		///
+		/// On success the chunk is removed from the beacon cache, otherwise it is restored to be sent again later.
+		/// @param[in] response the response received for the chunk or @c nullptr if sending was aborted
+		/// @returns @c true if the chunk was sent successfully, @c false otherwise
+		///
+		virtual bool handleChunkResponse(std::shared_ptr<protocol::StatusResponse> response);
+
 		///
 		/// Tests if the Beacon is empty
 		/// 
@@ -261,75 +303,41 @@ namespace protocol
 
 	private:
 		///
-		/// Serialization helper method for creating basic beacon protocol data.
-		/// @returns Serialized data
+		/// Get the next chunk of beacon data to send, including the beacon's prefix.
+		/// The chunk references the cached records and is valid until the sent data is removed or reset.
+		/// @returns the next chunk or @c nullptr if there is no more data
+		///
+		std::shared_ptr<caching::BeaconChunk> getNextChunk();
+
+		///
+		/// Serialization helper method for creating the session specific part of the basic beacon protocol data.
+		/// @returns Serialized data, starting with a delimiter
 		///
-		core::UTF8String createImmutableBeaconData();
+		core::UTF8String createSessionBeaconData();
 
 		///
-		/// Serialization helper method for creating basic event data
-		/// @return Serialized data
+		/// Serialization helper method for writing basic event data
+		/// @param[in,out] writer the writer to which the data is appended
+		/// @param[in] eventType The event's type.
+		/// @param[in] eventName The event's name.
 		///
-		core::UTF8String createBasicEventData(EventType eventType, const core::UTF8String& eventName);
+		void writeBasicEventData(EventWriter& writer, EventType eventType, const core::UTF8StringView& eventName);
 
 		///
-		/// Serialization helper method for creating basic timestamp data.
-		/// @return Serialized data
+		/// Serialization helper method for writing basic timestamp data.
+		/// @param[in,out] writer the writer to which the data is appended
 		///
-		core::UTF8String createTimestampData();
+		void writeTimestampData(EventWriter& writer);
 
 		///
 		/// Serialization helper for event data.
+		/// @param[in,out] writer the writer to which the event data is appended
 		/// @param[in] eventType The event's type.
 		/// @param[in] name Event name
 		/// @param[in] parentActionID The ID of the action on which this event was reported.
 		/// @param[inout] eventTimestamp uint64_t var that will be filled with the event timestamp
-		/// @return The timestamp associated with the event(timestamp since session start time).
-		///
-		core::UTF8String buildEvent(EventType eventType, const core::UTF8String& name, int32_t parentActionID, uint64_t& eventTimestamp);
-
-		///
-		/// Serialization helper method for appending a key.
-		/// @param[in] s reference to string containing serialized data
-		/// @param[in] key key to append to string
-		///
-		void appendKey(core::UTF8String& s, const core::UTF8String& key);
-
-		///
-		/// Serialization helper method for adding key/value pairs with string values
-		/// @param[in,out] s reference to string containing serialized data
-		/// @param[in] key key to append to string
-		/// @param[in] value the string value to add
-		/// @returns the serialization data including the new key value pair
-		///
-		void addKeyValuePair(core::UTF8String& s, const core::UTF8String& key, const core::UTF8String& value);
-
-		///
-		/// Serialization helper method for adding key/value pairs with int32 values
-		/// @param[in,out] s reference to string containing serialized data
-		/// @param[in] key key to append to string
-		/// @param[in] value the integer value to add
-		/// @returns the serialization data including the new key value pair
-		///
-		void addKeyValuePair(core::UTF8String& s, const core::UTF8String& key, int32_t value);
-
 		///
-		/// Serialization helper method for adding key/value pairs with int64 values
-		/// @param[in,out] s reference to string containing serialized data
-		/// @param[in] key key to append to string
-		/// @param[in] value the long value to add
-		/// @returns the serialization data including the new key value pair
-		///
-		void addKeyValuePair(core::UTF8String& s, const core::UTF8String& key, int64_t value);
-
-		///
-		/// Serialization helper method for adding key/value pairs with double values
-		/// @param[in,out] s reference to string containing serialized data
-		/// @param[in] key key to append to string
-		/// @param[in] value the double value to add
-		/// @returns the serialization data including the new key value pair
-		///
-		void addKeyValuePair(core::UTF8String& s, const core::UTF8String& key, double value);
+		void buildEvent(EventWriter& writer, EventType eventType, const core::UTF8StringView& name, int32_t parentActionID, uint64_t& eventTimestamp);
 
 		///
 		/// helper method for truncating name at max name size
@@ -337,7 +345,7 @@ namespace protocol
 		/// @param[in] string string to truncate
 		/// @returns the truncated string
 		///
-		static core::UTF8String truncate(const core::UTF8String& string);
+		static core::UTF8StringView truncate(const core::UTF8StringView& string);
 
 		///
 		/// Get a timestamp relative to the time this session (aka. beacon) was created.
@@ -346,6 +354,12 @@ namespace protocol
 		///
 		int64_t getTimeSinceSessionStartTime(int64_t timestamp);
 
+		///
+		/// Get the ID of the current thread
+		/// @return the thread ID
+		///
+		int32_t getThreadID();
+
 		///
 		/// Add previously serialized action data to the beacon list
 		/// @param[in] timestamp The timestamp when the action data occurred.
@@ -361,17 +375,19 @@ namespace protocol
 		void addEventData(int64_t timestamp, const core::UTF8String& eventData);
 
 		///
-		/// Generate serialization for the mutable part of the beaon
-		/// e.g. multiplicity and timestamp
-		/// @returns the mutable beacon data
+		/// Generate the prefix of the next chunk, consisting of the basic beacon data followed by
+		/// the mutable part of the beacon, e.g. multiplicity and timestamp.
+		///
+		/// The basic beacon data is kept in @c mPrefixBuffer, so only the mutable part is serialized for each chunk.
+		/// @returns the chunk prefix
 		///
-		core::UTF8String getMutableBeaconData();
+		core::UTF8String createChunkPrefix();
 
 		///
-		/// Generate multiplicity data
-		/// @return the multiplicity data
+		/// Write multiplicity data
+		/// @param[in,out] writer the writer to which the data is appended
 		///
-		core::UTF8String createMultiplicityData();
+		void writeMultiplicityData(EventWriter& writer);
 
 	private:
 		/// Logger to write traces to
@@ -389,6 +405,9 @@ namespace protocol
 		/// thread id provider
 		std::shared_ptr<providers::IThreadIDProvider> mThreadIDProvider;
 
+		/// @c mThreadIDProvider if it is a @ref providers::DefaultThreadIDProvider, @c nullptr otherwise
+		providers::DefaultThreadIDProvider* mDefaultThreadIDProvider;
+
 		/// sequence number
 		std::atomic<int32_t> mSequenceNumber;
 
@@ -401,8 +420,17 @@ namespace protocol
 		/// session start time
 		int64_t mSessionStartTime;
 
-		/// basic beacon data
-		core::UTF8String mImmutableBasicBeaconData;
+		/// basic beacon data shared by all sessions
+		std::shared_ptr<const ImmutableBeaconData> mImmutableBeaconData;
+
+		/// session specific basic beacon data
+		core::UTF8String mSessionBeaconData;
+
+		/// buffer holding the basic beacon data, followed by the mutable data of the last chunk prefix
+		std::string mPrefixBuffer;
+
+		/// length of the basic beacon data in @c mPrefixBuffer
+		std::string::size_type mImmutablePrefixLength;
 
 		///cache for beacons
 		std::shared_ptr<caching::IBeaconCache> mBeaconCache;
@@ -0,0 +1,222 @@
+/**
+* Copyright 2018 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "CurlHandlePool.h"
+
+using namespace protocol;
+
+CurlHandlePool::CurlHandlePool(size_t maxIdleHandles, std::chrono::milliseconds idleTimeout)
+	: mMaxIdleHandles(maxIdleHandles)
+	, mIdleTimeout(idleTimeout)
+	, mMutex()
+	, mIdleHandles()
+	, mIdleCompressors()
+	, mNumHandlesInUse(0)
+	, mLastUsed(std::chrono::steady_clock::now())
+	, mShare(nullptr)
+	, mShareLocks()
+{
+}
+
+CurlHandlePool::~CurlHandlePool()
+{
+	clear();
+	if (mShare != nullptr)
+	{
+		curl_share_cleanup(mShare);
+		mShare = nullptr;
+	}
+}
+
+CURL* CurlHandlePool::acquire()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+
+	auto now = std::chrono::steady_clock::now();
+	if (now - mLastUsed > mIdleTimeout)
+	{
+		discardIdleConnections();
+	}
+	mLastUsed = now;
+
+	CURL* handle = nullptr;
+	if (!mIdleHandles.empty())
+	{
+		// pooled handles already have the share object attached
+		handle = mIdleHandles.back();
+		mIdleHandles.pop_back();
+	}
+	else
+	{
+		handle = curl_easy_init();
+		if (handle == nullptr)
+		{
+			return nullptr;
+		}
+		if (mMaxIdleHandles > 0)
+		{
+			// without pooling no connection is ever reused, so sharing the caches is pointless
+			createShare();
+			curl_easy_setopt(handle, CURLOPT_SHARE, mShare);
+		}
+	}
+
+	mNumHandlesInUse++;
+
+	return handle;
+}
+
+void CurlHandlePool::release(CURL* handle)
+{
+	if (handle == nullptr)
+	{
+		return;
+	}
+
+	// reset the options now, so that no references to the previous request's data are kept
+	// the connections and the share object are kept by curl_easy_reset
+	curl_easy_reset(handle);
+
+	std::lock_guard<std::mutex> lock(mMutex);
+	mNumHandlesInUse--;
+	mLastUsed = std::chrono::steady_clock::now();
+
+	if (mIdleHandles.size() < mMaxIdleHandles)
+	{
+		mIdleHandles.push_back(handle);
+	}
+	else
+	{
+		curl_easy_cleanup(handle);
+	}
+}
+
+std::unique_ptr<base::util::StreamingCompressor> CurlHandlePool::acquireCompressor()
+{
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		if (!mIdleCompressors.empty())
+		{
+			auto compressor = std::move(mIdleCompressors.back());
+			mIdleCompressors.pop_back();
+			return compressor;
+		}
+	}
+
+	return std::unique_ptr<base::util::StreamingCompressor>(new base::util::StreamingCompressor());
+}
+
+void CurlHandlePool::releaseCompressor(std::unique_ptr<base::util::StreamingCompressor> compressor)
+{
+	if (compressor == nullptr)
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(mMutex);
+	if (mIdleCompressors.size() < mMaxIdleHandles)
+	{
+		// the compressor keeps its zlib stream, which is reset for the next payload
+		mIdleCompressors.push_back(std::move(compressor));
+	}
+}
+
+void CurlHandlePool::clear()
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	mIdleCompressors.clear();
+
+	for (auto handle : mIdleHandles)
+	{
+		curl_easy_cleanup(handle);
+	}
+	mIdleHandles.clear();
+
+	// releases the share object too, unless it is still referenced by handles in use
+	discardIdleConnections();
+}
+
+size_t CurlHandlePool::getNumberOfIdleHandles() const
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	return mIdleHandles.size();
+}
+
+bool CurlHandlePool::hasShare() const
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	return mShare != nullptr;
+}
+
+size_t CurlHandlePool::getNumberOfIdleCompressors() const
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	return mIdleCompressors.size();
+}
+
+void CurlHandlePool::lockShare(CURL* /*handle*/, curl_lock_data data, curl_lock_access /*access*/, void* userPtr)
+{
+	static_cast<CurlHandlePool*>(userPtr)->mShareLocks[data].lock();
+}
+
+void CurlHandlePool::unlockShare(CURL* /*handle*/, curl_lock_data data, void* userPtr)
+{
+	static_cast<CurlHandlePool*>(userPtr)->mShareLocks[data].unlock();
+}
+
+void CurlHandlePool::createShare()
+{
+	if (mShare != nullptr)
+	{
+		return;
+	}
+
+	mShare = curl_share_init();
+	if (mShare == nullptr)
+	{
+		// handles work without share object, just without sharing caches
+		return;
+	}
+
+	curl_share_setopt(mShare, CURLSHOPT_LOCKFUNC, &CurlHandlePool::lockShare);
+	curl_share_setopt(mShare, CURLSHOPT_UNLOCKFUNC, &CurlHandlePool::unlockShare);
+	curl_share_setopt(mShare, CURLSHOPT_USERDATA, this);
+	curl_share_setopt(mShare, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+	curl_share_setopt(mShare, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+	curl_share_setopt(mShare, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+}
+
+void CurlHandlePool::discardIdleConnections()
+{
+	if (mNumHandlesInUse > 0)
+	{
+		// the share object is still referenced by handles in use
+		return;
+	}
+
+	// handles must be cleaned up first, since they are still attached to the share object
+	for (auto handle : mIdleHandles)
+	{
+		curl_easy_cleanup(handle);
+	}
+	mIdleHandles.clear();
+
+	if (mShare != nullptr)
+	{
+		curl_share_cleanup(mShare);
+		mShare = nullptr;
+	}
+}
@@ -0,0 +1,183 @@
+/**
+* Copyright 2018 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef _PROTOCOL_CURLHANDLEPOOL_H
+#define _PROTOCOL_CURLHANDLEPOOL_H
+
+#include "curl/curl.h"
+#include "core/util/StreamingCompressor.h"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace protocol
+{
+	///
+	/// Pool of curl easy handles shared by all @ref HTTPClient instances of one OpenKit.
+	///
+	/// All handles are attached to a common curl share object, which holds the DNS cache, the TLS session cache
+	/// and the connection cache, unless the pool size is 0. Therefore subsequent requests to the same endpoint reuse an established
+	/// (keep-alive) connection instead of doing a new TCP and TLS handshake.
+	/// If the pool was not used for longer than the idle timeout, the cached handles and connections are discarded
+	/// when the next handle is acquired, since the server has most likely closed the connections in the mean time.
+	/// The pool also keeps the compressors of finished requests, so that zlib's state is not allocated for each request.
+	///
+	/// This class is thread safe.
+	///
+	class CurlHandlePool
+	{
+	public:
+		///
+		/// Constructor
+		/// @param[in] maxIdleHandles maximum number of handles kept in the pool for reuse
+		/// @param[in] idleTimeout duration after which unused handles and connections are discarded
+		///
+		CurlHandlePool(size_t maxIdleHandles, std::chrono::milliseconds idleTimeout);
+
+		///
+		/// Destructor
+		///
+		/// All handles must have been released before.
+		///
+		~CurlHandlePool();
+
+		///
+		/// Delete the copy constructor
+		///
+		CurlHandlePool(const CurlHandlePool&) = delete;
+
+		///
+		/// Delete the assignment operator
+		///
+		CurlHandlePool& operator = (const CurlHandlePool&) = delete;
+
+		///
+		/// Get a curl easy handle, either a pooled one or a new one.
+		///
+		/// The handle's options are in their default state, except that the share object (if any) is attached.
+		/// Note that @c curl_easy_reset keeps the share object attached.
+		/// @return the curl easy handle or @c nullptr if curl failed to create a new handle
+		///
+		CURL* acquire();
+
+		///
+		/// Give a handle obtained via @ref acquire back to the pool.
+		///
+		/// If the pool is already full the handle is cleaned up.
+		/// @param[in] handle the handle to release
+		///
+		void release(CURL* handle);
+
+		///
+		/// Get a compressor for a request's payload, either a pooled one or a new one.
+		/// @return the compressor
+		///
+		std::unique_ptr<base::util::StreamingCompressor> acquireCompressor();
+
+		///
+		/// Give a compressor obtained via @ref acquireCompressor back to the pool.
+		///
+		/// If the pool is already full the compressor is destroyed.
+		/// @param[in] compressor the compressor to release
+		///
+		void releaseCompressor(std::unique_ptr<base::util::StreamingCompressor> compressor);
+
+		///
+		/// Clean up all handles and compressors currently in the pool and the share object, if no handle is in use.
+		///
+		/// Must be called before @c curl_global_cleanup.
+		///
+		void clear();
+
+		///
+		/// Get the number of handles currently in the pool.
+		///
+		/// This method shall only be used for testing purposes.
+		///
+		size_t getNumberOfIdleHandles() const;
+
+		///
+		/// Get a flag if the curl share object currently exists.
+		///
+		/// This method shall only be used for testing purposes.
+		///
+		bool hasShare() const;
+
+		///
+		/// Get the number of compressors currently in the pool.
+		///
+		/// This method shall only be used for testing purposes.
+		///
+		size_t getNumberOfIdleCompressors() const;
+
+	private:
+		///
+		/// Lock callback for the curl share object
+		///
+		static void lockShare(CURL* handle, curl_lock_data data, curl_lock_access access, void* userPtr);
+
+		///
+		/// Unlock callback for the curl share object
+		///
+		static void unlockShare(CURL* handle, curl_lock_data data, void* userPtr);
+
+		///
+		/// Create the curl share object, if there is none yet.
+		///
+		void createShare();
+
+		///
+		/// Clean up all pooled handles and the share object, if no handle is in use.
+		///
+		/// The caller must hold @c mMutex.
+		///
+		void discardIdleConnections();
+
+	private:
+		/// maximum number of handles kept in the pool
+		const size_t mMaxIdleHandles;
+
+		/// duration after which unused handles and connections are discarded
+		const std::chrono::milliseconds mIdleTimeout;
+
+		/// mutex protecting the pool's state
+		mutable std::mutex mMutex;
+
+		/// handles available for reuse
+		std::vector<CURL*> mIdleHandles;
+
+		/// compressors available for reuse
+		std::vector<std::unique_ptr<base::util::StreamingCompressor>> mIdleCompressors;
+
+		/// number of handles acquired, but not released yet
+		size_t mNumHandlesInUse;
+
+		/// point in time, when the pool was used the last time
+		std::chrono::steady_clock::time_point mLastUsed;
+
+		/// curl share object holding DNS, TLS session and connection cache
+		CURLSH* mShare;
+
+		/// one mutex per data type shared via @c mShare
+		std::array<std::mutex, CURL_LOCK_DATA_LAST> mShareLocks;
+	};
+}
+
+#endif
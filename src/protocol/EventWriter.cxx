@@ -0,0 +1,164 @@
+/**
+* Copyright 2018 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "EventWriter.h"
+#include "core/util/URLEncoding.h"
+
+#include <cstdio>
+
+using namespace protocol;
+
+/// initial capacity of each thread's serialization buffer, which is sufficient for most events
+static constexpr std::string::size_type INITIAL_BUFFER_CAPACITY = 1024;
+
+namespace
+{
+	///
+	/// Serialization buffer which is shared by all writers on the same thread
+	///
+	struct ThreadLocalBuffer
+	{
+		ThreadLocalBuffer()
+			: data()
+			, inUse(false)
+		{
+			data.reserve(INITIAL_BUFFER_CAPACITY);
+		}
+
+		std::string data;
+		bool inUse;
+	};
+
+	ThreadLocalBuffer& getThreadLocalBuffer()
+	{
+		static thread_local ThreadLocalBuffer buffer;
+		return buffer;
+	}
+
+	bool tryAcquireThreadLocalBuffer()
+	{
+		auto& buffer = getThreadLocalBuffer();
+		if (buffer.inUse)
+		{
+			return false;
+		}
+		buffer.inUse = true;
+		return true;
+	}
+}
+
+EventWriter::EventWriter()
+	: mPrivateBuffer()
+	, mUsesThreadLocalBuffer(tryAcquireThreadLocalBuffer())
+	, mBuffer(mUsesThreadLocalBuffer ? getThreadLocalBuffer().data : mPrivateBuffer)
+{
+	mBuffer.clear();
+}
+
+EventWriter::EventWriter(std::string& buffer)
+	: mPrivateBuffer()
+	, mUsesThreadLocalBuffer(false)
+	, mBuffer(buffer)
+{
+}
+
+EventWriter::~EventWriter()
+{
+	if (mUsesThreadLocalBuffer)
+	{
+		getThreadLocalBuffer().inUse = false;
+	}
+}
+
+void EventWriter::appendKey(const char* key)
+{
+	if (!mBuffer.empty())
+	{
+		mBuffer.push_back('&');
+	}
+
+	mBuffer.append(key);
+	mBuffer.push_back('=');
+}
+
+void EventWriter::appendInteger(int64_t value)
+{
+	char digits[24];
+	char* end = digits + sizeof(digits);
+	char* begin = end;
+
+	// compute the magnitude in unsigned arithmetic, so that the minimum value does not overflow
+	uint64_t magnitude = value < 0 ? uint64_t(0) - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+	do
+	{
+		*--begin = static_cast<char>('0' + (magnitude % 10));
+		magnitude /= 10;
+	} while (magnitude != 0);
+
+	if (value < 0)
+	{
+		*--begin = '-';
+	}
+
+	mBuffer.append(begin, end - begin);
+}
+
+void EventWriter::addKeyValuePair(const char* key, const core::UTF8StringView& value)
+{
+	appendKey(key);
+	core::util::URLEncoding::urlencode(value.getData(), value.getByteLength(), mBuffer);
+}
+
+void EventWriter::addKeyValuePair(const char* key, int32_t value)
+{
+	appendKey(key);
+	appendInteger(value);
+}
+
+void EventWriter::addKeyValuePair(const char* key, int64_t value)
+{
+	appendKey(key);
+	appendInteger(value);
+}
+
+void EventWriter::addKeyValuePair(const char* key, double value)
+{
+	appendKey(key);
+
+	// same format as std::to_string(double)
+	char formatted[64];
+	auto length = snprintf(formatted, sizeof(formatted), "%f", value);
+	if (length < 0 || static_cast<size_t>(length) >= sizeof(formatted))
+	{
+		// very large values don't fit into the local buffer
+		mBuffer.append(std::to_string(value));
+	}
+	else
+	{
+		mBuffer.append(formatted, length);
+	}
+}
+
+bool EventWriter::empty() const
+{
+	return mBuffer.empty();
+}
+
+core::UTF8String EventWriter::getData() const
+{
+	// keys, numbers and URL-encoded values only consist of US-ASCII characters
+	return core::UTF8String::fromASCII(mBuffer);
+}
@@ -0,0 +1,137 @@
+/**
+* Copyright 2018 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef _PROTOCOL_EVENTWRITER_H
+#define _PROTOCOL_EVENTWRITER_H
+
+#include "core/UTF8String.h"
+#include "core/UTF8StringView.h"
+
+#include <cstdint>
+#include <string>
+
+namespace protocol
+{
+	///
+	/// Streaming serializer for beacon protocol key/value pairs.
+	///
+	/// The writer appends @c key=value fragments, separated by @c &, directly into a byte buffer.
+	/// Values are URL-encoded and numbers are formatted in place, so no intermediate strings are created.
+	///
+	/// By default the pre-reserved serialization buffer of the calling thread is used, which means
+	/// that serializing an event only allocates memory once, when @ref getData is called.
+	/// If the calling thread's buffer is already in use by another writer, a private buffer is used instead.
+	/// Alternatively a writer can append to a buffer owned by the caller, which allows rewriting only the
+	/// trailing part of previously serialized data.
+	///
+	class EventWriter
+	{
+	public:
+		///
+		/// Constructor creating an empty writer
+		///
+		EventWriter();
+
+		///
+		/// Constructor creating a writer, which appends to the given buffer.
+		///
+		/// The buffer's existing content is kept, so the first key/value pair is preceded by @c &
+		/// if the buffer is not empty. The buffer must outlive the writer.
+		/// @param[in,out] buffer the buffer to which data is appended
+		///
+		explicit EventWriter(std::string& buffer);
+
+		///
+		/// Destructor releasing the serialization buffer
+		///
+		~EventWriter();
+
+		///
+		/// Delete the copy constructor
+		///
+		EventWriter(const EventWriter&) = delete;
+
+		///
+		/// Delete the assignment operator
+		///
+		EventWriter& operator = (const EventWriter&) = delete;
+
+		///
+		/// Append a key/value pair with a string value
+		/// @param[in] key the key to append, which must not require URL-encoding
+		/// @param[in] value the string value, which is URL-encoded
+		///
+		void addKeyValuePair(const char* key, const core::UTF8StringView& value);
+
+		///
+		/// Append a key/value pair with an int32 value
+		/// @param[in] key the key to append, which must not require URL-encoding
+		/// @param[in] value the integer value to add
+		///
+		void addKeyValuePair(const char* key, int32_t value);
+
+		///
+		/// Append a key/value pair with an int64 value
+		/// @param[in] key the key to append, which must not require URL-encoding
+		/// @param[in] value the long value to add
+		///
+		void addKeyValuePair(const char* key, int64_t value);
+
+		///
+		/// Append a key/value pair with a double value
+		/// @param[in] key the key to append, which must not require URL-encoding
+		/// @param[in] value the double value to add
+		///
+		void addKeyValuePair(const char* key, double value);
+
+		///
+		/// Returns whether anything was written so far
+		/// @returns @c true if no data was written, @c false otherwise
+		///
+		bool empty() const;
+
+		///
+		/// Returns the serialized data written so far
+		/// @returns the serialized data
+		///
+		core::UTF8String getData() const;
+
+	private:
+		///
+		/// Append the key and the @c = sign, preceded by @c & if the buffer is not empty
+		/// @param[in] key the key to append
+		///
+		void appendKey(const char* key);
+
+		///
+		/// Append the decimal representation of the given integer
+		/// @param[in] value the integer to append
+		///
+		void appendInteger(int64_t value);
+
+	private:
+		/// private buffer used if the thread local buffer is not available
+		std::string mPrivateBuffer;
+
+		/// flag indicating whether this writer owns the thread local buffer
+		bool mUsesThreadLocalBuffer;
+
+		/// the buffer to which data is written
+		std::string& mBuffer;
+	};
+}
+
+#endif
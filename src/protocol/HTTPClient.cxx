@@ -15,8 +15,6 @@
 */
 
 #include <cstdint>
-#include <chrono>
-#include <thread>
 #include <algorithm>
 #include <string>
 #include <cctype>
@@ -26,30 +24,35 @@
 #include "HTTPClient.h"
 #include "HTTPResponseParser.h"
 #include "ProtocolConstants.h"
-#include "core/util/Compressor.h"
 #include "core/util/URLEncoding.h"
 #include "protocol/ssl/SSLStrictTrustManager.h"
 
 // connection constants
-constexpr uint32_t MAX_SEND_RETRIES = 3;	// max number of retries of the HTTP GET or POST operation
-constexpr uint32_t RETRY_SLEEP_TIME = 200;	// retry sleep time in ms
 constexpr uint64_t CONNECT_TIMEOUT = 5;		// Time-out connect operations after this amount of seconds
 constexpr uint64_t READ_TIMEOUT = 30;		// Time-out the read operation after this amount of seconds
 
 using namespace protocol;
 using namespace base::util;
 
-HTTPClient::HTTPClient(std::shared_ptr<openkit::ILogger> logger, const std::shared_ptr<configuration::HTTPClientConfiguration> configuration)
+HTTPClient::HTTPClient(std::shared_ptr<openkit::ILogger> logger, const std::shared_ptr<configuration::HTTPClientConfiguration> configuration, std::shared_ptr<CurlHandlePool> handlePool)
 	: mLogger(logger)
+	, mHandlePool(handlePool)
 	, mCurl(nullptr)
 	, mServerID(configuration->getServerID())
 	, mMonitorURL()
 	, mTimeSyncURL()
-	, mReadBuffer()
-	, mReadBufferPos(0)
+	, mCompressor(nullptr)
+	, mPostData(nullptr)
 	, mSSLTrustManager(nullptr)
 	, mNewSessionURL()
+	, mResponseParser()
+	, mHeaderList(nullptr)
 {
+	if (mHandlePool == nullptr)
+	{
+		mHandlePool = std::make_shared<CurlHandlePool>(configuration->getHTTPClientPoolSize(), std::chrono::milliseconds(configuration->getHTTPClientIdleTimeout()));
+	}
+
 	// build the beacon URLs
 	buildMonitorURL(mMonitorURL, configuration->getBaseURL(), configuration->getApplicationID(), mServerID);
 	buildTimeSyncURL(mTimeSyncURL, configuration->getBaseURL());
@@ -69,20 +72,21 @@ HTTPClient::HTTPClient(std::shared_ptr<openkit::ILogger> logger, const std::shar
 
 HTTPClient::~HTTPClient()
 {
+	releaseCurlHandle();
 }
 
 std::shared_ptr<StatusResponse> HTTPClient::sendStatusRequest()
 {
-	auto response = sendRequestInternal(RequestType::STATUS, mMonitorURL, core::UTF8String(""), core::UTF8String(""), HttpMethod::GET);
+	auto response = sendRequestInternal(RequestType::STATUS, mMonitorURL, core::UTF8String(""), nullptr, HttpMethod::GET);
 
 	return response != nullptr
 		? std::static_pointer_cast<StatusResponse>(response)
 		: std::make_shared<StatusResponse>(mLogger, core::UTF8String(), std::numeric_limits<int32_t>::max(), Response::ResponseHeaders());
 }
 
-std::shared_ptr<StatusResponse> HTTPClient::sendBeaconRequest(const core::UTF8String& clientIPAddress, const core::UTF8String& beaconData)
+std::shared_ptr<StatusResponse> HTTPClient::sendBeaconRequest(const core::UTF8String& clientIPAddress, std::shared_ptr<const caching::BeaconChunk> beaconChunk)
 {
-	auto response = sendRequestInternal(RequestType::BEACON, mMonitorURL, clientIPAddress, beaconData, HttpMethod::POST);
+	auto response = sendRequestInternal(RequestType::BEACON, mMonitorURL, clientIPAddress, beaconChunk, HttpMethod::POST);
 
 	return response != nullptr
 		? std::static_pointer_cast<StatusResponse>(response)
@@ -91,7 +95,7 @@ std::shared_ptr<StatusResponse> HTTPClient::sendBeaconRequest(const core::UTF8St
 
 std::shared_ptr<TimeSyncResponse> HTTPClient::sendTimeSyncRequest()
 {
-	auto response = sendRequestInternal(RequestType::TIMESYNC, mTimeSyncURL, core::UTF8String(""), core::UTF8String("") , HttpMethod::GET);
+	auto response = sendRequestInternal(RequestType::TIMESYNC, mTimeSyncURL, core::UTF8String(""), nullptr, HttpMethod::GET);
 
 	return response != nullptr
 		? std::static_pointer_cast<TimeSyncResponse>(response)
@@ -100,7 +104,7 @@ std::shared_ptr<TimeSyncResponse> HTTPClient::sendTimeSyncRequest()
 
 std::shared_ptr<StatusResponse> HTTPClient::sendNewSessionRequest()
 {
-	auto response = sendRequestInternal(RequestType::NEW_SESSION, mNewSessionURL, core::UTF8String(""), core::UTF8String(""), HttpMethod::GET);
+	auto response = sendRequestInternal(RequestType::NEW_SESSION, mNewSessionURL, core::UTF8String(""), nullptr, HttpMethod::GET);
 
 	return response != nullptr
 		? std::static_pointer_cast<StatusResponse>(response)
@@ -120,6 +124,7 @@ void HTTPClient::globalDestroy()
 
 ///
 /// Callback function for reading data to upload (=the data in a POST request).
+/// The data is compressed on the fly, so the compressed data is never held in memory as a whole.
 /// @param[in,out] ptr where the data to POST is written
 /// @param[in] elementSize of the data
 /// @param[in] numberOfElements number of data (size of the written data = elementSize * numberOfElements)
@@ -131,18 +136,40 @@ size_t HTTPClient::readFunction(void *ptr, size_t elementSize, size_t numberOfEl
 	if (userPtr)
 	{
 		HTTPClient *_this = (HTTPClient*)userPtr;
-		size_t available = (_this->mReadBuffer.size() - _this->mReadBufferPos);
+		size_t written = _this->mCompressor->read(ptr, elementSize * numberOfElements);
+		if (_this->mCompressor->hasError())
+		{
+			_this->mLogger->error("HTTPClient readFunction() - compressing the beacon data failed");
+			return CURL_READFUNC_ABORT;
+		}
+		return written;
+	}
 
-		if (available > 0)
+	return 0;
+}
+
+///
+/// Callback function invoked when curl needs to send the data to upload again,
+/// e.g. when a reused connection turned out to be closed by the server.
+/// @param[in] userPtr the user data to upload is read from there
+/// @param[in] offset the position to seek to
+/// @param[in] origin the origin of @c offset (SEEK_SET, SEEK_CUR or SEEK_END)
+/// @return @c CURL_SEEKFUNC_OK if the upload was rewound, @c CURL_SEEKFUNC_CANTSEEK otherwise
+///
+int HTTPClient::seekFunction(void* userPtr, curl_off_t offset, int origin)
+{
+	if (userPtr)
+	{
+		HTTPClient *_this = (HTTPClient*)userPtr;
+
+		// the compressed data can only be rewound to its start
+		if (origin == SEEK_SET && offset == 0 && _this->mPostData != nullptr && _this->mCompressor->reset(_this->mPostData->getSegments()))
 		{
-			size_t written = std::min(elementSize * numberOfElements, available);
-			memcpy(ptr, ((char*)(_this->mReadBuffer.data())) + _this->mReadBufferPos, written);
-			_this->mReadBufferPos += written;
-			return written;
+			return CURL_SEEKFUNC_OK;
 		}
 	}
 
-	return 0;
+	return CURL_SEEKFUNC_CANTSEEK;
 }
 
 ///
@@ -181,7 +208,7 @@ static size_t headerFunction(char *buffer, size_t elementSize, size_t numberOfEl
 }
 
 //TODO: stefan.eberl - use the request type or rethink design
-std::shared_ptr<Response> HTTPClient::sendRequestInternal(HTTPClient::RequestType requestType, const core::UTF8String& url, const core::UTF8String& clientIPAddress, const core::UTF8String& beaconData, const HTTPClient::HttpMethod method)
+std::shared_ptr<Response> HTTPClient::sendRequestInternal(HTTPClient::RequestType requestType, const core::UTF8String& url, const core::UTF8String& clientIPAddress, std::shared_ptr<const caching::BeaconChunk> beaconChunk, const HTTPClient::HttpMethod method)
 {
 	if (mLogger->isDebugEnabled())
 	{
@@ -202,120 +229,190 @@ std::shared_ptr<Response> HTTPClient::sendRequestInternal(HTTPClient::RequestTyp
 		};
 	}
 
-	// init the curl session - get the curl handle
-	mCurl = curl_easy_init();
+	if (!prepareRequest(url, clientIPAddress, beaconChunk, method))
+	{
+		return HTTPClient::unknownErrorResponse(requestType);
+	}
+
+	// Perform the request, res will get the return code
+	CURLcode result = curl_easy_perform(mCurl);
 
-	if (!mCurl)
+	auto response = finishRequest(requestType, url, result);
+	if (response != nullptr)
 	{
-		// Abort and cleanup if CURL cannot be initialized
-		mLogger->error("HTTPClient sendRequestInternal() - curl_easy_init() failed");
-		return HTTPClient::unknownErrorResponse(requestType);
+		return response;
+	}
+
+	// For CURL related errors, the caller retries according to its retry policy.
+	// Note that HTTP status codes >= 400 are returned with CURLE_OK.
+	releaseCurlHandle();
+
+	return HTTPClient::unknownErrorResponse(requestType);
+}
+
+CURL* HTTPClient::prepareBeaconRequest(const core::UTF8String& clientIPAddress, std::shared_ptr<const caching::BeaconChunk> beaconChunk)
+{
+	if (mLogger->isDebugEnabled())
+	{
+		mLogger->debug("HTTPClient prepareBeaconRequest() - HTTP beacon request: %s", mMonitorURL.getStringData().c_str());
 	}
 
-	long httpCode = 0L;
-	uint32_t retryCount = 0;
-	do
+	return prepareRequest(mMonitorURL, clientIPAddress, beaconChunk, HttpMethod::POST) ? mCurl : nullptr;
+}
+
+std::shared_ptr<StatusResponse> HTTPClient::finishBeaconRequest(CURLcode result)
+{
+	return std::static_pointer_cast<StatusResponse>(finishRequest(RequestType::BEACON, mMonitorURL, result));
+}
+
+std::shared_ptr<StatusResponse> HTTPClient::abortBeaconRequest()
+{
+	releaseCurlHandle();
+
+	return std::static_pointer_cast<StatusResponse>(unknownErrorResponse(RequestType::BEACON));
+}
+
+bool HTTPClient::prepareRequest(const core::UTF8String& url, const core::UTF8String& clientIPAddress, std::shared_ptr<const caching::BeaconChunk> beaconChunk, const HTTPClient::HttpMethod method)
+{
+	if (mCurl == nullptr)
 	{
-		// Set the connection parameters (URL, timeouts, etc.)
-		curl_easy_setopt(mCurl, CURLOPT_URL, url.getStringData().c_str());
-		curl_easy_setopt(mCurl, CURLOPT_CONNECTTIMEOUT, CONNECT_TIMEOUT);
-		curl_easy_setopt(mCurl, CURLOPT_TIMEOUT, READ_TIMEOUT);
-		// allow servers to send compressed data
-		curl_easy_setopt(mCurl, CURLOPT_ACCEPT_ENCODING, "");
-		// SSL/TSL certificate handling
-		mSSLTrustManager->applyTrustManager(mCurl);
-
-		HTTPResponseParser responseParser;
-		// To retrieve the response headers
-		curl_easy_setopt(mCurl, CURLOPT_HEADERFUNCTION, headerFunction);
-		curl_easy_setopt(mCurl, CURLOPT_HEADERDATA, &responseParser);
-		// To retrieve the response
-		curl_easy_setopt(mCurl, CURLOPT_WRITEFUNCTION, writeFunction);
-		curl_easy_setopt(mCurl, CURLOPT_WRITEDATA, &responseParser);
-
-
-		// Set the custom HTTP header with the client IP address, if provided
-		struct curl_slist *list = NULL;
-		if (!clientIPAddress.empty())
-		{
-			core::UTF8String xClientId("X-Client-IP: ");
-			xClientId.concatenate(clientIPAddress);
-			list = curl_slist_append(list, xClientId.getStringData().c_str());
+		// get a (possibly already connected) curl handle from the pool
+		mCurl = mHandlePool->acquire();
+
+		if (!mCurl)
+		{
+			// Abort and cleanup if CURL cannot be initialized
+			mLogger->error("HTTPClient prepareRequest() - curl_easy_init() failed");
+			return false;
 		}
+	}
+	else
+	{
+		// retry on the same handle
+		curl_easy_reset(mCurl);
+	}
+
+	// Set the connection parameters (URL, timeouts, etc.)
+	curl_easy_setopt(mCurl, CURLOPT_URL, url.getStringData().c_str());
+	curl_easy_setopt(mCurl, CURLOPT_CONNECTTIMEOUT, CONNECT_TIMEOUT);
+	curl_easy_setopt(mCurl, CURLOPT_TIMEOUT, READ_TIMEOUT);
+	// detect broken keep-alive connections
+	curl_easy_setopt(mCurl, CURLOPT_TCP_KEEPALIVE, 1L);
+	// allow servers to send compressed data
+	curl_easy_setopt(mCurl, CURLOPT_ACCEPT_ENCODING, "");
+	// SSL/TSL certificate handling
+	mSSLTrustManager->applyTrustManager(mCurl);
+
+	mResponseParser = HTTPResponseParser();
+	// To retrieve the response headers
+	curl_easy_setopt(mCurl, CURLOPT_HEADERFUNCTION, headerFunction);
+	curl_easy_setopt(mCurl, CURLOPT_HEADERDATA, &mResponseParser);
+	// To retrieve the response
+	curl_easy_setopt(mCurl, CURLOPT_WRITEFUNCTION, writeFunction);
+	curl_easy_setopt(mCurl, CURLOPT_WRITEDATA, &mResponseParser);
+
+	// Set the custom HTTP header with the client IP address, if provided
+	if (!clientIPAddress.empty())
+	{
+		core::UTF8String xClientId("X-Client-IP: ");
+		xClientId.concatenate(clientIPAddress);
+		mHeaderList = curl_slist_append(mHeaderList, xClientId.getStringData().c_str());
+	}
+
+	if (method == POST)
+	{
+		// Do a regular HTTP post
+		curl_easy_setopt(mCurl, CURLOPT_POST, 1L);
 
-		if (method == POST)
+		if (beaconChunk != nullptr && beaconChunk->getByteLength() > 0)
 		{
-			// Do a regular HTTP post
-			curl_easy_setopt(mCurl, CURLOPT_POST, 1L);
+			if (mLogger->isDebugEnabled())
+			{
+				mLogger->debug("HTTPClient prepareRequest() - Beacon Payload: %s", beaconChunk->toUTF8String().getStringData().c_str());
+			}
 
-			if (!beaconData.empty())
+			// Data to send is compressed while curl reads it => the compressed size is unknown up front, use chunked encoding
+			// the chunk's segments are compressed in place, without joining them first
+			mPostData = beaconChunk;
+			if (mCompressor == nullptr)
+			{
+				mCompressor = mHandlePool->acquireCompressor();
+			}
+			if (!mCompressor->reset(beaconChunk->getSegments()))
 			{
-				if (mLogger->isDebugEnabled())
-				{
-					mLogger->debug("HTTPClient sendRequestInternal() - Beacon Payload: %s", beaconData.getStringData().c_str());
-				}
-
-				// Data to send is compressed => Compress the data
-				Compressor::compressMemory(beaconData.getStringData().c_str(), beaconData.getStringLength(), mReadBuffer);
-				mReadBufferPos = 0;
-				curl_easy_setopt(mCurl, CURLOPT_READFUNCTION, readFunction);
-				curl_easy_setopt(mCurl, CURLOPT_READDATA, this);
-				curl_easy_setopt(mCurl, CURLOPT_POSTFIELDSIZE, mReadBuffer.size());
-				list = curl_slist_append(list, "Content-Encoding: gzip");
+				mLogger->error("HTTPClient prepareRequest() - initializing the compression failed");
+				releaseCurlHandle();
+				return false;
 			}
+			curl_easy_setopt(mCurl, CURLOPT_READFUNCTION, readFunction);
+			curl_easy_setopt(mCurl, CURLOPT_READDATA, this);
+			curl_easy_setopt(mCurl, CURLOPT_SEEKFUNCTION, seekFunction);
+			curl_easy_setopt(mCurl, CURLOPT_SEEKDATA, this);
+			mHeaderList = curl_slist_append(mHeaderList, "Content-Encoding: gzip");
+			mHeaderList = curl_slist_append(mHeaderList, "Transfer-Encoding: chunked");
+			// don't wait for a "100 Continue" response before sending the body
+			mHeaderList = curl_slist_append(mHeaderList, "Expect:");
 		}
+	}
 
-		if (list != NULL)
-		{
-			curl_easy_setopt(mCurl, CURLOPT_HTTPHEADER, list);
-		}
+	if (mHeaderList != nullptr)
+	{
+		curl_easy_setopt(mCurl, CURLOPT_HTTPHEADER, mHeaderList);
+	}
 
-		// Perform the request, res will get the return code
-		CURLcode response = curl_easy_perform(mCurl);
-		if (response == CURLE_OK)
-		{
-			// To retrieve the HTTP response code
-			curl_easy_getinfo(mCurl, CURLINFO_RESPONSE_CODE, &httpCode);
-		}
-		else
-		{
-			// See https://curl.haxx.se/libcurl/c/libcurl-errors.html for a list of CURL error codes.
-			mLogger->error("HTTPClient sendRequestInternal() - curl_easy_perform() failed on '%s': ErrorCode '%u', [%s]", url.getStringData().c_str(), response, curl_easy_strerror(response));
-		}
-
-		// Cleanup
-		if (list != nullptr)
-		{
-			curl_slist_free_all(list);
-			list = nullptr;
-		}
+	return true;
+}
 
-		if (response == CURLE_OK)
-		{
-			curl_easy_cleanup(mCurl);
-			mCurl = nullptr;
+std::shared_ptr<Response> HTTPClient::finishRequest(RequestType requestType, const core::UTF8String& url, CURLcode result)
+{
+	long httpCode = 0L;
+	if (result == CURLE_OK)
+	{
+		// To retrieve the HTTP response code
+		curl_easy_getinfo(mCurl, CURLINFO_RESPONSE_CODE, &httpCode);
+	}
+	else
+	{
+		// See https://curl.haxx.se/libcurl/c/libcurl-errors.html for a list of CURL error codes.
+		mLogger->error("HTTPClient finishRequest() - request failed on '%s': ErrorCode '%u', [%s]", url.getStringData().c_str(), result, curl_easy_strerror(result));
+	}
 
-			// Check for success or error
-			return handleResponse(requestType, httpCode, responseParser.getResponseBody(), responseParser.getResponseHeaders());
-		}
-		else
-		{
-			// For CURL related errors, we retry. Note that HTTP status codes >= 400 are returned with CURLE_OK.
-			retryCount++;
-			std::this_thread::sleep_for(std::chrono::milliseconds(RETRY_SLEEP_TIME));
-			curl_easy_reset(mCurl);
-		}
+	// Cleanup
+	if (mHeaderList != nullptr)
+	{
+		curl_slist_free_all(mHeaderList);
+		mHeaderList = nullptr;
+	}
 
-	} while (retryCount < MAX_SEND_RETRIES);
+	if (result != CURLE_OK)
+	{
+		// keep the handle for retrying the request
+		return nullptr;
+	}
+
+	releaseCurlHandle();
+
+	// Check for success or error
+	return handleResponse(requestType, httpCode, mResponseParser.getResponseBody(), mResponseParser.getResponseHeaders());
+}
+
+void HTTPClient::releaseCurlHandle()
+{
+	mPostData = nullptr;
+
+	if (mHeaderList != nullptr)
+	{
+		curl_slist_free_all(mHeaderList);
+		mHeaderList = nullptr;
+	}
 
-	// Cleanup
 	if (mCurl != nullptr)
 	{
-		curl_easy_cleanup(mCurl);
+		mHandlePool->release(mCurl);
 		mCurl = nullptr;
 	}
 
-	return HTTPClient::unknownErrorResponse(requestType);
+	mHandlePool->releaseCompressor(std::move(mCompressor));
 }
 
 std::shared_ptr<Response> HTTPClient::handleResponse(RequestType requestType, int32_t httpCode, const std::string& response, const Response::ResponseHeaders& responseHeaders)
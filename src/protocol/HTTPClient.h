@@ -22,6 +22,9 @@
 
 #include "OpenKit/ILogger.h"
 #include "protocol/IHTTPClient.h"
+#include "protocol/CurlHandlePool.h"
+#include "protocol/HTTPResponseParser.h"
+#include "core/util/StreamingCompressor.h"
 #include "OpenKit/ISSLTrustManager.h"
 #include "curl/curl.h"
 
@@ -61,8 +64,9 @@ namespace protocol
 		/// Default constructor
 		/// @param[in] logger to write traces to
 		/// @param[in] configuration configuration parameters for the HTTPClient
+		/// @param[in] handlePool pool of curl handles to use, if @c nullptr a pool is created for this client only
 		///
-		HTTPClient(std::shared_ptr<openkit::ILogger> logger, std::shared_ptr<configuration::HTTPClientConfiguration> configuration);
+		HTTPClient(std::shared_ptr<openkit::ILogger> logger, std::shared_ptr<configuration::HTTPClientConfiguration> configuration, std::shared_ptr<CurlHandlePool> handlePool = nullptr);
 
 		///
 		/// Destructor
@@ -81,12 +85,39 @@ namespace protocol
 
 		virtual std::shared_ptr<StatusResponse> sendStatusRequest() override;
 
-		virtual std::shared_ptr<StatusResponse> sendBeaconRequest(const core::UTF8String& clientIPAddress, const core::UTF8String& beaconData) override;
+		virtual std::shared_ptr<StatusResponse> sendBeaconRequest(const core::UTF8String& clientIPAddress, std::shared_ptr<const caching::BeaconChunk> beaconChunk) override;
 
 		virtual std::shared_ptr<TimeSyncResponse> sendTimeSyncRequest() override;
 
 		virtual std::shared_ptr<StatusResponse> sendNewSessionRequest() override;
 
+		///
+		/// Set up a beacon send request without performing it.
+		///
+		/// This allows the caller to perform the returned easy handle, e.g. together with other requests on a curl multi handle.
+		/// After the transfer is done, @ref finishBeaconRequest must be called. If the transfer failed,
+		/// this method may be called again for retrying the request.
+		/// @param[in] clientIPAddress the IP address of the client. If provided, this is sent in the custom HTTP header "X-Client-IP"
+		/// @param[in] beaconChunk data to send in the HTTP POST. Data will be gzip compressed.
+		/// @returns the curl easy handle to perform or @c nullptr if no handle could be obtained
+		///
+		CURL* prepareBeaconRequest(const core::UTF8String& clientIPAddress, std::shared_ptr<const caching::BeaconChunk> beaconChunk);
+
+		///
+		/// Evaluate the result of performing a request previously set up with @ref prepareBeaconRequest.
+		/// @param[in] result the result of performing the curl easy handle
+		/// @returns the response received from the server or @c nullptr if the transfer failed and may be retried
+		///
+		std::shared_ptr<StatusResponse> finishBeaconRequest(CURLcode result);
+
+		///
+		/// Give up a request previously set up with @ref prepareBeaconRequest.
+		///
+		/// The curl easy handle must no longer be in use by the caller.
+		/// @returns an erroneous response
+		///
+		std::shared_ptr<StatusResponse> abortBeaconRequest();
+
 		///
 		/// Perform global initialization.
 		/// @remarks This method expects to be called before any other operation.
@@ -102,15 +133,45 @@ namespace protocol
 	private:
 
 		///
-		/// sends a status check request and returns a status response
+		/// sends a request once and returns the response
+		///
+		/// Failed requests are not retried here, retrying is up to the caller's @ref RetryPolicy.
 		/// @param[in] requestType the type of request sent to the server
 		/// @param[in] url the url where to send the request to
 		/// @param[in] clientIPAddress optional the IP address of the client. If provided, this is sent in the custom HTTP header "X-Client-IP"
-		/// @param[in] beaconData optional data to send in the HTTP POST. Data will be gzip compressed.
+		/// @param[in] beaconChunk optional data to send in the HTTP POST. Data will be gzip compressed.
 		/// @param[in] method the HTTP method to use. Currently either POST or GET
 		/// @returns a status response with the response data for the request or @c nullptr on error
 		///
-		std::shared_ptr<Response> sendRequestInternal(RequestType requestType, const core::UTF8String& url, const core::UTF8String& clientIPAddress, const core::UTF8String& beaconData, const HttpMethod method);
+		std::shared_ptr<Response> sendRequestInternal(RequestType requestType, const core::UTF8String& url, const core::UTF8String& clientIPAddress, std::shared_ptr<const caching::BeaconChunk> beaconChunk, const HttpMethod method);
+
+		///
+		/// Set up the curl easy handle for sending a request.
+		///
+		/// A handle is acquired from the handle pool, if this client does not hold one yet.
+		/// @param[in] url the url where to send the request to
+		/// @param[in] clientIPAddress optional the IP address of the client
+		/// @param[in] beaconChunk optional data to send in the HTTP POST
+		/// @param[in] method the HTTP method to use
+		/// @returns @c true if the handle was set up, @c false if no handle could be obtained
+		///
+		bool prepareRequest(const core::UTF8String& url, const core::UTF8String& clientIPAddress, std::shared_ptr<const caching::BeaconChunk> beaconChunk, const HttpMethod method);
+
+		///
+		/// Evaluate the result of performing the curl easy handle.
+		///
+		/// On success the handle is given back to the handle pool, otherwise it is kept for a retry.
+		/// @param[in] requestType the type of request sent to the server
+		/// @param[in] url the url where the request was sent to
+		/// @param[in] result the result of performing the handle
+		/// @returns the response or @c nullptr if the transfer failed
+		///
+		std::shared_ptr<Response> finishRequest(RequestType requestType, const core::UTF8String& url, CURLcode result);
+
+		///
+		/// Give the curl easy handle back to the handle pool, if this client holds one.
+		///
+		void releaseCurlHandle();
 
 		///
 		/// Build URL used for status check and beacon send requests
@@ -131,6 +192,8 @@ namespace protocol
 
 		static size_t readFunction(void *ptr, size_t elementSize, size_t numberOfElements, void* userPtr);
 
+		static int seekFunction(void* userPtr, curl_off_t offset, int origin);
+
 		std::shared_ptr<Response> unknownErrorResponse(RequestType requestType);
 
 	private:
@@ -138,6 +201,9 @@ namespace protocol
 		/// Logger to write traces to
 		std::shared_ptr<openkit::ILogger> mLogger;
 
+		/// pool providing the curl easy handles
+		std::shared_ptr<CurlHandlePool> mHandlePool;
+
 		/// easy handle to the CURL session
 		CURL * mCurl;
 
@@ -150,17 +216,23 @@ namespace protocol
 		/// the beacon URL
 		core::UTF8String mTimeSyncURL;
 
-		/// buffer used for curl's read function
-		std::vector<unsigned char> mReadBuffer;
+		/// compresses the data to POST on the fly in curl's read function, given back to the pool together with @c mCurl
+		std::unique_ptr<base::util::StreamingCompressor> mCompressor;
 
-		/// read position in the read buffer
-		size_t mReadBufferPos;
+		/// the uncompressed data to POST of the current request
+		std::shared_ptr<const caching::BeaconChunk> mPostData;
 
 		/// how the peer's TSL/SSL certificate and the hostname shall be trusted
 		std::shared_ptr<openkit::ISSLTrustManager> mSSLTrustManager;
 
 		/// URL for new session requests
 		core::UTF8String mNewSessionURL;
+
+		/// parser for the response of the current request
+		HTTPResponseParser mResponseParser;
+
+		/// custom HTTP headers of the current request
+		struct curl_slist* mHeaderList;
 	};
 
 }
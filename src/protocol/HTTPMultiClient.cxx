@@ -0,0 +1,247 @@
+/**
+* Copyright 2018 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "HTTPMultiClient.h"
+
+#include <algorithm>
+
+using namespace protocol;
+
+constexpr IHTTPMultiClient::RequestID IHTTPMultiClient::INVALID_REQUEST_ID;
+
+// max time to block in curl_multi_wait in ms
+constexpr int MAX_WAIT_TIMEOUT = 1000;
+
+HTTPMultiClient::HTTPMultiClient(std::shared_ptr<openkit::ILogger> logger, std::shared_ptr<CurlHandlePool> handlePool)
+	: mLogger(logger)
+	, mHandlePool(handlePool)
+	, mMultiHandle(curl_multi_init())
+	, mNextRequestID(INVALID_REQUEST_ID + 1)
+	, mRequests()
+	, mRunningRequests()
+{
+}
+
+HTTPMultiClient::~HTTPMultiClient()
+{
+	cancelAllRequests();
+	if (mMultiHandle != nullptr)
+	{
+		curl_multi_cleanup(mMultiHandle);
+	}
+}
+
+IHTTPMultiClient::RequestID HTTPMultiClient::addBeaconRequest(std::shared_ptr<configuration::HTTPClientConfiguration> configuration, const core::UTF8String& clientIPAddress, std::shared_ptr<const caching::BeaconChunk> beaconChunk)
+{
+	auto requestID = mNextRequestID++;
+	auto& request = mRequests[requestID];
+	request.client = std::unique_ptr<HTTPClient>(new HTTPClient(mLogger, configuration, mHandlePool));
+	request.clientIPAddress = clientIPAddress;
+	request.beaconChunk = beaconChunk;
+	request.retryPolicy = configuration->getBeaconRequestRetryPolicy();
+	request.retryCount = 0;
+	request.isWaitingForRetry = false;
+	request.retryTime = std::chrono::steady_clock::now();
+
+	if (!startRequest(requestID, request))
+	{
+		// try once more on the next wait and report the failure from there
+		request.isWaitingForRetry = true;
+	}
+
+	return requestID;
+}
+
+std::vector<IHTTPMultiClient::CompletedRequest> HTTPMultiClient::waitForCompletedRequests()
+{
+	std::vector<CompletedRequest> completedRequests;
+	while (completedRequests.empty() && !mRequests.empty())
+	{
+		startDueRetries(completedRequests);
+		if (!completedRequests.empty() || mRunningRequests.empty())
+		{
+			// only requests waiting for a retry are left, the caller waits for them
+			break;
+		}
+
+		int numRunningHandles = 0;
+		curl_multi_perform(mMultiHandle, &numRunningHandles);
+		collectFinishedTransfers(completedRequests);
+
+		if (completedRequests.empty())
+		{
+			int numFileDescriptors = 0;
+			curl_multi_wait(mMultiHandle, nullptr, 0, getWaitTimeout(), &numFileDescriptors);
+		}
+	}
+
+	return completedRequests;
+}
+
+int64_t HTTPMultiClient::getMillisecondsUntilNextRetry() const
+{
+	auto now = std::chrono::steady_clock::now();
+	auto nextRetryTime = std::chrono::steady_clock::time_point::max();
+	for (const auto& entry : mRequests)
+	{
+		if (entry.second.isWaitingForRetry)
+		{
+			nextRetryTime = std::min(nextRetryTime, entry.second.retryTime);
+		}
+	}
+
+	if (nextRetryTime <= now || nextRetryTime == std::chrono::steady_clock::time_point::max())
+	{
+		return 0;
+	}
+	// round up, so the retry is due once the caller waited that long
+	return std::chrono::duration_cast<std::chrono::milliseconds>(nextRetryTime - now).count() + 1;
+}
+
+void HTTPMultiClient::cancelAllRequests()
+{
+	for (const auto& runningRequest : mRunningRequests)
+	{
+		curl_multi_remove_handle(mMultiHandle, runningRequest.first);
+	}
+	mRunningRequests.clear();
+
+	// the clients give their easy handles back to the pool
+	mRequests.clear();
+}
+
+size_t HTTPMultiClient::getNumberOfPendingRequests() const
+{
+	return mRequests.size();
+}
+
+bool HTTPMultiClient::startRequest(RequestID requestID, Request& request)
+{
+	if (mMultiHandle == nullptr)
+	{
+		mLogger->error("HTTPMultiClient startRequest() - curl_multi_init() failed");
+		return false;
+	}
+
+	auto curl = request.client->prepareBeaconRequest(request.clientIPAddress, request.beaconChunk);
+	if (curl == nullptr)
+	{
+		return false;
+	}
+
+	auto result = curl_multi_add_handle(mMultiHandle, curl);
+	if (result != CURLM_OK)
+	{
+		mLogger->error("HTTPMultiClient startRequest() - curl_multi_add_handle() failed: [%s]", curl_multi_strerror(result));
+		return false;
+	}
+
+	mRunningRequests[curl] = requestID;
+	return true;
+}
+
+void HTTPMultiClient::startDueRetries(std::vector<CompletedRequest>& completedRequests)
+{
+	auto now = std::chrono::steady_clock::now();
+	auto it = mRequests.begin();
+	while (it != mRequests.end())
+	{
+		auto& request = it->second;
+		if (!request.isWaitingForRetry || request.retryTime > now)
+		{
+			++it;
+			continue;
+		}
+
+		request.isWaitingForRetry = false;
+		if (!startRequest(it->first, request))
+		{
+			completedRequests.push_back({ it->first, request.client->abortBeaconRequest() });
+			it = mRequests.erase(it);
+			continue;
+		}
+		++it;
+	}
+}
+
+void HTTPMultiClient::collectFinishedTransfers(std::vector<CompletedRequest>& completedRequests)
+{
+	int numMessagesLeft = 0;
+	CURLMsg* message = nullptr;
+	while ((message = curl_multi_info_read(mMultiHandle, &numMessagesLeft)) != nullptr)
+	{
+		if (message->msg != CURLMSG_DONE)
+		{
+			continue;
+		}
+
+		auto curl = message->easy_handle;
+		auto result = message->data.result;
+		curl_multi_remove_handle(mMultiHandle, curl);
+
+		auto runningRequest = mRunningRequests.find(curl);
+		if (runningRequest == mRunningRequests.end())
+		{
+			continue;
+		}
+		auto requestID = runningRequest->second;
+		mRunningRequests.erase(runningRequest);
+
+		auto& request = mRequests[requestID];
+		auto response = request.client->finishBeaconRequest(result);
+		if (response != nullptr)
+		{
+			completedRequests.push_back({ requestID, response });
+			mRequests.erase(requestID);
+		}
+		else
+		{
+			handleFailedRequest(requestID, completedRequests);
+		}
+	}
+}
+
+void HTTPMultiClient::handleFailedRequest(RequestID requestID, std::vector<CompletedRequest>& completedRequests)
+{
+	auto& request = mRequests[requestID];
+	if (!request.retryPolicy->isRetryAllowed(request.retryCount))
+	{
+		completedRequests.push_back({ requestID, request.client->abortBeaconRequest() });
+		mRequests.erase(requestID);
+		return;
+	}
+
+	// For CURL related errors, we retry, without blocking the other requests
+	request.isWaitingForRetry = true;
+	request.retryTime = std::chrono::steady_clock::now() + std::chrono::milliseconds(request.retryPolicy->getRetryDelayInMilliseconds(request.retryCount));
+	request.retryCount++;
+}
+
+int HTTPMultiClient::getWaitTimeout() const
+{
+	auto now = std::chrono::steady_clock::now();
+	auto timeout = std::chrono::milliseconds(MAX_WAIT_TIMEOUT);
+	for (const auto& entry : mRequests)
+	{
+		if (entry.second.isWaitingForRetry)
+		{
+			auto untilRetry = std::chrono::duration_cast<std::chrono::milliseconds>(entry.second.retryTime - now);
+			timeout = std::max(std::chrono::milliseconds(0), std::min(timeout, untilRetry));
+		}
+	}
+
+	return static_cast<int>(timeout.count());
+}
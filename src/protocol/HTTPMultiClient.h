@@ -0,0 +1,162 @@
+/**
+* Copyright 2018 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef _PROTOCOL_HTTPMULTICLIENT_H
+#define _PROTOCOL_HTTPMULTICLIENT_H
+
+#include "OpenKit/ILogger.h"
+#include "protocol/IHTTPMultiClient.h"
+#include "protocol/HTTPClient.h"
+#include "protocol/CurlHandlePool.h"
+#include "protocol/RetryPolicy.h"
+#include "curl/curl.h"
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <unordered_map>
+
+namespace protocol
+{
+	///
+	/// HTTP client sending beacon requests concurrently on a curl multi handle.
+	///
+	/// Each request is set up by its own @ref HTTPClient, so request and response handling is identical to
+	/// sending the request synchronously. Requests failing on connection level are retried without blocking
+	/// the other requests.
+	///
+	/// This class is not thread safe.
+	///
+	class HTTPMultiClient : public IHTTPMultiClient
+	{
+	public:
+		///
+		/// Constructor
+		/// @param[in] logger to write traces to
+		/// @param[in] handlePool pool of curl easy handles used for the requests
+		///
+		HTTPMultiClient(std::shared_ptr<openkit::ILogger> logger, std::shared_ptr<CurlHandlePool> handlePool);
+
+		///
+		/// Destructor
+		///
+		/// Pending requests are aborted.
+		///
+		virtual ~HTTPMultiClient();
+
+		///
+		/// Delete the copy constructor
+		///
+		HTTPMultiClient(const HTTPMultiClient&) = delete;
+
+		///
+		/// Delete the assignment operator
+		///
+		HTTPMultiClient& operator = (const HTTPMultiClient&) = delete;
+
+		virtual RequestID addBeaconRequest(std::shared_ptr<configuration::HTTPClientConfiguration> configuration, const core::UTF8String& clientIPAddress, std::shared_ptr<const caching::BeaconChunk> beaconChunk) override;
+
+		virtual std::vector<CompletedRequest> waitForCompletedRequests() override;
+
+		virtual int64_t getMillisecondsUntilNextRetry() const override;
+
+		virtual void cancelAllRequests() override;
+
+		virtual size_t getNumberOfPendingRequests() const override;
+
+	private:
+		///
+		/// State of a single request
+		///
+		struct Request
+		{
+			/// client setting up the request and evaluating its response
+			std::unique_ptr<HTTPClient> client;
+
+			/// the client IP address
+			core::UTF8String clientIPAddress;
+
+			/// the beacon payload
+			std::shared_ptr<const caching::BeaconChunk> beaconChunk;
+
+			/// policy defining how often and after which delay the request is retried
+			std::shared_ptr<const RetryPolicy> retryPolicy;
+
+			/// number of retries performed so far
+			uint32_t retryCount;
+
+			/// flag indicating whether the request failed and waits for being retried
+			bool isWaitingForRetry;
+
+			/// point in time when a failed request shall be retried
+			std::chrono::steady_clock::time_point retryTime;
+		};
+
+		///
+		/// Set up the given request and add it to the multi handle.
+		/// @param[in] requestID the request's ID
+		/// @param[in] request the request to start
+		/// @returns @c true if the request was started, @c false otherwise
+		///
+		bool startRequest(RequestID requestID, Request& request);
+
+		///
+		/// Start all requests, which are waiting for a retry and whose retry time has elapsed.
+		/// @param[in,out] completedRequests requests, which could not be started, are added here
+		///
+		void startDueRetries(std::vector<CompletedRequest>& completedRequests);
+
+		///
+		/// Evaluate all transfers finished by the multi handle.
+		/// @param[in,out] completedRequests completed requests are added here
+		///
+		void collectFinishedTransfers(std::vector<CompletedRequest>& completedRequests);
+
+		///
+		/// Handle a request which failed on connection level, by either scheduling a retry or completing it.
+		/// @param[in] requestID the request's ID
+		/// @param[in,out] completedRequests the request is added here, if it is not retried
+		///
+		void handleFailedRequest(RequestID requestID, std::vector<CompletedRequest>& completedRequests);
+
+		///
+		/// Get the time to wait for activity on the multi handle
+		/// @returns the time to wait in milliseconds
+		///
+		int getWaitTimeout() const;
+
+	private:
+		/// Logger to write traces to
+		std::shared_ptr<openkit::ILogger> mLogger;
+
+		/// pool providing the curl easy handles
+		std::shared_ptr<CurlHandlePool> mHandlePool;
+
+		/// the curl multi handle
+		CURLM* mMultiHandle;
+
+		/// ID of the next request
+		RequestID mNextRequestID;
+
+		/// all pending requests
+		std::map<RequestID, Request> mRequests;
+
+		/// requests currently added to the multi handle
+		std::unordered_map<CURL*, RequestID> mRunningRequests;
+	};
+}
+
+#endif
@@ -23,6 +23,7 @@
 #include "protocol/TimeSyncResponse.h"
 #include "configuration/HTTPClientConfiguration.h"
 #include "core/UTF8String.h"
+#include "caching/BeaconChunk.h"
 
 namespace protocol
 {
@@ -50,10 +51,10 @@ namespace protocol
 		///
 		/// sends a beacon send request and returns a status response
 		/// @param[in] clientIPAddress the client IP address
-		/// @param[in] beaconData the beacon payload
+		/// @param[in] beaconChunk the beacon payload, which must stay valid until the request is completed
 		/// @returns a status response with the response data for the request or @c nullptr on error
 		///
-		virtual std::shared_ptr<StatusResponse> sendBeaconRequest(const core::UTF8String& clientIPAddress, const core::UTF8String& beaconData) = 0;
+		virtual std::shared_ptr<StatusResponse> sendBeaconRequest(const core::UTF8String& clientIPAddress, std::shared_ptr<const caching::BeaconChunk> beaconChunk) = 0;
 
 		///
 		/// sends a timesync request and returns a timesync response
@@ -0,0 +1,109 @@
+/**
+* Copyright 2018 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef _PROTOCOL_IHTTPMULTICLIENT_H
+#define _PROTOCOL_IHTTPMULTICLIENT_H
+
+#include "protocol/StatusResponse.h"
+#include "configuration/HTTPClientConfiguration.h"
+#include "core/UTF8String.h"
+#include "caching/BeaconChunk.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace protocol
+{
+	///
+	/// HTTP client sending multiple beacon requests concurrently.
+	///
+	/// Requests are started by @ref addBeaconRequest and progress while the caller waits in
+	/// @ref waitForCompletedRequests. Requests complete in any order.
+	///
+	/// Requests waiting for a retry do not block the caller, instead it waits for them itself, as
+	/// given by @ref getMillisecondsUntilNextRetry, so the wait can be interrupted.
+	///
+	class IHTTPMultiClient
+	{
+	public:
+		///
+		/// Identifies a request added to the client
+		///
+		using RequestID = uint64_t;
+
+		///
+		/// ID never returned for a valid request
+		///
+		static constexpr RequestID INVALID_REQUEST_ID = 0;
+
+		///
+		/// A completed request together with its response
+		///
+		struct CompletedRequest
+		{
+			/// the request's ID as returned by @ref addBeaconRequest
+			RequestID requestID;
+
+			/// the response received, an erroneous response if sending failed
+			std::shared_ptr<StatusResponse> response;
+		};
+
+		///
+		/// Destructor
+		///
+		virtual ~IHTTPMultiClient() {}
+
+		///
+		/// Start sending a beacon send request, without waiting for its completion.
+		/// @param[in] configuration configuration of the beacon, providing the URL and the trust manager
+		/// @param[in] clientIPAddress the client IP address
+		/// @param[in] beaconChunk the beacon payload, which must stay valid until the request is completed or cancelled
+		/// @returns the ID identifying the request
+		///
+		virtual RequestID addBeaconRequest(std::shared_ptr<configuration::HTTPClientConfiguration> configuration, const core::UTF8String& clientIPAddress, std::shared_ptr<const caching::BeaconChunk> beaconChunk) = 0;
+
+		///
+		/// Wait until at least one of the requests added before is completed.
+		///
+		/// If all pending requests are waiting for a retry, this returns immediately.
+		///
+		/// @returns the requests completed in the mean time, empty if there are no requests or all requests wait for a retry
+		///
+		virtual std::vector<CompletedRequest> waitForCompletedRequests() = 0;
+
+		///
+		/// Get the time until the next request waiting for a retry is due
+		/// @returns the time in milliseconds, @c 0 if a retry is already due or no request is waiting for a retry
+		///
+		virtual int64_t getMillisecondsUntilNextRetry() const = 0;
+
+		///
+		/// Abort all requests which have not completed yet.
+		///
+		/// Aborted requests are not reported by @ref waitForCompletedRequests.
+		///
+		virtual void cancelAllRequests() = 0;
+
+		///
+		/// Get the number of requests which have not completed yet
+		/// @returns the number of pending requests
+		///
+		virtual size_t getNumberOfPendingRequests() const = 0;
+	};
+}
+
+#endif
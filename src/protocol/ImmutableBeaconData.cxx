@@ -0,0 +1,89 @@
+/**
+* Copyright 2018 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#include "ImmutableBeaconData.h"
+#include "ProtocolConstants.h"
+#include "BeaconProtocolConstants.h"
+#include "EventWriter.h"
+
+using namespace protocol;
+
+ImmutableBeaconData::ImmutableBeaconData(std::shared_ptr<configuration::Configuration> configuration)
+	: mApplicationData(createApplicationData(configuration))
+	, mDeviceData(createDeviceData(configuration))
+{
+}
+
+const core::UTF8String& ImmutableBeaconData::getApplicationData() const
+{
+	return mApplicationData;
+}
+
+const core::UTF8String& ImmutableBeaconData::getDeviceData() const
+{
+	return mDeviceData;
+}
+
+core::UTF8String ImmutableBeaconData::createApplicationData(std::shared_ptr<configuration::Configuration> configuration)
+{
+	EventWriter applicationData;
+
+	//version and application information 
+	applicationData.addKeyValuePair(BEACON_KEY_PROTOCOL_VERSION, PROTOCOL_VERSION);
+	applicationData.addKeyValuePair(BEACON_KEY_OPENKIT_VERSION, core::UTF8String(OPENKIT_VERSION));
+	applicationData.addKeyValuePair(BEACON_KEY_APPLICATION_ID, configuration->getApplicationID());
+	applicationData.addKeyValuePair(BEACON_KEY_APPLICATION_NAME, configuration->getApplicationName());
+	auto applicationVersion = configuration->getApplicationVersion();
+	if (!applicationVersion.empty())
+	{
+		applicationData.addKeyValuePair(BEACON_KEY_APPLICATION_VERSION, applicationVersion);
+	}
+	applicationData.addKeyValuePair(BEACON_KEY_PLATFORM_TYPE, core::UTF8String(PLATFORM_TYPE_OPENKIT));
+	applicationData.addKeyValuePair(BEACON_KEY_AGENT_TECHNOLOGY_TYPE, core::UTF8String(AGENT_TECHNOLOGY_TYPE));
+
+	return applicationData.getData();
+}
+
+core::UTF8String ImmutableBeaconData::createDeviceData(std::shared_ptr<configuration::Configuration> configuration)
+{
+	EventWriter deviceData;
+
+	// platform information
+	auto deviceOS = configuration->getDevice()->getOperatingSystem();
+	if (!deviceOS.empty())
+	{
+		deviceData.addKeyValuePair(BEACON_KEY_DEVICE_OS, deviceOS);
+	}
+	auto deviceManufacturer = configuration->getDevice()->getManufacturer();
+	if (!deviceManufacturer.empty())
+	{
+		deviceData.addKeyValuePair(BEACON_KEY_DEVICE_MANUFACTURER, deviceManufacturer);
+	}
+	auto deviceModel = configuration->getDevice()->getModelID();
+	if (!deviceModel.empty())
+	{
+		deviceData.addKeyValuePair(BEACON_KEY_DEVICE_MODEL, deviceModel);
+	}
+
+	auto beaconConfiguration = configuration->getBeaconConfiguration();
+	deviceData.addKeyValuePair(BEACON_KEY_DATA_COLLECTION_LEVEL, (int32_t)beaconConfiguration->getDataCollectionLevel());
+	deviceData.addKeyValuePair(BEACON_KEY_CRASH_REPORTING_LEVEL, (int32_t)beaconConfiguration->getCrashReportingLevel());
+
+	core::UTF8String data(BEACON_DATA_DELIMITER);
+	data.concatenate(deviceData.getData());
+	return data;
+}
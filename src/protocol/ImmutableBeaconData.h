@@ -0,0 +1,79 @@
+/**
+* Copyright 2018 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#ifndef _PROTOCOL_IMMUTABLEBEACONDATA_H
+#define _PROTOCOL_IMMUTABLEBEACONDATA_H
+
+#include "core/UTF8String.h"
+#include "configuration/Configuration.h"
+
+#include <memory>
+
+namespace protocol
+{
+	///
+	/// The part of the beacon's basic data, which is the same for all sessions of an OpenKit instance.
+	///
+	/// The data is serialized once and shared by all @ref Beacon instances, each of which only serializes the
+	/// session specific visitor ID, session number and client IP address. In the beacon's prefix the session
+	/// specific data is located between the application data and the device data.
+	///
+	class ImmutableBeaconData
+	{
+	public:
+		///
+		/// Serialize the basic beacon data of the given configuration
+		/// @param[in] configuration the OpenKit instance's configuration
+		///
+		ImmutableBeaconData(std::shared_ptr<configuration::Configuration> configuration);
+
+		///
+		/// Get the protocol version and application information, which precede the session specific data
+		/// @returns the serialized application data
+		///
+		const core::UTF8String& getApplicationData() const;
+
+		///
+		/// Get the platform information and data collection levels, which follow the session specific data
+		/// @returns the serialized device data, starting with a delimiter
+		///
+		const core::UTF8String& getDeviceData() const;
+
+	private:
+		///
+		/// Serialize the protocol version and application information
+		/// @param[in] configuration the configuration to serialize
+		/// @returns the serialized data
+		///
+		static core::UTF8String createApplicationData(std::shared_ptr<configuration::Configuration> configuration);
+
+		///
+		/// Serialize the platform information and data collection levels
+		/// @param[in] configuration the configuration to serialize
+		/// @returns the serialized data, starting with a delimiter
+		///
+		static core::UTF8String createDeviceData(std::shared_ptr<configuration::Configuration> configuration);
+
+		/// the serialized application data
+		const core::UTF8String mApplicationData;
+
+		/// the serialized device data
+		const core::UTF8String mDeviceData;
+	};
+}
+
+#endif
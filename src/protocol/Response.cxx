@@ -17,11 +17,13 @@
 #include "Response.h"
 
 #include <inttypes.h>
+#include <limits>
 
 using namespace protocol;
 
 static constexpr int32_t HTTP_BAD_REQUEST = 400;
 static constexpr int32_t HTTP_TOO_MANY_REQUESTS = 429;
+static constexpr int32_t CONNECTION_ERROR_RESPONSE_CODE = std::numeric_limits<int32_t>::max();
 
 static constexpr char RESPONSE_KEY_RETRY_AFTER[] = "retry-after";
 static constexpr int64_t DEFAULT_RETRY_AFTER_IN_MILLISECONDS = 10L * 60L * 1000L; // 10 minutes in milliseconds
@@ -48,6 +50,11 @@ bool Response::isTooManyRequestsResponse() const
 	return getResponseCode() == HTTP_TOO_MANY_REQUESTS;
 }
 
+bool Response::isConnectionErrorResponse() const
+{
+	return getResponseCode() == CONNECTION_ERROR_RESPONSE_CODE;
+}
+
 int32_t Response::getResponseCode() const
 {
 	return mResponseCode;
@@ -58,6 +65,11 @@ const Response::ResponseHeaders& Response::getResponseHeaders() const
 	return mResponseHeaders;
 }
 
+bool Response::hasRetryAfter() const
+{
+	return mResponseHeaders.find(RESPONSE_KEY_RETRY_AFTER) != mResponseHeaders.end();
+}
+
 int64_t Response::getRetryAfterInMilliseconds() const
 {
 	auto iterator = mResponseHeaders.find(RESPONSE_KEY_RETRY_AFTER);
@@ -62,6 +62,13 @@ namespace protocol
 		///
 		bool isTooManyRequestsResponse() const;
 
+		///
+		/// Return a boolean indicating whether the request failed on connection level, without a response from the server.
+		/// @remarks Such a response is created by the HTTP client, its response code is the maximum @c int32_t value.
+		/// @return @c true if the request failed on connection level, @c false otherwise.
+		///
+		bool isConnectionErrorResponse() const;
+
 		///
 		/// Return the response code
 		/// @returns the response code
@@ -74,6 +81,12 @@ namespace protocol
 		///
 		const ResponseHeaders& getResponseHeaders() const;
 
+		///
+		/// Return a boolean indicating whether the response contains a Retry-After header.
+		/// @return @c true if the Retry-After response header is present, @c false otherwise.
+		///
+		bool hasRetryAfter() const;
+
 		///
 		/// Get Retry-After response header value in milliseconds.
 		///
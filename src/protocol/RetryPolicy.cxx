@@ -0,0 +1,98 @@
+/**
+* Copyright 2018 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#include "RetryPolicy.h"
+#include "providers/DefaultPRNGenerator.h"
+
+#include <algorithm>
+
+using namespace protocol;
+
+constexpr double RetryPolicy::DEFAULT_JITTER_FACTOR;
+
+RetryPolicy::RetryPolicy(uint32_t maxRetries, int64_t initialDelayInMilliseconds, int64_t maxDelayInMilliseconds, double jitterFactor)
+	: RetryPolicy(maxRetries, initialDelayInMilliseconds, maxDelayInMilliseconds, jitterFactor, std::make_shared<providers::DefaultPRNGenerator>())
+{
+}
+
+RetryPolicy::RetryPolicy(uint32_t maxRetries, int64_t initialDelayInMilliseconds, int64_t maxDelayInMilliseconds, double jitterFactor,
+	std::shared_ptr<providers::IPRNGenerator> randomGenerator)
+	: mMaxRetries(maxRetries)
+	, mInitialDelayInMilliseconds(std::max(int64_t(0), initialDelayInMilliseconds))
+	, mMaxDelayInMilliseconds(std::max(std::max(int64_t(0), initialDelayInMilliseconds), maxDelayInMilliseconds))
+	, mJitterFactor(std::min(1.0, std::max(0.0, jitterFactor)))
+	, mRandomGenerator(randomGenerator)
+	, mMutex()
+{
+}
+
+uint32_t RetryPolicy::getMaxRetries() const
+{
+	return mMaxRetries;
+}
+
+int64_t RetryPolicy::getInitialDelayInMilliseconds() const
+{
+	return mInitialDelayInMilliseconds;
+}
+
+int64_t RetryPolicy::getMaxDelayInMilliseconds() const
+{
+	return mMaxDelayInMilliseconds;
+}
+
+double RetryPolicy::getJitterFactor() const
+{
+	return mJitterFactor;
+}
+
+bool RetryPolicy::isRetryAllowed(uint32_t retry) const
+{
+	return retry < mMaxRetries;
+}
+
+int64_t RetryPolicy::getRetryDelayInMilliseconds(uint32_t retry) const
+{
+	// double the delay for each retry, without overflowing
+	auto delay = mInitialDelayInMilliseconds;
+	for (uint32_t i = 0; i < retry && delay < mMaxDelayInMilliseconds; i++)
+	{
+		delay *= 2;
+	}
+	delay = std::min(delay, mMaxDelayInMilliseconds);
+
+	auto maxJitter = static_cast<int64_t>(delay * mJitterFactor);
+	if (maxJitter <= 0)
+	{
+		return delay;
+	}
+
+	std::lock_guard<std::mutex> lock(mMutex);
+	return delay - mRandomGenerator->nextInt64(maxJitter + 1);
+}
+
+int64_t RetryPolicy::getRetryDelayInMilliseconds(uint32_t retry, std::shared_ptr<Response> response) const
+{
+	auto delay = getRetryDelayInMilliseconds(retry);
+	if (response != nullptr && response->hasRetryAfter())
+	{
+		// the server knows best when it is ready again
+		delay = std::max(delay, response->getRetryAfterInMilliseconds());
+	}
+
+	return delay;
+}
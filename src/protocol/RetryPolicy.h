@@ -0,0 +1,136 @@
+/**
+* Copyright 2018 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#ifndef _PROTOCOL_RETRYPOLICY_H
+#define _PROTOCOL_RETRYPOLICY_H
+
+#include "Response.h"
+#include "providers/IPRNGenerator.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace protocol
+{
+	///
+	/// Policy defining how often and after which delay a failed request is retried.
+	///
+	/// The delay grows exponentially with each retry, starting at the initial delay, and is capped by the maximum delay.
+	/// To avoid many clients retrying in lockstep, the delay is randomly shortened by up to the jitter factor.
+	/// If the server sent a Retry-After header, the delay is never shorter than the requested one.
+	///
+	/// The policy only computes delays, the caller decides how to wait, so that waiting can be interrupted.
+	/// This class is thread safe.
+	///
+	class RetryPolicy
+	{
+	public:
+		/// default fraction by which a retry delay is randomly shortened
+		static constexpr double DEFAULT_JITTER_FACTOR = 0.5;
+
+		///
+		/// Constructor
+		/// @param[in] maxRetries maximum number of retries after the first attempt
+		/// @param[in] initialDelayInMilliseconds delay before the first retry
+		/// @param[in] maxDelayInMilliseconds upper bound for the delay between two attempts
+		/// @param[in] jitterFactor fraction in the range [0, 1] by which a delay is randomly shortened
+		///
+		RetryPolicy(uint32_t maxRetries, int64_t initialDelayInMilliseconds, int64_t maxDelayInMilliseconds, double jitterFactor = DEFAULT_JITTER_FACTOR);
+
+		///
+		/// Constructor
+		/// @param[in] maxRetries maximum number of retries after the first attempt
+		/// @param[in] initialDelayInMilliseconds delay before the first retry
+		/// @param[in] maxDelayInMilliseconds upper bound for the delay between two attempts
+		/// @param[in] jitterFactor fraction in the range [0, 1] by which a delay is randomly shortened
+		/// @param[in] randomGenerator random number generator used for the jitter
+		///
+		RetryPolicy(uint32_t maxRetries, int64_t initialDelayInMilliseconds, int64_t maxDelayInMilliseconds, double jitterFactor,
+			std::shared_ptr<providers::IPRNGenerator> randomGenerator);
+
+		RetryPolicy(const RetryPolicy&) = delete;
+		RetryPolicy& operator=(const RetryPolicy&) = delete;
+
+		///
+		/// Returns the maximum number of retries after the first attempt
+		/// @returns the maximum number of retries
+		///
+		uint32_t getMaxRetries() const;
+
+		///
+		/// Returns the delay before the first retry, without jitter
+		/// @returns the initial delay in milliseconds
+		///
+		int64_t getInitialDelayInMilliseconds() const;
+
+		///
+		/// Returns the upper bound for the delay between two attempts
+		/// @returns the maximum delay in milliseconds
+		///
+		int64_t getMaxDelayInMilliseconds() const;
+
+		///
+		/// Returns the fraction by which a delay is randomly shortened
+		/// @returns the jitter factor
+		///
+		double getJitterFactor() const;
+
+		///
+		/// Returns whether another retry is allowed
+		/// @param[in] retry the zero based number of the retry about to be done
+		/// @returns @c true if the retry is allowed, @c false if all retries are used up
+		///
+		bool isRetryAllowed(uint32_t retry) const;
+
+		///
+		/// Returns the delay to wait before the given retry
+		/// @param[in] retry the zero based number of the retry about to be done
+		/// @returns the delay in milliseconds
+		///
+		int64_t getRetryDelayInMilliseconds(uint32_t retry) const;
+
+		///
+		/// Returns the delay to wait before the given retry, taking a Retry-After header of the failed response into account
+		/// @param[in] retry the zero based number of the retry about to be done
+		/// @param[in] response the response of the failed attempt, might be @c nullptr
+		/// @returns the delay in milliseconds
+		///
+		int64_t getRetryDelayInMilliseconds(uint32_t retry, std::shared_ptr<Response> response) const;
+
+	private:
+		/// maximum number of retries after the first attempt
+		const uint32_t mMaxRetries;
+
+		/// delay before the first retry
+		const int64_t mInitialDelayInMilliseconds;
+
+		/// upper bound for the delay between two attempts
+		const int64_t mMaxDelayInMilliseconds;
+
+		/// fraction by which a delay is randomly shortened
+		const double mJitterFactor;
+
+		/// random number generator used for the jitter
+		std::shared_ptr<providers::IPRNGenerator> mRandomGenerator;
+
+		/// mutex guarding the random number generator
+		mutable std::mutex mMutex;
+	};
+}
+
+#endif
@@ -15,12 +15,36 @@
 */
 
 #include "DefaultHTTPClientProvider.h"
+#include "protocol/HTTPMultiClient.h"
 
 using namespace providers;
 
+DefaultHTTPClientProvider::DefaultHTTPClientProvider()
+	: mMutex()
+	, mHandlePool(nullptr)
+{
+}
+
 std::shared_ptr<protocol::IHTTPClient> DefaultHTTPClientProvider::createClient(std::shared_ptr<openkit::ILogger> logger, std::shared_ptr<configuration::HTTPClientConfiguration> configuration)
 {
-	return std::shared_ptr<protocol::IHTTPClient>(new protocol::HTTPClient(logger, configuration));
+	return std::shared_ptr<protocol::IHTTPClient>(new protocol::HTTPClient(logger, configuration, getHandlePool(configuration)));
+}
+
+std::shared_ptr<protocol::IHTTPMultiClient> DefaultHTTPClientProvider::createMultiClient(std::shared_ptr<openkit::ILogger> logger, std::shared_ptr<configuration::HTTPClientConfiguration> configuration)
+{
+	return std::shared_ptr<protocol::IHTTPMultiClient>(new protocol::HTTPMultiClient(logger, getHandlePool(configuration)));
+}
+
+std::shared_ptr<protocol::CurlHandlePool> DefaultHTTPClientProvider::getHandlePool(std::shared_ptr<configuration::HTTPClientConfiguration> configuration)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	if (mHandlePool == nullptr)
+	{
+		mHandlePool = std::make_shared<protocol::CurlHandlePool>(configuration->getHTTPClientPoolSize(),
+			std::chrono::milliseconds(configuration->getHTTPClientIdleTimeout()));
+	}
+
+	return mHandlePool;
 }
 
 void DefaultHTTPClientProvider::globalInit()
@@ -30,5 +54,13 @@ void DefaultHTTPClientProvider::globalInit()
 
 void DefaultHTTPClientProvider::globalDestroy()
 {
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		if (mHandlePool != nullptr)
+		{
+			// the pooled handles and the share object must be cleaned up before curl itself
+			mHandlePool->clear();
+		}
+	}
 	protocol::HTTPClient::globalDestroy();
 }
\ No newline at end of file
@@ -20,20 +20,48 @@
 #include "providers/IHTTPClientProvider.h"
 
 #include "configuration/HTTPClientConfiguration.h"
+#include "protocol/CurlHandlePool.h"
+
+#include <memory>
+#include <mutex>
 
 namespace providers
 {
 	///
 	/// Implementation of an HTTPClientProvider which creates a HTTP client for executing status check, beacon send and time sync requests.
 	///
+	/// All clients created by one provider share a @ref protocol::CurlHandlePool, so that consecutive requests
+	/// reuse open keep-alive connections, DNS lookups and TLS sessions.
+	///
 	class DefaultHTTPClientProvider : public IHTTPClientProvider
 	{
 	public:
+		///
+		/// Default constructor
+		///
+		DefaultHTTPClientProvider();
+
 		virtual std::shared_ptr<protocol::IHTTPClient> createClient(std::shared_ptr<openkit::ILogger> logger, std::shared_ptr<configuration::HTTPClientConfiguration> configuration) override;
 
+		virtual std::shared_ptr<protocol::IHTTPMultiClient> createMultiClient(std::shared_ptr<openkit::ILogger> logger, std::shared_ptr<configuration::HTTPClientConfiguration> configuration) override;
+
 		virtual void globalInit() override;
 
 		virtual void globalDestroy() override;
+
+	private:
+		///
+		/// Get the handle pool shared by all clients, creating it on first use.
+		/// @param[in] configuration configuration parameters for the pool
+		/// @returns the handle pool
+		///
+		std::shared_ptr<protocol::CurlHandlePool> getHandlePool(std::shared_ptr<configuration::HTTPClientConfiguration> configuration);
+
+		/// mutex guarding the lazy creation of @c mHandlePool
+		std::mutex mMutex;
+
+		/// curl handles shared by all clients created by this provider
+		std::shared_ptr<protocol::CurlHandlePool> mHandlePool;
 	};
 }
 
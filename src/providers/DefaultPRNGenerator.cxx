@@ -16,22 +16,98 @@
 
 #include "DefaultPRNGenerator.h"
 
+#include <random>
 
 using namespace providers;
 
+namespace
+{
+	///
+	/// xoshiro256** engine as described by David Blackman and Sebastiano Vigna, see http://prng.di.unimi.it/
+	///
+	class Xoshiro256StarStar
+	{
+	public:
+		Xoshiro256StarStar()
+			: mState()
+		{
+			// expand a single seed to the full state with splitmix64, which never yields an all-zero state
+			std::random_device randomDevice;
+			uint64_t seed = (static_cast<uint64_t>(randomDevice()) << 32) ^ randomDevice();
+			for (auto& state : mState)
+			{
+				seed += 0x9E3779B97F4A7C15ULL;
+				uint64_t z = seed;
+				z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+				z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+				state = z ^ (z >> 31);
+			}
+		}
+
+		uint64_t next()
+		{
+			const uint64_t result = rotateLeft(mState[1] * 5, 7) * 9;
+			const uint64_t t = mState[1] << 17;
+
+			mState[2] ^= mState[0];
+			mState[3] ^= mState[1];
+			mState[1] ^= mState[2];
+			mState[0] ^= mState[3];
+			mState[2] ^= t;
+			mState[3] = rotateLeft(mState[3], 45);
+
+			return result;
+		}
+
+	private:
+		static uint64_t rotateLeft(uint64_t value, int shift)
+		{
+			return (value << shift) | (value >> (64 - shift));
+		}
+
+		uint64_t mState[4];
+	};
+
+	Xoshiro256StarStar& getThreadLocalEngine()
+	{
+		static thread_local Xoshiro256StarStar engine;
+		return engine;
+	}
+}
+
 DefaultPRNGenerator::DefaultPRNGenerator()
-	: mRandomEngine((std::random_device())())
 {
 }
 
 int32_t DefaultPRNGenerator::nextInt32(int32_t upperBound)
 {
-	std::uniform_real_distribution<double> uniform_dist(0.0, 1.0);
-	return static_cast<int32_t>(uniform_dist(mRandomEngine) * upperBound);
+	if (upperBound <= 0)
+	{
+		return 0;
+	}
+	return static_cast<int32_t>(nextBounded(static_cast<uint64_t>(upperBound)));
 }
 
 int64_t DefaultPRNGenerator::nextInt64(int64_t upperBound)
 {
-	std::uniform_real_distribution<double> uniform_dist(0.0, 1.0);
-	return static_cast<int64_t>(uniform_dist(mRandomEngine) * upperBound);
+	if (upperBound <= 0)
+	{
+		return 0;
+	}
+	return static_cast<int64_t>(nextBounded(static_cast<uint64_t>(upperBound)));
+}
+
+uint64_t DefaultPRNGenerator::nextBounded(uint64_t upperBound)
+{
+	// values below the threshold are rejected, so that the remaining range is a multiple of upperBound
+	const uint64_t threshold = (uint64_t(0) - upperBound) % upperBound;
+
+	auto& engine = getThreadLocalEngine();
+	uint64_t value;
+	do
+	{
+		value = engine.next();
+	} while (value < threshold);
+
+	return value % upperBound;
 }
\ No newline at end of file
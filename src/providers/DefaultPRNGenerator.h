@@ -19,13 +19,17 @@
 
 #include "IPRNGenerator.h"
 
-#include <random>
+#include <cstdint>
 
 namespace providers
 {
 	
 	///
-	/// Default implementation for random number generator based on STL's random::device
+	/// Default implementation for random number generator based on a xoshiro256** engine
+	///
+	/// The engine's state is kept per thread and seeded from @c std::random_device on the thread's first use.
+	/// Instances therefore don't hold any state, are cheap to create and can be shared between threads.
+	/// Random numbers are drawn without modulo bias, so every value below the upper bound is equally likely.
 	///
 	class DefaultPRNGenerator : public IPRNGenerator
 	{
@@ -36,14 +40,27 @@ namespace providers
 		///
 		DefaultPRNGenerator();
 
+		///
+		/// Generate a random number between 0(inclusive) and upperBound(exclusive)
+		/// @param[in] upperBound the upper boundary used for random number generation, is exclusive
+		/// @return random number within the requested boundaries or @c 0 if @c upperBound is not positive
+		///
 		virtual int32_t nextInt32(int32_t upperBound) override;
 
+		///
+		/// Generate a random number between 0(inclusive) and upperBound(exclusive)
+		/// @param[in] upperBound the upper boundary used for random number generation, is exclusive
+		/// @return random number within the requested boundaries or @c 0 if @c upperBound is not positive
+		///
 		virtual int64_t nextInt64(int64_t upperBound) override;
 
 	private:
-		/// random engine generating the random numbers
-		std::default_random_engine mRandomEngine;
-
+		///
+		/// Generate a uniformly distributed random number between 0(inclusive) and upperBound(exclusive)
+		/// @param[in] upperBound the upper boundary, which must be greater than 0
+		/// @return random number within the requested boundaries
+		///
+		static uint64_t nextBounded(uint64_t upperBound);
 	};
 }
 
@@ -17,31 +17,89 @@
 #include "DefaultSessionIDProvider.h"
 #include "DefaultPRNGenerator.h"
 
-#include <random>
+#include <algorithm>
+#include <limits>
 
 using namespace providers;
 
+namespace
+{
+	/// source of unique provider IDs
+	std::atomic<uint64_t> gNextProviderID(1);
+
+	///
+	/// Block of session IDs reserved by a thread
+	///
+	struct SessionIDBlock
+	{
+		/// ID of the provider the block was reserved from, 0 if the thread has no IDs left
+		uint64_t providerID;
+
+		/// next ID to hand out
+		int32_t nextSessionID;
+
+		/// last ID of the block
+		int32_t lastSessionID;
+	};
+
+	SessionIDBlock& getThreadLocalBlock()
+	{
+		static thread_local SessionIDBlock block = { 0, 0, 0 };
+		return block;
+	}
+}
+
 DefaultSessionIDProvider::DefaultSessionIDProvider()
-	: mLastSessionNumber(0)
-	, mNextIDMutex()
+	: DefaultSessionIDProvider(providers::DefaultPRNGenerator().nextInt32(std::numeric_limits<int32_t>::max()))
 {
-	providers::DefaultPRNGenerator randomGenerator;
-	mLastSessionNumber = randomGenerator.nextInt32(std::numeric_limits<int32_t>::max());
-	
 }
 
-DefaultSessionIDProvider::DefaultSessionIDProvider(int32_t initialOffset)
+DefaultSessionIDProvider::DefaultSessionIDProvider(int32_t initialOffset, int32_t blockSize)
 	: mLastSessionNumber(initialOffset)
-	, mNextIDMutex()
+	, mBlockSize(std::max(blockSize, 1))
+	, mProviderID(gNextProviderID++)
 {
 }
 
 int32_t DefaultSessionIDProvider::getNextSessionID()
 {
-	std::lock_guard<std::mutex> lock(mNextIDMutex);
-	if (mLastSessionNumber == std::numeric_limits<int32_t>::max())
+	int32_t lastSessionID;
+	if (mBlockSize == 1)
+	{
+		return reserveSessionIDs(1, lastSessionID);
+	}
+
+	// a thread only caches the block of the provider it used last
+	auto& block = getThreadLocalBlock();
+	if (block.providerID != mProviderID)
+	{
+		block.nextSessionID = reserveSessionIDs(mBlockSize, block.lastSessionID);
+		block.providerID = mProviderID;
+	}
+
+	auto sessionID = block.nextSessionID;
+	if (sessionID == block.lastSessionID)
+	{
+		// the block is used up
+		block.providerID = 0;
+	}
+	else
 	{
-		mLastSessionNumber = 0;
+		block.nextSessionID++;
 	}
-	return ++mLastSessionNumber;
+	return sessionID;
+}
+
+int32_t DefaultSessionIDProvider::reserveSessionIDs(int32_t count, int32_t& lastSessionID)
+{
+	auto last = mLastSessionNumber.load();
+	int32_t first;
+	do
+	{
+		first = last == std::numeric_limits<int32_t>::max() ? 1 : last + 1;
+		// a block never wraps around, it is truncated at the maximum ID instead
+		lastSessionID = static_cast<int32_t>(std::min<int64_t>(int64_t(first) + count - 1, std::numeric_limits<int32_t>::max()));
+	} while (!mLastSessionNumber.compare_exchange_weak(last, lastSessionID));
+
+	return first;
 }
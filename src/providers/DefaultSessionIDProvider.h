@@ -19,13 +19,18 @@
 
 #include "ISessionIDProvider.h"
 #include <stdint.h>
-#include <mutex>
+#include <atomic>
 
 namespace providers
 {
 	///
 	/// Default implementation of @ref providers::ISessionIDProvider interface
 	///
+	/// Session IDs are taken from an atomic counter without locking.
+	/// With a block size greater than 1, each thread reserves a block of consecutive IDs at once and
+	/// hands them out from thread local storage, so that threads creating sessions concurrently rarely
+	/// access the shared counter. IDs are then only consecutive within a thread.
+	///
 	class DefaultSessionIDProvider : public ISessionIDProvider
 	{
 	public:
@@ -37,8 +42,10 @@ namespace providers
 
 		///
 		/// Construtor with inital offset
+		/// @param[in] initialOffset the session ID preceding the first ID provided
+		/// @param[in] blockSize number of IDs reserved by a thread at once
 		///
-		DefaultSessionIDProvider(int32_t initialOffset);
+		DefaultSessionIDProvider(int32_t initialOffset, int32_t blockSize = 1);
 
 		///
 		/// Destructor
@@ -51,13 +58,24 @@ namespace providers
 		/// @returns the id that will be used for the next session
 		///
 		virtual int32_t getNextSessionID();
+
 	private:
+		///
+		/// Reserve consecutive session IDs, wrapping around to 1 after the maximum ID
+		/// @param[in] count the maximum number of IDs to reserve
+		/// @param[out] lastSessionID the last reserved ID
+		/// @returns the first reserved ID
+		///
+		int32_t reserveSessionIDs(int32_t count, int32_t& lastSessionID);
 
 		/// remember last session number - initialized with random offset
-		int32_t mLastSessionNumber;
+		std::atomic<int32_t> mLastSessionNumber;
+
+		/// number of IDs reserved by a thread at once
+		const int32_t mBlockSize;
 
-		/// mutex for exclusive access to getNextSessionID
-		std::mutex mNextIDMutex;
+		/// unique ID of this provider, identifying its thread local blocks
+		const uint64_t mProviderID;
 	};
 }
 #endif
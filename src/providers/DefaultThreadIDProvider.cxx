@@ -18,8 +18,22 @@
 
 #include <thread> 
 
+#if defined(_WIN32) || defined(WIN32)
+#include <windows.h>
+#elif defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#elif defined(__APPLE__)
+#include <pthread.h>
+#endif
+
 using namespace providers;
 
+DefaultThreadIDProvider::DefaultThreadIDProvider(bool useKernelThreadIDs)
+	: mUseKernelThreadIDs(useKernelThreadIDs)
+{
+}
+
 /*
  * std::this_thread::get_id returns a long value which is a hash from the std::thread::id class.
  * The Beacon protocol requires the thread id to be a positive integer value. By using the xor operation
@@ -30,8 +44,43 @@ using namespace providers;
  */
 int32_t DefaultThreadIDProvider::getThreadID()
 {
-	int64_t hash = std::hash<std::thread::id>()(std::this_thread::get_id());
-	return convertNativeThreadIDToPositiveInteger(hash);
+	return mUseKernelThreadIDs ? getKernelThreadID() : getHashedThreadID();
+}
+
+bool DefaultThreadIDProvider::isUsingKernelThreadIDs() const
+{
+	return mUseKernelThreadIDs;
+}
+
+int32_t DefaultThreadIDProvider::getHashedThreadID()
+{
+	// a thread's ID never changes, so the hash is only computed on the first call of each thread
+	static thread_local const int32_t threadID =
+		convertNativeThreadIDToPositiveInteger(std::hash<std::thread::id>()(std::this_thread::get_id()));
+	return threadID;
+}
+
+/*
+ * The kernel thread ID is the ID reported by profilers and tools like top or perf.
+ * It is converted the same way as the hashed ID, which leaves IDs below 2^31 unchanged.
+ */
+int32_t DefaultThreadIDProvider::getKernelThreadID()
+{
+#if defined(_WIN32) || defined(WIN32)
+	static thread_local const int32_t threadID = convertNativeThreadIDToPositiveInteger(static_cast<int64_t>(GetCurrentThreadId()));
+#elif defined(__linux__)
+	static thread_local const int32_t threadID = convertNativeThreadIDToPositiveInteger(static_cast<int64_t>(syscall(SYS_gettid)));
+#elif defined(__APPLE__)
+	static thread_local const int32_t threadID = []()
+	{
+		uint64_t nativeThreadID = 0;
+		pthread_threadid_np(nullptr, &nativeThreadID);
+		return convertNativeThreadIDToPositiveInteger(static_cast<int64_t>(nativeThreadID));
+	}();
+#else
+	static thread_local const int32_t threadID = getHashedThreadID();
+#endif
+	return threadID;
 }
 
 int32_t DefaultThreadIDProvider::convertNativeThreadIDToPositiveInteger(int64_t nativeThreadID)
@@ -25,21 +25,54 @@ namespace providers
 	///
 	/// Simple ThreadIDProvider implementation for getting the current thread ID.
 	///
+	/// The ID is computed once per thread and cached in thread local storage.
+	///
 	class DefaultThreadIDProvider : public IThreadIDProvider
 	{
 	public:
+		///
+		/// Constructor
+		/// @param[in] useKernelThreadIDs @c true to provide the operating system's thread ID,
+		///            @c false to provide an ID derived from @c std::thread::id
+		///
+		explicit DefaultThreadIDProvider(bool useKernelThreadIDs = false);
+
 		///
 		/// Provide the current thread ID
 		/// @returns the current thread ID
 		///
 		virtual int32_t getThreadID() override;
 
+		///
+		/// Returns a flag if the operating system's thread ID is provided
+		/// @returns @c true if kernel thread IDs are provided, @c false otherwise
+		///
+		bool isUsingKernelThreadIDs() const;
+
+		///
+		/// Get the current thread's ID derived from @c std::thread::id
+		/// @returns a positive integer calculated from the hashed @c std::thread::id
+		///
+		static int32_t getHashedThreadID();
+
+		///
+		/// Get the operating system's ID of the current thread
+		///
+		/// On platforms without a kernel thread ID the result of @ref getHashedThreadID is returned.
+		/// @returns a positive integer calculated from the kernel thread ID
+		///
+		static int32_t getKernelThreadID();
+
 		///
 		/// Convert a native thread id to a positive integer required for the Beacon protocol
 		/// @param[in] nativeThreadID the native thread ID returned by std::this_thread::get_id
 		/// @returns a positive integer calculated from the native ID
 		///
 		static int32_t convertNativeThreadIDToPositiveInteger(int64_t nativeThreadID);
+
+	private:
+		/// flag if the operating system's thread ID is provided
+		const bool mUseKernelThreadIDs;
 	};
 }
 
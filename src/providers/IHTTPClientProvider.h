@@ -18,6 +18,7 @@
 #define _PROVIDERS_IHTTPCLIENTPROVIDER_H
 
 #include "protocol/HTTPClient.h"
+#include "protocol/IHTTPMultiClient.h"
 
 #include <memory>
 
@@ -45,6 +46,13 @@ namespace providers
 		///
 		virtual std::shared_ptr<protocol::IHTTPClient> createClient(std::shared_ptr<openkit::ILogger> logger, std::shared_ptr<configuration::HTTPClientConfiguration> configuration) = 0;
 
+		///
+		/// Returns an HTTP client for sending multiple beacon requests concurrently.
+		/// @param[in] logger to write traces to
+		/// @param[in] configuration configuration parameters for the HTTP connections
+		///
+		virtual std::shared_ptr<protocol::IHTTPMultiClient> createMultiClient(std::shared_ptr<openkit::ILogger> logger, std::shared_ptr<configuration::HTTPClientConfiguration> configuration) = 0;
+
 		///
 		/// Global initialization method.
 		/// @remarks This method is called if the first OpenKit instance, based on an instance count, is initialized.
@@ -33,12 +33,14 @@ set(OPENKIT_SOURCES_TEST_API
 
 set(OPENKIT_SOURCES_TEST_CORE
 	${CMAKE_CURRENT_LIST_DIR}/core/UTF8StringTest.cxx
+	${CMAKE_CURRENT_LIST_DIR}/core/UTF8StringViewTest.cxx
 	${CMAKE_CURRENT_LIST_DIR}/core/SessionTest.cxx
+	${CMAKE_CURRENT_LIST_DIR}/core/SessionRegistryTest.cxx
 	${CMAKE_CURRENT_LIST_DIR}/core/ActionTest.cxx
 	${CMAKE_CURRENT_LIST_DIR}/core/RootActionTest.cxx
 	${CMAKE_CURRENT_LIST_DIR}/core/WebRequestTracerBaseTest.cxx
 	${CMAKE_CURRENT_LIST_DIR}/core/WebRequestTracerStringURLTest.cxx
-	${CMAKE_CURRENT_LIST_DIR}/core/util/CompressorTest.cxx
+	${CMAKE_CURRENT_LIST_DIR}/core/util/StreamingCompressorTest.cxx
 	${CMAKE_CURRENT_LIST_DIR}/core/util/URLEncodingTest.cxx
 	${CMAKE_CURRENT_LIST_DIR}/core/util/SynchronizedQueueTest.cxx
 	${CMAKE_CURRENT_LIST_DIR}/core/util/InetAddressValidatorTest.cxx
@@ -55,10 +57,16 @@ set(OPENKIT_SOURCES_TEST_PROTOCOL
 	${CMAKE_CURRENT_LIST_DIR}/protocol/TimeSyncResponseTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/protocol/MockBeacon.h
     ${CMAKE_CURRENT_LIST_DIR}/protocol/MockHTTPClient.h
+    ${CMAKE_CURRENT_LIST_DIR}/protocol/MockHTTPMultiClient.h
     ${CMAKE_CURRENT_LIST_DIR}/protocol/TestSSLTrustManager.h
     ${CMAKE_CURRENT_LIST_DIR}/protocol/HTTPResponseParserTest.cxx
 	${CMAKE_CURRENT_LIST_DIR}/protocol/BeaconTest.cxx
+	${CMAKE_CURRENT_LIST_DIR}/protocol/CurlHandlePoolTest.cxx
+	${CMAKE_CURRENT_LIST_DIR}/protocol/EventWriterTest.cxx
+	${CMAKE_CURRENT_LIST_DIR}/protocol/HTTPMultiClientTest.cxx
+	${CMAKE_CURRENT_LIST_DIR}/protocol/ImmutableBeaconDataTest.cxx
     ${CMAKE_CURRENT_LIST_DIR}/protocol/ResponseTest.cxx
+	${CMAKE_CURRENT_LIST_DIR}/protocol/RetryPolicyTest.cxx
 	${CMAKE_CURRENT_LIST_DIR}/protocol/MockStatusResponse.h
 	${CMAKE_CURRENT_LIST_DIR}/protocol/NullLogger.h
 )
@@ -98,8 +106,10 @@ set(OPENKIT_SOURCES_TEST_CONFIGURATION
 )
 
 set(OPENKIT_SOURCES_TEST_CACHING
+	${CMAKE_CURRENT_LIST_DIR}/caching/BeaconCacheArenaTest.cxx
 	${CMAKE_CURRENT_LIST_DIR}/caching/BeaconCacheEntryTest.cxx
 	${CMAKE_CURRENT_LIST_DIR}/caching/BeaconCacheRecordTest.cxx
+	${CMAKE_CURRENT_LIST_DIR}/caching/BeaconChunkTest.cxx
 	${CMAKE_CURRENT_LIST_DIR}/caching/SpaceEvictionStrategyTest.cxx
 	${CMAKE_CURRENT_LIST_DIR}/caching/TimeEvictionStrategyTest.cxx
 	${CMAKE_CURRENT_LIST_DIR}/caching/BeaconCacheEvictorTest.cxx
@@ -340,3 +340,113 @@ TEST_F(OpenKitBuilderTest, canSetCrashReportingLevelForAppMon)
 
 	ASSERT_EQ(configuration->getBeaconConfiguration()->getCrashReportingLevel(), CrashReportingLevel::OPT_IN_CRASHES);
 }
+
+TEST_F(OpenKitBuilderTest, httpClientPoolDefaultsAreUsedByDefault)
+{
+	auto configuration = DynatraceOpenKitBuilder(DEFAULT_ENDPOINT_URL, DEFAULT_APPLICATION_ID, DEFAULT_DEVICE_ID).buildConfiguration();
+
+	ASSERT_EQ(configuration->getHTTPClientConfiguration()->getHTTPClientPoolSize(), configuration::HTTPClientConfiguration::DEFAULT_HTTP_CLIENT_POOL_SIZE);
+	ASSERT_EQ(configuration->getHTTPClientConfiguration()->getHTTPClientIdleTimeout(), configuration::HTTPClientConfiguration::DEFAULT_HTTP_CLIENT_IDLE_TIMEOUT_IN_MILLIS);
+}
+
+TEST_F(OpenKitBuilderTest, canSetHTTPClientPoolForDynatrace)
+{
+	auto configuration = DynatraceOpenKitBuilder(DEFAULT_ENDPOINT_URL, DEFAULT_APPLICATION_ID, DEFAULT_DEVICE_ID)
+		.withHTTPClientPoolSize(7)
+		.withHTTPClientIdleTimeout(5000)
+		.buildConfiguration();
+
+	ASSERT_EQ(configuration->getHTTPClientConfiguration()->getHTTPClientPoolSize(), 7u);
+	ASSERT_EQ(configuration->getHTTPClientConfiguration()->getHTTPClientIdleTimeout(), 5000);
+}
+
+TEST_F(OpenKitBuilderTest, canSetHTTPClientPoolForAppMon)
+{
+	auto configuration = AppMonOpenKitBuilder(DEFAULT_ENDPOINT_URL, DEFAULT_APPLICATION_ID, DEFAULT_DEVICE_ID)
+		.withHTTPClientPoolSize(0)
+		.withHTTPClientIdleTimeout(5000)
+		.buildConfiguration();
+
+	ASSERT_EQ(configuration->getHTTPClientConfiguration()->getHTTPClientPoolSize(), 0u);
+	ASSERT_EQ(configuration->getHTTPClientConfiguration()->getHTTPClientIdleTimeout(), 5000);
+}
+
+TEST_F(OpenKitBuilderTest, canSetMaxConcurrentBeaconRequests)
+{
+	auto defaultConfiguration = DynatraceOpenKitBuilder(DEFAULT_ENDPOINT_URL, DEFAULT_APPLICATION_ID, DEFAULT_DEVICE_ID).buildConfiguration();
+	auto configuration = AppMonOpenKitBuilder(DEFAULT_ENDPOINT_URL, DEFAULT_APPLICATION_ID, DEFAULT_DEVICE_ID)
+		.withMaxConcurrentBeaconRequests(16)
+		.buildConfiguration();
+
+	ASSERT_EQ(defaultConfiguration->getHTTPClientConfiguration()->getMaxConcurrentBeaconRequests(), configuration::HTTPClientConfiguration::DEFAULT_MAX_CONCURRENT_BEACON_REQUESTS);
+	ASSERT_EQ(configuration->getHTTPClientConfiguration()->getMaxConcurrentBeaconRequests(), 16u);
+}
+
+TEST_F(OpenKitBuilderTest, canSetNewSessionRequestBatchWindow)
+{
+	auto defaultConfiguration = DynatraceOpenKitBuilder(DEFAULT_ENDPOINT_URL, DEFAULT_APPLICATION_ID, DEFAULT_DEVICE_ID).buildConfiguration();
+	auto configuration = AppMonOpenKitBuilder(DEFAULT_ENDPOINT_URL, DEFAULT_APPLICATION_ID, DEFAULT_DEVICE_ID)
+		.withNewSessionRequestBatchWindow(500)
+		.buildConfiguration();
+
+	ASSERT_EQ(defaultConfiguration->getHTTPClientConfiguration()->getNewSessionRequestBatchWindow(), configuration::HTTPClientConfiguration::DEFAULT_NEW_SESSION_REQUEST_BATCH_WINDOW_IN_MILLIS);
+	ASSERT_EQ(configuration->getHTTPClientConfiguration()->getNewSessionRequestBatchWindow(), 500);
+}
+
+TEST_F(OpenKitBuilderTest, defaultRetryPoliciesAreUsedByDefault)
+{
+	auto configuration = DynatraceOpenKitBuilder(DEFAULT_ENDPOINT_URL, DEFAULT_APPLICATION_ID, DEFAULT_DEVICE_ID).buildConfiguration();
+	auto httpClientConfiguration = configuration->getHTTPClientConfiguration();
+
+	ASSERT_EQ(httpClientConfiguration->getStatusRequestRetryPolicy()->getMaxRetries(), configuration::HTTPClientConfiguration::DEFAULT_STATUS_REQUEST_MAX_RETRIES);
+	ASSERT_EQ(httpClientConfiguration->getTimeSyncRequestRetryPolicy()->getMaxRetries(), configuration::HTTPClientConfiguration::DEFAULT_TIME_SYNC_REQUEST_MAX_RETRIES);
+	ASSERT_EQ(httpClientConfiguration->getBeaconRequestRetryPolicy()->getMaxRetries(), configuration::HTTPClientConfiguration::DEFAULT_BEACON_REQUEST_MAX_RETRIES);
+}
+
+TEST_F(OpenKitBuilderTest, canSetRetryPoliciesForDynatrace)
+{
+	auto configuration = DynatraceOpenKitBuilder(DEFAULT_ENDPOINT_URL, DEFAULT_APPLICATION_ID, DEFAULT_DEVICE_ID)
+		.withStatusRequestRetryPolicy(1, 100, 200)
+		.withTimeSyncRequestRetryPolicy(2, 300, 400)
+		.withBeaconRequestRetryPolicy(3, 500, 600)
+		.buildConfiguration();
+	auto httpClientConfiguration = configuration->getHTTPClientConfiguration();
+
+	auto statusRequestRetryPolicy = httpClientConfiguration->getStatusRequestRetryPolicy();
+	ASSERT_EQ(statusRequestRetryPolicy->getMaxRetries(), 1u);
+	ASSERT_EQ(statusRequestRetryPolicy->getInitialDelayInMilliseconds(), 100);
+	ASSERT_EQ(statusRequestRetryPolicy->getMaxDelayInMilliseconds(), 200);
+	auto timeSyncRequestRetryPolicy = httpClientConfiguration->getTimeSyncRequestRetryPolicy();
+	ASSERT_EQ(timeSyncRequestRetryPolicy->getMaxRetries(), 2u);
+	ASSERT_EQ(timeSyncRequestRetryPolicy->getInitialDelayInMilliseconds(), 300);
+	ASSERT_EQ(timeSyncRequestRetryPolicy->getMaxDelayInMilliseconds(), 400);
+	auto beaconRequestRetryPolicy = httpClientConfiguration->getBeaconRequestRetryPolicy();
+	ASSERT_EQ(beaconRequestRetryPolicy->getMaxRetries(), 3u);
+	ASSERT_EQ(beaconRequestRetryPolicy->getInitialDelayInMilliseconds(), 500);
+	ASSERT_EQ(beaconRequestRetryPolicy->getMaxDelayInMilliseconds(), 600);
+}
+
+TEST_F(OpenKitBuilderTest, canSetRetryPoliciesForAppMon)
+{
+	auto configuration = AppMonOpenKitBuilder(DEFAULT_ENDPOINT_URL, DEFAULT_APPLICATION_ID, DEFAULT_DEVICE_ID)
+		.withStatusRequestRetryPolicy(0, 100, 100)
+		.withBeaconRequestRetryPolicy(5, 50, 1000)
+		.buildConfiguration();
+	auto httpClientConfiguration = configuration->getHTTPClientConfiguration();
+
+	ASSERT_EQ(httpClientConfiguration->getStatusRequestRetryPolicy()->getMaxRetries(), 0u);
+	ASSERT_EQ(httpClientConfiguration->getTimeSyncRequestRetryPolicy()->getMaxRetries(), configuration::HTTPClientConfiguration::DEFAULT_TIME_SYNC_REQUEST_MAX_RETRIES);
+	ASSERT_EQ(httpClientConfiguration->getBeaconRequestRetryPolicy()->getMaxRetries(), 5u);
+	ASSERT_EQ(httpClientConfiguration->getBeaconRequestRetryPolicy()->getMaxDelayInMilliseconds(), 1000);
+}
+
+TEST_F(OpenKitBuilderTest, canEnableKernelThreadIDs)
+{
+	auto defaultConfiguration = DynatraceOpenKitBuilder(DEFAULT_ENDPOINT_URL, DEFAULT_APPLICATION_ID, DEFAULT_DEVICE_ID).buildConfiguration();
+	auto configuration = AppMonOpenKitBuilder(DEFAULT_ENDPOINT_URL, DEFAULT_APPLICATION_ID, DEFAULT_DEVICE_ID)
+		.withKernelThreadIDs(true)
+		.buildConfiguration();
+
+	ASSERT_FALSE(defaultConfiguration->isUsingKernelThreadIDs());
+	ASSERT_TRUE(configuration->isUsingKernelThreadIDs());
+}
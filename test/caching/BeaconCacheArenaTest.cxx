@@ -0,0 +1,205 @@
+/**
+* Copyright 2018 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "gtest/gtest.h"
+
+#include "caching/BeaconCacheArena.h"
+#include "core/UTF8String.h"
+
+#include <string>
+#include <vector>
+
+using namespace caching;
+
+class BeaconCacheArenaTest : public testing::Test
+{
+};
+
+TEST_F(BeaconCacheArenaTest, aDefaultConstructedInstanceHasNoSegments)
+{
+	// given
+	BeaconCacheArena target;
+
+	// then
+	ASSERT_EQ(target.getNumberOfSegments(), 0u);
+}
+
+TEST_F(BeaconCacheArenaTest, appendedDataCanBeRetrieved)
+{
+	// given
+	BeaconCacheArena target;
+
+	// when
+	auto first = target.append(core::UTF8String("foo"));
+	auto second = target.append(core::UTF8String("b\xC3\xA4r"));
+	auto third = target.append(core::UTF8String());
+
+	// then
+	ASSERT_EQ(target.getData(first).toUTF8String(), core::UTF8String("foo"));
+	ASSERT_EQ(target.getData(second).toUTF8String(), core::UTF8String("b\xC3\xA4r"));
+	ASSERT_EQ(target.getData(second).getStringLength(), 3u);
+	ASSERT_EQ(target.getData(second).getByteLength(), 4u);
+	ASSERT_TRUE(target.getData(third).empty());
+	ASSERT_EQ(target.getNumberOfSegments(), 1u);
+}
+
+TEST_F(BeaconCacheArenaTest, consecutiveRecordsAreStoredContiguously)
+{
+	// given
+	BeaconCacheArena target;
+
+	// when
+	auto first = target.append(core::UTF8String("abc"));
+	auto second = target.append(core::UTF8String("def"));
+
+	// then
+	ASSERT_EQ(first.segmentID, second.segmentID);
+	ASSERT_GT(second.offset, first.offset);
+	ASSERT_EQ(target.getData(second).getData(), target.getData(first).getData() + (second.offset - first.offset));
+}
+
+TEST_F(BeaconCacheArenaTest, newSegmentIsAllocatedWhenCurrentSegmentIsFull)
+{
+	// given
+	BeaconCacheArena target;
+	std::vector<BeaconCacheArena::RecordLocation> locations;
+	core::UTF8String data(std::string(100, 'x'));
+
+	// when
+	for (auto i = 0; i < 100; i++)
+	{
+		locations.push_back(target.append(data));
+	}
+
+	// then
+	ASSERT_GT(target.getNumberOfSegments(), 1u);
+	for (const auto& location : locations)
+	{
+		ASSERT_EQ(target.getData(location).toUTF8String(), data);
+	}
+}
+
+TEST_F(BeaconCacheArenaTest, recordLargerThanMaximumSegmentCapacityIsStored)
+{
+	// given
+	BeaconCacheArena target;
+	core::UTF8String data(std::string(BeaconCacheArena::MAX_SEGMENT_CAPACITY * 2, 'x'));
+
+	// when
+	auto location = target.append(data);
+
+	// then
+	ASSERT_EQ(target.getData(location).toUTF8String(), data);
+}
+
+TEST_F(BeaconCacheArenaTest, segmentIsFreedWhenAllRecordsAreReleased)
+{
+	// given
+	BeaconCacheArena target;
+	std::vector<BeaconCacheArena::RecordLocation> locations;
+	core::UTF8String data(std::string(100, 'x'));
+	for (auto i = 0; i < 100; i++)
+	{
+		locations.push_back(target.append(data));
+	}
+	auto numSegments = target.getNumberOfSegments();
+
+	// when releasing all records of the first segment
+	auto firstSegmentID = locations.front().segmentID;
+	size_t numReleased = 0;
+	for (const auto& location : locations)
+	{
+		if (location.segmentID == firstSegmentID)
+		{
+			target.release(location);
+			numReleased++;
+		}
+	}
+
+	// then
+	ASSERT_EQ(target.getNumberOfSegments(), numSegments - 1);
+	for (size_t i = numReleased; i < locations.size(); i++)
+	{
+		ASSERT_EQ(target.getData(locations[i]).toUTF8String(), data);
+	}
+}
+
+TEST_F(BeaconCacheArenaTest, segmentIsKeptUntilLastRecordIsReleased)
+{
+	// given
+	BeaconCacheArena target;
+	auto first = target.append(core::UTF8String(std::string(100, 'a')));
+	auto second = target.append(core::UTF8String(std::string(100, 'b')));
+	target.append(core::UTF8String(std::string(BeaconCacheArena::MAX_SEGMENT_CAPACITY, 'c')));
+	ASSERT_EQ(target.getNumberOfSegments(), 2u);
+
+	// when
+	target.release(second);
+
+	// then
+	ASSERT_EQ(target.getNumberOfSegments(), 2u);
+	ASSERT_EQ(target.getData(first).toUTF8String(), core::UTF8String(std::string(100, 'a')));
+
+	// and when
+	target.release(first);
+
+	// then
+	ASSERT_EQ(target.getNumberOfSegments(), 1u);
+}
+
+TEST_F(BeaconCacheArenaTest, currentSegmentIsReusedWhenAllRecordsAreReleased)
+{
+	// given
+	BeaconCacheArena target;
+	auto first = target.append(core::UTF8String("foo"));
+	target.release(first);
+
+	// when
+	auto second = target.append(core::UTF8String("bar"));
+
+	// then
+	ASSERT_EQ(target.getNumberOfSegments(), 1u);
+	ASSERT_EQ(second.segmentID, first.segmentID);
+	ASSERT_EQ(second.offset, first.offset);
+	ASSERT_EQ(target.getData(second).toUTF8String(), core::UTF8String("bar"));
+}
+
+TEST_F(BeaconCacheArenaTest, segmentsInTheMiddleCanBeFreedOutOfOrder)
+{
+	// given
+	BeaconCacheArena target;
+	auto first = target.append(core::UTF8String(std::string(BeaconCacheArena::MAX_SEGMENT_CAPACITY, 'a')));
+	auto second = target.append(core::UTF8String(std::string(BeaconCacheArena::MAX_SEGMENT_CAPACITY, 'b')));
+	auto third = target.append(core::UTF8String(std::string(BeaconCacheArena::MAX_SEGMENT_CAPACITY, 'c')));
+	ASSERT_EQ(target.getNumberOfSegments(), 3u);
+
+	// when
+	target.release(second);
+
+	// then
+	ASSERT_EQ(target.getNumberOfSegments(), 2u);
+	ASSERT_EQ(target.getData(first).getByteLength(), BeaconCacheArena::MAX_SEGMENT_CAPACITY);
+	ASSERT_EQ(target.getData(third).getByteLength(), BeaconCacheArena::MAX_SEGMENT_CAPACITY);
+
+	// and when
+	target.release(first);
+	auto fourth = target.append(core::UTF8String("d"));
+
+	// then
+	ASSERT_EQ(target.getNumberOfSegments(), 2u);
+	ASSERT_EQ(target.getData(third).getByteLength(), BeaconCacheArena::MAX_SEGMENT_CAPACITY);
+	ASSERT_EQ(target.getData(fourth).toUTF8String(), core::UTF8String("d"));
+}
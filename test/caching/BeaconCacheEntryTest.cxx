@@ -248,7 +248,7 @@ TEST_F(BeaconCacheEntryTest, getChunkMarksRetrievedData)
 
 	// then
 	core::UTF8String expected = "prefix&One&Four&Two&Three";
-	ASSERT_TRUE(obtained.equals(expected));
+	ASSERT_TRUE(obtained->toUTF8String().equals(expected));
 	
 	// and all of them are marked
 	auto eventDataBeingSent = target.getEventDataBeingSent();
@@ -291,35 +291,35 @@ TEST_F(BeaconCacheEntryTest, getChunkGetsChunksFromEventDataBeforeActionData)
 	auto obtained = target.getChunk("a", 2, "&");
 
 	// then it's the first event data
-	ASSERT_TRUE(obtained.equals("a&One"));
+	ASSERT_TRUE(obtained->toUTF8String().equals("a&One"));
 	
 	// and when removing already sent data and getting next chunk
 	target.removeDataMarkedForSending();
 	auto obtained2 = target.getChunk("a", 2, "&");
 
 	// then it's second event data
-	ASSERT_TRUE(obtained2.equals("a&Four"));
+	ASSERT_TRUE(obtained2->toUTF8String().equals("a&Four"));
 	
 	// and when removing already sent data and getting next chunk
 	target.removeDataMarkedForSending();
 	auto obtained3 = target.getChunk("a", 2, "&");
 
 	// then it's the first action data
-	ASSERT_TRUE(obtained3.equals("a&Two"));
+	ASSERT_TRUE(obtained3->toUTF8String().equals("a&Two"));
 
 	// and when removing already sent data and getting next chunk
 	target.removeDataMarkedForSending();
 	auto obtained4 = target.getChunk("a", 2, "&");
 
 	// then it's the second action data
-	ASSERT_TRUE(obtained4.equals("a&Three"));
+	ASSERT_TRUE(obtained4->toUTF8String().equals("a&Three"));
 	
 	// and when removing already sent data and getting next chunk
 	target.removeDataMarkedForSending();
 	auto obtained5 = target.getChunk("a", 2, "&");
 
-	// then we get an empty string, since all chunks were sent & deleted
-	ASSERT_TRUE(obtained5.equals(""));
+	// then we get no chunk, since all chunks were sent & deleted
+	ASSERT_EQ(obtained5, nullptr);
 }
 
 TEST_F(BeaconCacheEntryTest, getChunkGetsAlreadyMarkedData)
@@ -342,7 +342,7 @@ TEST_F(BeaconCacheEntryTest, getChunkGetsAlreadyMarkedData)
 	auto obtained = target.getChunk("a", 100, "&");
 
 	// then
-	ASSERT_TRUE(obtained.equals("a&One&Four&Two&Three"));
+	ASSERT_TRUE(obtained->toUTF8String().equals("a&One&Four&Two&Three"));
 	auto eventDataBeingSent = target.getEventDataBeingSent();
 	auto actionDataBeingSent = target.getActionDataBeingSent();
 	ASSERT_EQ(eventDataBeingSent.size(), 2);
@@ -364,7 +364,7 @@ TEST_F(BeaconCacheEntryTest, getChunkGetsAlreadyMarkedData)
 	auto obtained2 = target.getChunk("a", 100, "&");
 
 	// then
-	ASSERT_TRUE(obtained2.equals("a&One&Four&Two&Three"));
+	ASSERT_TRUE(obtained2->toUTF8String().equals("a&One&Four&Two&Three"));
 	auto eventDataBeingSent2 = target.getEventDataBeingSent();
 	auto actionDataBeingSent2 = target.getActionDataBeingSent();
 	ASSERT_EQ(eventDataBeingSent2.size(), 2);
@@ -399,23 +399,44 @@ TEST_F(BeaconCacheEntryTest, getChunksTakesSizeIntoAccount)
 
 	target.copyDataForChunking();
 
-	// when requesting first chunk
+	// when requesting a chunk, which cannot hold any record
 	auto obtained = target.getChunk("prefix", 1, "&");
 
-	// then only prefix is returned, since "prefix".length > maxSize (=1)
-	ASSERT_TRUE(obtained.equals("prefix"));
+	// then the first record is added nevertheless, so that oversized records don't block sending
+	ASSERT_TRUE(obtained->toUTF8String().equals("prefix&One"));
 
-	// and when retrieving something which is one character longer than "prefix"
-	auto obtained2 = target.getChunk("prefix", std::strlen("prefix"), "&");
+	// and when retrieving something which is one byte too short for the second event
+	auto obtained2 = target.getChunk("prefix", std::strlen("prefix&One&Four") - 1, "&");
 
-	// then only prefix is returned, since "prefix".length > maxSize (=1)
-	ASSERT_TRUE(obtained2.equals("prefix&One"));
+	// then the remaining space is filled with action data
+	ASSERT_TRUE(obtained2->toUTF8String().equals("prefix&One&Two"));
 
-	// and when retrieving another chunk
-	auto obtained3 = target.getChunk("prefix", std::strlen("prefix&One"), "&");
+	// and when retrieving a chunk which exactly fits both events
+	auto obtained3 = target.getChunk("prefix", std::strlen("prefix&One&Four"), "&");
 
 	// then
-	ASSERT_TRUE(obtained3.equals("prefix&One&Four"));
+	ASSERT_TRUE(obtained3->toUTF8String().equals("prefix&One&Four"));
+	ASSERT_EQ(obtained3->getByteLength(), std::strlen("prefix&One&Four"));
+}
+
+TEST_F(BeaconCacheEntryTest, getChunkMeasuresSizeInBytes)
+{
+	// given
+	BeaconCacheRecord dataOne(0L, "\xC3\xA4");
+	BeaconCacheRecord dataTwo(1L, "\xC3\xB6");
+
+	BeaconCacheEntry target;
+	target.addEventData(dataOne);
+	target.addEventData(dataTwo);
+
+	target.copyDataForChunking();
+
+	// when requesting a chunk, which would hold both records when counting characters
+	auto obtained = target.getChunk("p", std::strlen("p&\xC3\xA4&\xC3\xB6") - 1, "&");
+
+	// then only the first record is added
+	ASSERT_EQ(obtained->getNumberOfRecords(), 1u);
+	ASSERT_TRUE(obtained->toUTF8String().equals("p&\xC3\xA4"));
 }
 
 TEST_F(BeaconCacheEntryTest, removeDataMarkedForSendingReturnsIfDataHasNotBeenCopied)
@@ -953,4 +974,183 @@ TEST_F(BeaconCacheEntryTest, removeOldestRecordsDoesNotRemoveAnythingFromEventAn
 	it++;
 	ASSERT_TRUE(it->getData().equals("Three"));
 	ASSERT_FALSE(it->isMarkedForSending());
-}
\ No newline at end of file
+}
+
+TEST_F(BeaconCacheEntryTest, removeOldestRecordsReducesTotalNumberOfBytes)
+{
+	// given
+	BeaconCacheRecord dataOne(1000L, "One");
+	BeaconCacheRecord dataTwo(1100L, "Two");
+	BeaconCacheRecord dataThree(950L, "Three");
+
+	BeaconCacheEntry target;
+	target.addEventData(dataOne);
+	target.addActionData(dataTwo);
+	target.addActionData(dataThree);
+
+	// when
+	target.removeOldestRecords(2);
+
+	// then
+	ASSERT_EQ(target.getTotalNumberOfBytes(), dataThree.getDataSizeInBytes());
+}
+
+TEST_F(BeaconCacheEntryTest, removeRecordsOlderThanReducesTotalNumberOfBytes)
+{
+	// given
+	BeaconCacheRecord dataOne(1000L, "One");
+	BeaconCacheRecord dataTwo(1100L, "Two");
+	BeaconCacheRecord dataThree(950L, "Three");
+
+	BeaconCacheEntry target;
+	target.addEventData(dataOne);
+	target.addActionData(dataTwo);
+	target.addActionData(dataThree);
+
+	// when
+	target.removeRecordsOlderThan(1001L);
+
+	// then
+	ASSERT_EQ(target.getTotalNumberOfBytes(), dataTwo.getDataSizeInBytes());
+}
+
+TEST_F(BeaconCacheEntryTest, getOldestRecordsReturnsRecordsInEvictionOrder)
+{
+	// given
+	BeaconCacheEntry target;
+	target.addEventData(BeaconCacheRecord(1000L, "One"));
+	target.addActionData(BeaconCacheRecord(1100L, "Two"));
+	target.addActionData(BeaconCacheRecord(1000L, "Three"));
+	target.addEventData(BeaconCacheRecord(950L, "Four"));
+
+	// when
+	BeaconCacheRecordCursor cursor = { 0, 0 };
+	std::vector<BeaconCacheRecordSummary> obtained;
+	target.getOldestRecords(cursor, 10, obtained);
+
+	// then
+	ASSERT_EQ(obtained.size(), 4u);
+	ASSERT_EQ(obtained[0].timestamp, 1000L);
+	ASSERT_EQ(obtained[0].dataSizeInBytes, 3L);
+	ASSERT_EQ(obtained[1].timestamp, 950L);
+	ASSERT_EQ(obtained[1].dataSizeInBytes, 4L);
+	ASSERT_EQ(obtained[2].timestamp, 1100L);
+	ASSERT_EQ(obtained[2].dataSizeInBytes, 3L);
+	ASSERT_EQ(obtained[3].timestamp, 1000L);
+	ASSERT_EQ(obtained[3].dataSizeInBytes, 5L);
+}
+
+TEST_F(BeaconCacheEntryTest, getOldestRecordsStopsWhenMaxNumberOfRecordsIsReached)
+{
+	// given
+	BeaconCacheEntry target;
+	target.addEventData(BeaconCacheRecord(1000L, "One"));
+	target.addEventData(BeaconCacheRecord(1100L, "Two"));
+	target.addEventData(BeaconCacheRecord(1200L, "Three"));
+
+	// when
+	BeaconCacheRecordCursor cursor = { 0, 0 };
+	std::vector<BeaconCacheRecordSummary> obtained;
+	target.getOldestRecords(cursor, 2, obtained);
+
+	// then
+	ASSERT_EQ(obtained.size(), 2u);
+	ASSERT_EQ(obtained[0].timestamp, 1000L);
+	ASSERT_EQ(obtained[1].timestamp, 1100L);
+}
+
+TEST_F(BeaconCacheEntryTest, getOldestRecordsContinuesAtTheCursorPosition)
+{
+	// given
+	BeaconCacheEntry target;
+	target.addEventData(BeaconCacheRecord(1000L, "One"));
+	target.addActionData(BeaconCacheRecord(1100L, "Two"));
+	target.addActionData(BeaconCacheRecord(900L, "Three"));
+	target.addEventData(BeaconCacheRecord(1200L, "Four"));
+
+	// when
+	BeaconCacheRecordCursor cursor = { 0, 0 };
+	std::vector<BeaconCacheRecordSummary> first;
+	target.getOldestRecords(cursor, 2, first);
+	std::vector<BeaconCacheRecordSummary> second;
+	target.getOldestRecords(cursor, 2, second);
+	std::vector<BeaconCacheRecordSummary> third;
+	target.getOldestRecords(cursor, 2, third);
+
+	// then
+	ASSERT_EQ(first.size(), 2u);
+	ASSERT_EQ(first[0].timestamp, 1000L);
+	ASSERT_EQ(first[1].timestamp, 1100L);
+	ASSERT_EQ(second.size(), 2u);
+	ASSERT_EQ(second[0].timestamp, 900L);
+	ASSERT_EQ(second[1].timestamp, 1200L);
+	ASSERT_TRUE(third.empty());
+	ASSERT_EQ(cursor.eventIndex, 2u);
+	ASSERT_EQ(cursor.actionIndex, 2u);
+}
+
+TEST_F(BeaconCacheEntryTest, removeRecordsOlderThanRemovesRecordsAddedOutOfOrder)
+{
+	// given
+	BeaconCacheEntry target;
+	target.addEventData(BeaconCacheRecord(1000L, "One"));
+	target.addEventData(BeaconCacheRecord(900L, "Two"));
+	target.addEventData(BeaconCacheRecord(1100L, "Three"));
+	target.addEventData(BeaconCacheRecord(800L, "Four"));
+
+	// when
+	auto obtained = target.removeRecordsOlderThan(950L);
+
+	// then
+	ASSERT_EQ(obtained, 2);
+	auto eventData = target.getEventData();
+	ASSERT_EQ(eventData.size(), 2u);
+	ASSERT_TRUE(eventData.front().getData().equals("One"));
+	ASSERT_TRUE(eventData.back().getData().equals("Three"));
+
+	// and when
+	target.addEventData(BeaconCacheRecord(700L, "Five"));
+	obtained = target.removeRecordsOlderThan(960L);
+
+	// then
+	ASSERT_EQ(obtained, 1);
+	ASSERT_EQ(target.getEventData().size(), 2u);
+	ASSERT_EQ(target.getTotalNumberOfBytes(), 8L);
+}
+
+TEST_F(BeaconCacheEntryTest, removeRecordsOlderThanRemovesNothingIfAllRecordsAreNewer)
+{
+	// given
+	BeaconCacheEntry target;
+	target.addEventData(BeaconCacheRecord(1000L, "One"));
+	target.addActionData(BeaconCacheRecord(1100L, "Two"));
+
+	// when
+	auto obtained = target.removeRecordsOlderThan(1000L);
+
+	// then
+	ASSERT_EQ(obtained, 0);
+	ASSERT_EQ(target.getEventData().size(), 1u);
+	ASSERT_EQ(target.getActionData().size(), 1u);
+}
+
+TEST_F(BeaconCacheEntryTest, removeRecordsOlderThanRemovesRecordsWhichWereResetAfterSending)
+{
+	// given
+	BeaconCacheEntry target;
+	target.addEventData(BeaconCacheRecord(1000L, "One"));
+	target.addActionData(BeaconCacheRecord(1100L, "Two"));
+	target.copyDataForChunking();
+	target.addEventData(BeaconCacheRecord(2000L, "Three"));
+	target.resetDataMarkedForSending();
+
+	// when
+	auto obtained = target.removeRecordsOlderThan(1500L);
+
+	// then
+	ASSERT_EQ(obtained, 2);
+	auto eventData = target.getEventData();
+	ASSERT_EQ(eventData.size(), 1u);
+	ASSERT_TRUE(eventData.front().getData().equals("Three"));
+	ASSERT_TRUE(target.getActionData().empty());
+}
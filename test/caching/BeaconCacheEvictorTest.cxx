@@ -79,6 +79,24 @@ TEST_F(BeaconCacheEvictorTest, afterStartingABeaconCacheEvictorItIsAlive)
 
 
 
+TEST_F(BeaconCacheEvictorTest, theEvictorIsRegisteredAsObserverWhenStartReturns)
+{
+	// given
+	BeaconCacheEvictor evictor(mLogger, mMockBeaconCache, {});
+
+	// expect
+	EXPECT_CALL(*mMockBeaconCache, addObserver(testing::NotNull()))
+		.Times(testing::Exactly(1));
+
+	// when
+	evictor.start();
+
+	// then
+	ASSERT_TRUE(testing::Mock::VerifyAndClearExpectations(&*mMockBeaconCache));
+
+	evictor.stopAndJoin();
+}
+
 TEST_F(BeaconCacheEvictorTest, startingAnAlreadyAliveBeaconCacheEvictorDoesNothing)
 {
 	// given
@@ -227,3 +245,84 @@ TEST_F(BeaconCacheEvictorTest, triggeringEvictionStrategiesInThread)
 	ASSERT_TRUE(stopped);
 	ASSERT_FALSE(evictor.isAlive());
 }
+
+TEST_F(BeaconCacheEvictorTest, updateBelowNotificationThresholdDoesNotWakeUpEvictionThread)
+{
+	// given
+	std::vector<IObserver*> observers;
+	core::util::CountDownLatch addObserverLatch(1);
+
+	ON_CALL(*mMockBeaconCache, addObserver(testing::_))
+		.WillByDefault(testing::Invoke(
+			[&observers, &addObserverLatch](IObserver* observer) -> void
+			{
+				observers.push_back(observer);
+				addObserverLatch.countDown();
+			}
+		));
+	ON_CALL(*mMockBeaconCache, getNumBytesInCache())
+		.WillByDefault(testing::Return(int64_t(999)));
+
+	BeaconCacheEvictor evictor(mLogger, mMockBeaconCache, { mMockStrategyOne, mMockStrategyTwo }, 1000, std::chrono::hours(1));
+	evictor.start();
+	addObserverLatch.await();
+
+	// expect
+	EXPECT_CALL(*mMockStrategyOne, execute())
+		.Times(testing::Exactly(0));
+	EXPECT_CALL(*mMockStrategyTwo, execute())
+		.Times(testing::Exactly(0));
+
+	// when
+	observers.front()->update();
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+	// then
+	ASSERT_TRUE(evictor.stopAndJoin());
+}
+
+TEST_F(BeaconCacheEvictorTest, updatesBelowNotificationThresholdArePickedUpAfterNotificationInterval)
+{
+	// given
+	std::vector<IObserver*> observers;
+	core::util::CountDownLatch addObserverLatch(1);
+	core::util::CountDownLatch strategyInvokedLatch(1);
+
+	ON_CALL(*mMockBeaconCache, addObserver(testing::_))
+		.WillByDefault(testing::Invoke(
+			[&observers, &addObserverLatch](IObserver* observer) -> void
+			{
+				observers.push_back(observer);
+				addObserverLatch.countDown();
+			}
+		));
+	ON_CALL(*mMockBeaconCache, getNumBytesInCache())
+		.WillByDefault(testing::Return(int64_t(999)));
+	ON_CALL(*mMockStrategyTwo, execute())
+		.WillByDefault(testing::Invoke(
+			[&strategyInvokedLatch]() -> void
+			{
+				strategyInvokedLatch.countDown();
+			}
+		));
+
+	BeaconCacheEvictor evictor(mLogger, mMockBeaconCache, { mMockStrategyOne, mMockStrategyTwo }, 1000, std::chrono::milliseconds(10));
+	evictor.start();
+	addObserverLatch.await();
+
+	// expect
+	EXPECT_CALL(*mMockStrategyOne, execute())
+		.Times(testing::AtLeast(1));
+	EXPECT_CALL(*mMockStrategyTwo, execute())
+		.Times(testing::AtLeast(1));
+
+	// when
+	for (int i = 0; i < 10; i++)
+	{
+		observers.front()->update();
+	}
+	strategyInvokedLatch.await();
+
+	// then
+	ASSERT_TRUE(evictor.stopAndJoin());
+}
@@ -23,6 +23,8 @@
 #include "core/util/DefaultLogger.h"
 
 #include <algorithm>
+#include <thread>
+#include <vector>
 
 using namespace caching;
 
@@ -34,6 +36,15 @@ public:
 		mLogger = std::shared_ptr<openkit::ILogger>(new core::util::DefaultLogger(devNull, true));
 	}
 
+	///
+	/// Get the data of the next chunk, an empty string if there is no chunk
+	///
+	static core::UTF8String getNextBeaconChunkData(BeaconCache& target, int32_t beaconID, const core::UTF8String& chunkPrefix, int32_t maxSize, const core::UTF8String& delimiter)
+	{
+		auto chunk = target.getNextBeaconChunk(beaconID, chunkPrefix, maxSize, delimiter);
+		return chunk != nullptr ? chunk->toUTF8String() : core::UTF8String();
+	}
+
 	std::ostringstream devNull;
 	std::shared_ptr<openkit::ILogger> mLogger;
 };
@@ -309,10 +320,10 @@ TEST_F(BeaconCacheTest, getNextBeaconChunkReturnsNullIfGivenBeaconIDDoesNotExist
 	target.addEventData(1, 1000L, "iii");
 
 	// when
-	core::UTF8String obtained = target.getNextBeaconChunk(666, "", 1024, "&");
+	auto obtained = target.getNextBeaconChunk(666, "", 1024, "&");
 
 	// then
-	ASSERT_TRUE(obtained.empty());
+	ASSERT_EQ(obtained, nullptr);
 }
 
 TEST_F(BeaconCacheTest, getNextBeaconChunkCopiesDataForSending)
@@ -326,10 +337,10 @@ TEST_F(BeaconCacheTest, getNextBeaconChunkCopiesDataForSending)
 	target.addEventData(1, 1001L, "jjj");
 
 	// when
-	core::UTF8String obtained = target.getNextBeaconChunk(1, "prefix", 0, "&");
+	core::UTF8String obtained = getNextBeaconChunkData(target, 1, "prefix", 0, "&");
 
-	// then
-	ASSERT_TRUE(obtained.equals("prefix"));
+	// then the first record is added although it exceeds the maximum size
+	ASSERT_TRUE(obtained.equals("prefix&b"));
 
 	ASSERT_TRUE(target.getActions(1).empty());
 	ASSERT_TRUE(target.getEvents(1).empty());
@@ -376,7 +387,7 @@ TEST_F(BeaconCacheTest, getNextBeaconChunkRetrievesNextChunk)
 	target.addEventData(1, 1001L, "jjj");
 
 	// when
-	core::UTF8String obtained = target.getNextBeaconChunk(1, "prefix", 10, "&");
+	core::UTF8String obtained = getNextBeaconChunkData(target, 1, "prefix", 12, "&");
 
 	// then
 	ASSERT_TRUE(obtained.equals("prefix&b&jjj"));
@@ -399,6 +410,23 @@ TEST_F(BeaconCacheTest, getNextBeaconChunkRetrievesNextChunk)
 	ASSERT_TRUE(it2->isMarkedForSending());
 }
 
+TEST_F(BeaconCacheTest, getNextBeaconChunkStaysValidWhenCacheEntryIsDeleted)
+{
+	// given
+	BeaconCache target(mLogger);
+	target.addActionData(1, 1000L, "a");
+	target.addEventData(1, 1001L, "b");
+	auto obtained = target.getNextBeaconChunk(1, "prefix", 1024, "&");
+
+	// when
+	target.deleteCacheEntry(1);
+
+	// then
+	ASSERT_NE(obtained, nullptr);
+	ASSERT_EQ(obtained->getNumberOfRecords(), 2u);
+	ASSERT_TRUE(obtained->toUTF8String().equals("prefix&b&a"));
+}
+
 TEST_F(BeaconCacheTest, removeChunkedDataClearsAlreadyRetrievedChunks)
 {
 	// given
@@ -410,7 +438,7 @@ TEST_F(BeaconCacheTest, removeChunkedDataClearsAlreadyRetrievedChunks)
 	target.addEventData(1, 1001L, "jjj");
 
 	// when retrieving the first chunk and removing retrieved chunks
-	core::UTF8String obtained = target.getNextBeaconChunk(1, "prefix", 10, "&");
+	core::UTF8String obtained = getNextBeaconChunkData(target, 1, "prefix", 12, "&");
 	target.removeChunkedData(1);
 
 	// then
@@ -426,7 +454,7 @@ TEST_F(BeaconCacheTest, removeChunkedDataClearsAlreadyRetrievedChunks)
 	ASSERT_TRUE(target.getEventsBeingSent(1).empty());
 	
 	// when retrieving the second chunk and removing retrieved chunks
-	obtained = target.getNextBeaconChunk(1, "prefix", 10, "&");
+	obtained = getNextBeaconChunkData(target, 1, "prefix", 12, "&");
 	target.removeChunkedData(1);
 
 	// then
@@ -447,7 +475,7 @@ TEST_F(BeaconCacheTest, removeChunkedDataDoesNothingIfCalledWithNonExistingBeaco
 	target.addEventData(1, 1001L, "jjj");
 
 	// when retrieving the first chunk and removing retrieved chunks
-	core::UTF8String obtained = target.getNextBeaconChunk(1, "prefix", 10, "&");
+	core::UTF8String obtained = getNextBeaconChunkData(target, 1, "prefix", 12, "&");
 	target.removeChunkedData(2);
 
 	// then
@@ -684,3 +712,150 @@ TEST_F(BeaconCacheTest, isEmptyGivesTrueIfBeaconDoesNotContainActiveData)
 	ASSERT_TRUE(target.isEmpty(1));
 }
 
+TEST_F(BeaconCacheTest, beaconIDsOfAllShardsAreReturned)
+{
+	// given
+	BeaconCache target(mLogger);
+	std::unordered_set<int32_t> expected;
+	for (int32_t beaconID = -5; beaconID < static_cast<int32_t>(3 * BeaconCache::NUMBER_OF_SHARDS); beaconID++)
+	{
+		target.addEventData(beaconID, 1000L, "a");
+		expected.insert(beaconID);
+	}
+
+	// when
+	auto obtained = target.getBeaconIDs();
+
+	// then
+	ASSERT_EQ(obtained, expected);
+}
+
+TEST_F(BeaconCacheTest, deleteCacheEntryDoesNotAffectBeaconsInOtherShards)
+{
+	// given
+	BeaconCache target(mLogger);
+	auto otherBeaconID = static_cast<int32_t>(BeaconCache::NUMBER_OF_SHARDS);
+	target.addEventData(0, 1000L, "a");
+	target.addEventData(otherBeaconID, 1000L, "b");
+	target.addEventData(1, 1000L, "c");
+
+	// when
+	target.deleteCacheEntry(0);
+
+	// then
+	ASSERT_EQ(target.getBeaconIDs(), std::unordered_set<int32_t>({ otherBeaconID, 1 }));
+	ASSERT_EQ(target.getEvents(otherBeaconID), std::vector<core::UTF8String>{ core::UTF8String("b") });
+	ASSERT_EQ(target.getNumBytesInCache(), 2L);
+}
+
+TEST_F(BeaconCacheTest, concurrentlyAddedDataIsCached)
+{
+	// given
+	std::ostringstream output;
+	BeaconCache target(std::make_shared<core::util::DefaultLogger>(output, false));
+	const int32_t numThreads = 8;
+	const int32_t numBeaconsPerThread = 10;
+	const int32_t numRecordsPerBeacon = 50;
+
+	// when
+	std::vector<std::thread> threads;
+	for (int32_t threadIndex = 0; threadIndex < numThreads; threadIndex++)
+	{
+		threads.emplace_back([&target, threadIndex]()
+		{
+			for (int32_t record = 0; record < numRecordsPerBeacon; record++)
+			{
+				for (int32_t beacon = 0; beacon < numBeaconsPerThread; beacon++)
+				{
+					// every thread writes to its own beacons and to one beacon shared by all threads
+					target.addEventData(threadIndex * numBeaconsPerThread + beacon, record, "ab");
+					target.addActionData(-1, record, "a");
+				}
+			}
+		});
+	}
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	// then
+	ASSERT_EQ(target.getBeaconIDs().size(), static_cast<size_t>(numThreads * numBeaconsPerThread + 1));
+	ASSERT_EQ(target.getNumBytesInCache(), int64_t(numThreads) * numBeaconsPerThread * numRecordsPerBeacon * 3);
+	ASSERT_EQ(target.getEvents(0).size(), static_cast<size_t>(numRecordsPerBeacon));
+	ASSERT_EQ(target.getActions(-1).size(), static_cast<size_t>(numThreads * numBeaconsPerThread * numRecordsPerBeacon));
+}
+
+TEST_F(BeaconCacheTest, evictRecordsByNumberReducesNumBytesInCache)
+{
+	// given
+	BeaconCache target(mLogger);
+	target.addActionData(1, 1000L, "a");
+	target.addActionData(1, 1001L, "iii");
+	target.addEventData(1, 1000L, "b");
+	target.addEventData(1, 1001L, "jjj");
+
+	// when
+	target.evictRecordsByNumber(1, 2);
+
+	// then
+	ASSERT_EQ(target.getNumBytesInCache(), 6L);
+}
+
+TEST_F(BeaconCacheTest, evictRecordsByAgeReducesNumBytesInCache)
+{
+	// given
+	BeaconCache target(mLogger);
+	target.addActionData(1, 1000L, "a");
+	target.addActionData(1, 1001L, "iii");
+	target.addEventData(1, 1000L, "b");
+	target.addEventData(1, 1001L, "jjj");
+
+	// when
+	target.evictRecordsByAge(1, 1001L);
+
+	// then
+	ASSERT_EQ(target.getNumBytesInCache(), 6L);
+	ASSERT_FALSE(target.isEmpty(1));
+
+	// and when
+	target.evictRecordsByAge(1, 1002L);
+
+	// then
+	ASSERT_EQ(target.getNumBytesInCache(), 0L);
+	ASSERT_TRUE(target.isEmpty(1));
+}
+
+TEST_F(BeaconCacheTest, getOldestRecordsReturnsEmptyVectorIfBeaconIDDoesNotExist)
+{
+	// given
+	BeaconCache target(mLogger);
+	target.addActionData(1, 1000L, "a");
+
+	// when
+	BeaconCacheRecordCursor cursor = { 0, 0 };
+	auto obtained = target.getOldestRecords(666, cursor, 10);
+
+	// then
+	ASSERT_TRUE(obtained.empty());
+}
+
+TEST_F(BeaconCacheTest, getOldestRecordsReturnsRecordsOfGivenBeacon)
+{
+	// given
+	BeaconCache target(mLogger);
+	target.addActionData(1, 1001L, "iii");
+	target.addEventData(1, 1000L, "b");
+	target.addEventData(2, 999L, "x");
+
+	// when
+	BeaconCacheRecordCursor cursor = { 0, 0 };
+	auto obtained = target.getOldestRecords(1, cursor, 10);
+
+	// then
+	ASSERT_EQ(obtained.size(), 2u);
+	ASSERT_EQ(obtained[0].timestamp, 1000L);
+	ASSERT_EQ(obtained[0].dataSizeInBytes, 1L);
+	ASSERT_EQ(obtained[1].timestamp, 1001L);
+	ASSERT_EQ(obtained[1].dataSizeInBytes, 3L);
+}
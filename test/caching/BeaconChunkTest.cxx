@@ -0,0 +1,108 @@
+/**
+* Copyright 2018 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#include "gtest/gtest.h"
+
+#include "caching/BeaconChunk.h"
+#include "core/UTF8String.h"
+#include "core/UTF8StringView.h"
+
+using namespace caching;
+
+class BeaconChunkTest : public testing::Test
+{
+};
+
+TEST_F(BeaconChunkTest, aNewChunkContainsOnlyThePrefix)
+{
+	// given
+	BeaconChunk target(core::UTF8String("prefix"), core::UTF8String("&"));
+
+	// then
+	ASSERT_EQ(target.getNumberOfRecords(), 0u);
+	ASSERT_EQ(target.getSegments().size(), 1u);
+	ASSERT_EQ(target.getByteLength(), 6u);
+	ASSERT_EQ(target.getStringLength(), 6u);
+	ASSERT_EQ(target.toUTF8String(), core::UTF8String("prefix"));
+}
+
+TEST_F(BeaconChunkTest, appendedRecordsArePrecededByTheDelimiter)
+{
+	// given
+	BeaconChunk target(core::UTF8String("prefix"), core::UTF8String("&"));
+	core::UTF8String first("a=b");
+	core::UTF8String second("c=d");
+
+	// when
+	target.appendRecord(core::UTF8StringView(first));
+	target.appendRecord(core::UTF8StringView(second));
+
+	// then
+	ASSERT_EQ(target.getNumberOfRecords(), 2u);
+	ASSERT_EQ(target.getSegments().size(), 5u);
+	ASSERT_EQ(target.toUTF8String(), core::UTF8String("prefix&a=b&c=d"));
+}
+
+TEST_F(BeaconChunkTest, recordsAreReferencedInPlace)
+{
+	// given
+	BeaconChunk target(core::UTF8String("prefix"), core::UTF8String("&"));
+	core::UTF8String record("a=b");
+
+	// when
+	target.appendRecord(core::UTF8StringView(record));
+
+	// then
+	ASSERT_EQ(target.getSegments().back().getData(), record.getStringData().data());
+}
+
+TEST_F(BeaconChunkTest, lengthsAccountForMultibyteCharacters)
+{
+	// given
+	BeaconChunk target(core::UTF8String("p\xC3\xA4"), core::UTF8String("&"));
+	core::UTF8String record("\xE2\x82\xAC");
+
+	// when
+	target.appendRecord(core::UTF8StringView(record));
+
+	// then
+	ASSERT_EQ(target.getByteLength(), 3u + 1u + 3u);
+	ASSERT_EQ(target.getStringLength(), 2u + 1u + 1u);
+}
+
+TEST_F(BeaconChunkTest, dataOwnerIsKeptAliveByTheChunk)
+{
+	// given
+	auto owner = std::make_shared<core::UTF8String>("a=b");
+	std::weak_ptr<core::UTF8String> weakOwner = owner;
+	auto target = std::make_shared<BeaconChunk>(core::UTF8String("prefix"), core::UTF8String("&"));
+	target->appendRecord(core::UTF8StringView(*owner));
+	target->setDataOwner(owner);
+
+	// when
+	owner.reset();
+
+	// then
+	ASSERT_FALSE(weakOwner.expired());
+	ASSERT_EQ(target->toUTF8String(), core::UTF8String("prefix&a=b"));
+
+	// and when
+	target.reset();
+
+	// then
+	ASSERT_TRUE(weakOwner.expired());
+}
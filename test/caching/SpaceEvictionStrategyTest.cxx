@@ -23,6 +23,7 @@
 #include "core/util/DefaultLogger.h"
 #include "../caching/MockBeaconCache.h"
 
+#include <map>
 #include <memory>
 
 using namespace configuration;
@@ -70,6 +71,23 @@ public:
 	{
 		return true;
 	}
+
+	void mockOldestRecords(const std::map<int32_t, std::vector<BeaconCacheRecordSummary>>& recordsPerBeacon)
+	{
+		// serve the records in batches, using the cursor's event index as position
+		ON_CALL(*mMockBeaconCache, getOldestRecords(testing::_, testing::_, testing::_))
+			.WillByDefault(testing::Invoke(
+				[recordsPerBeacon](int32_t beaconID, BeaconCacheRecordCursor& cursor, uint32_t maxNumRecords) -> std::vector<BeaconCacheRecordSummary> {
+			std::vector<BeaconCacheRecordSummary> result;
+			auto it = recordsPerBeacon.find(beaconID);
+			while (it != recordsPerBeacon.end() && cursor.eventIndex < it->second.size() && result.size() < maxNumRecords)
+			{
+				result.push_back(it->second[cursor.eventIndex++]);
+			}
+			return result;
+		}
+		));
+	}
 };
 
 TEST_F(SpaceEvictionStrategyTest, theStrategyIsDisabledIfCacheSizeLowerBoundIsEqualToZero)
@@ -206,14 +224,14 @@ TEST_F(SpaceEvictionStrategyTest, executeEvictionCallsCacheMethodForEachBeacon)
 	SpaceEvictionStrategy target(mLogger, mMockBeaconCache, configuration, std::bind(&SpaceEvictionStrategyTest::mockedIsAliveFunctionAlwaysTrue, this));
 	ON_CALL(*mMockBeaconCache, getBeaconIDs())
 		.WillByDefault(testing::Return(std::unordered_set<int32_t>({ 1, 42 })));
+	mockOldestRecords({ { 1, { { 1000L, 600L } } }, { 42, { { 1001L, 600L } } } });
 
 	// then
 	EXPECT_CALL(*mMockBeaconCache, getNumBytesInCache())
 		.WillOnce(testing::Return(2001L))		// 2001 for SpaceEvictionStrategy::shouldRun()
-		.WillOnce(testing::Return(2001L))		// 2001 for outer while loop in SpaceEvictionStrategy::doExecute()
-		.WillOnce(testing::Return(2001L))		// 2001 for inner while loop in SpaceEvictionStrategy::doExecute() which evicts beaconID 1
-		.WillOnce(testing::Return(2001L))		// 2001 for inner while loop in SpaceEvictionStrategy::doExecute() which evicts beaconID 42
-		.WillOnce(testing::Return(0L));			// 0 for outer while loop in SpaceEvictionStrategy::doExecute() (to exit the while loop)
+		.WillOnce(testing::Return(2001L))		// 2001 for while loop in SpaceEvictionStrategy::doExecute()
+		.WillOnce(testing::Return(2001L))		// 2001 to calculate the number of bytes to evict
+		.WillOnce(testing::Return(0L));			// 0 for while loop in SpaceEvictionStrategy::doExecute() (to exit the while loop)
 	EXPECT_CALL(*mMockBeaconCache, evictRecordsByNumber(1, 1))
 		.Times(testing::Exactly(1));
 	EXPECT_CALL(*mMockBeaconCache, evictRecordsByNumber(42, 1))
@@ -223,6 +241,69 @@ TEST_F(SpaceEvictionStrategyTest, executeEvictionCallsCacheMethodForEachBeacon)
 	target.execute();
 }
 
+TEST_F(SpaceEvictionStrategyTest, executeEvictionSelectsOldestRecordsAcrossAllBeacons)
+{
+	// given
+	auto configuration = std::make_shared<BeaconCacheConfiguration>(1000L, 1000L, 1200L);
+	SpaceEvictionStrategy target(mLogger, mMockBeaconCache, configuration, std::bind(&SpaceEvictionStrategyTest::mockedIsAliveFunctionAlwaysTrue, this));
+	ON_CALL(*mMockBeaconCache, getBeaconIDs())
+		.WillByDefault(testing::Return(std::unordered_set<int32_t>({ 1, 42, 666 })));
+	mockOldestRecords({
+		{ 1, { { 1L, 100L }, { 3L, 100L }, { 5L, 100L }, { 7L, 100L } } },
+		{ 42, { { 2L, 100L }, { 4L, 100L }, { 6L, 100L }, { 8L, 100L } } },
+		{ 666, { { 9L, 100L } } }
+	});
+
+	// then
+	EXPECT_CALL(*mMockBeaconCache, getNumBytesInCache())
+		.WillOnce(testing::Return(1350L))		// 1350 for SpaceEvictionStrategy::shouldRun()
+		.WillOnce(testing::Return(1350L))		// 1350 for while loop in SpaceEvictionStrategy::doExecute()
+		.WillOnce(testing::Return(1350L))		// 1350 to calculate the number of bytes to evict
+		.WillRepeatedly(testing::Return(950L));	// 950 after eviction
+	EXPECT_CALL(*mMockBeaconCache, evictRecordsByNumber(1, 2))
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mMockBeaconCache, evictRecordsByNumber(42, 2))
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mMockBeaconCache, evictRecordsByNumber(666, testing::_))
+		.Times(testing::Exactly(0));
+
+	// when
+	target.execute();
+}
+
+TEST_F(SpaceEvictionStrategyTest, executeEvictionFetchesFurtherRecordsOfABeaconOnlyWhenNeeded)
+{
+	// given
+	auto configuration = std::make_shared<BeaconCacheConfiguration>(1000L, 1000L, 1200L);
+	SpaceEvictionStrategy target(mLogger, mMockBeaconCache, configuration, std::bind(&SpaceEvictionStrategyTest::mockedIsAliveFunctionAlwaysTrue, this));
+	std::vector<BeaconCacheRecordSummary> manyRecords;
+	for (int64_t timestamp = 1; timestamp <= 100; timestamp++)
+	{
+		manyRecords.push_back({ timestamp, 100L });
+	}
+	ON_CALL(*mMockBeaconCache, getBeaconIDs())
+		.WillByDefault(testing::Return(std::unordered_set<int32_t>({ 1, 42 })));
+	mockOldestRecords({ { 1, manyRecords }, { 42, { { 1000L, 100L } } } });
+
+	// then
+	EXPECT_CALL(*mMockBeaconCache, getNumBytesInCache())
+		.WillOnce(testing::Return(1350L))		// 1350 for SpaceEvictionStrategy::shouldRun()
+		.WillOnce(testing::Return(1350L))		// 1350 for while loop in SpaceEvictionStrategy::doExecute()
+		.WillOnce(testing::Return(1350L))		// 1350 to calculate the number of bytes to evict
+		.WillRepeatedly(testing::Return(950L));	// 950 after eviction
+	EXPECT_CALL(*mMockBeaconCache, getOldestRecords(1, testing::_, testing::_))
+		.Times(testing::Exactly(2));			// the oldest record and one further batch
+	EXPECT_CALL(*mMockBeaconCache, getOldestRecords(42, testing::_, testing::_))
+		.Times(testing::Exactly(1));			// the oldest record only
+	EXPECT_CALL(*mMockBeaconCache, evictRecordsByNumber(1, 4))
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mMockBeaconCache, evictRecordsByNumber(42, testing::_))
+		.Times(testing::Exactly(0));
+
+	// when
+	target.execute();
+}
+
 TEST_F(SpaceEvictionStrategyTest, executeEvictionLogsEvictionResultIfDebugIsEnabled)
 {
 	// given
@@ -233,12 +314,12 @@ TEST_F(SpaceEvictionStrategyTest, executeEvictionLogsEvictionResultIfDebugIsEnab
 
 	EXPECT_CALL(*mMockBeaconCache, getNumBytesInCache())
 		.WillOnce(testing::Return(2001L))		// 2001 for SpaceEvictionStrategy::shouldRun()
-		.WillOnce(testing::Return(2001L))		// 2001 for outer while loop in SpaceEvictionStrategy::doExecute()
-		.WillOnce(testing::Return(2001L))		// 2001 for inner while loop in SpaceEvictionStrategy::doExecute() which evicts beaconID 1
-		.WillOnce(testing::Return(2001L))		// 2001 for inner while loop in SpaceEvictionStrategy::doExecute() which evicts beaconID 42
-		.WillOnce(testing::Return(0L));			// 0 for outer while loop in SpaceEvictionStrategy::doExecute() (to exit the while loop)
+		.WillOnce(testing::Return(2001L))		// 2001 for while loop in SpaceEvictionStrategy::doExecute()
+		.WillOnce(testing::Return(2001L))		// 2001 to calculate the number of bytes to evict
+		.WillOnce(testing::Return(0L));			// 0 for while loop in SpaceEvictionStrategy::doExecute() (to exit the while loop)
 	ON_CALL(*mMockBeaconCache, getBeaconIDs())
 		.WillByDefault(testing::Return(std::unordered_set<int32_t>({ 1, 42 })));
+	mockOldestRecords({ { 1, { { 1000L, 600L } } }, { 42, { { 1000L, 600L } } } });
 	ON_CALL(*mMockBeaconCache, evictRecordsByNumber(1, testing::_))
 		.WillByDefault(testing::Return(5));
 	ON_CALL(*mMockBeaconCache, evictRecordsByNumber(42, testing::_))
@@ -264,12 +345,12 @@ TEST_F(SpaceEvictionStrategyTest, executeEvictionDoesNotLogEvictionResultIfDebug
 
 	EXPECT_CALL(*mMockBeaconCache, getNumBytesInCache())
 		.WillOnce(testing::Return(2001L))		// 2001 for SpaceEvictionStrategy::shouldRun()
-		.WillOnce(testing::Return(2001L))		// 2001 for outer while loop in SpaceEvictionStrategy::doExecute()
-		.WillOnce(testing::Return(2001L))		// 2001 for inner while loop in SpaceEvictionStrategy::doExecute() which evicts beaconID 1
-		.WillOnce(testing::Return(2001L))		// 2001 for inner while loop in SpaceEvictionStrategy::doExecute() which evicts beaconID 42
-		.WillOnce(testing::Return(0L));			// 0 for outer while loop in SpaceEvictionStrategy::doExecute() (to exit the while loop)
+		.WillOnce(testing::Return(2001L))		// 2001 for while loop in SpaceEvictionStrategy::doExecute()
+		.WillOnce(testing::Return(2001L))		// 2001 to calculate the number of bytes to evict
+		.WillOnce(testing::Return(0L));			// 0 for while loop in SpaceEvictionStrategy::doExecute() (to exit the while loop)
 	ON_CALL(*mMockBeaconCache, getBeaconIDs())
 		.WillByDefault(testing::Return(std::unordered_set<int32_t>({ 1, 42 })));
+	mockOldestRecords({ { 1, { { 1000L, 600L } } }, { 42, { { 1000L, 600L } } } });
 	ON_CALL(*mMockBeaconCache, evictRecordsByNumber(1, testing::_))
 		.WillByDefault(testing::Return(5));
 	ON_CALL(*mMockBeaconCache, evictRecordsByNumber(42, testing::_))
@@ -290,22 +371,42 @@ TEST_F(SpaceEvictionStrategyTest, executeEvictionRunsUntilTheCacheSizeIsLessThan
 
 	ON_CALL(*mMockBeaconCache, getBeaconIDs())
 		.WillByDefault(testing::Return(std::unordered_set<int32_t>({ 1, 42 })));
+	mockOldestRecords({ { 1, { { 1000L, 1000L } } }, { 42, { { 1000L, 1000L } } } });
 
 	// then
 	EXPECT_CALL(*mMockBeaconCache, getNumBytesInCache())
 		.WillOnce(testing::Return(2001L))		// 2001 for SpaceEvictionStrategy::shouldRun()
-		.WillOnce(testing::Return(2000L))		// 2000 for outer while loop in SpaceEvictionStrategy::doExecute()
-		.WillOnce(testing::Return(2000L))		// 2000 for inner while loop in SpaceEvictionStrategy::doExecute() which evicts beaconID 1
-		.WillOnce(testing::Return(2000L))		// 2000 for inner while loop in SpaceEvictionStrategy::doExecute() which evicts beaconID 42
-		.WillOnce(testing::Return(1500L))		// 1500 for outer while loop (second iteration) in SpaceEvictionStrategy::doExecute()
-		.WillOnce(testing::Return(1500L))		// 1500 for inner while loop in SpaceEvictionStrategy::doExecute() which evicts beaconID 1
-		.WillOnce(testing::Return(1500L))		// 1500 for inner while loop in SpaceEvictionStrategy::doExecute() which evicts beaconID 42
-		.WillOnce(testing::Return(1000L))		// 1000 for outer while loop in SpaceEvictionStrategy::doExecute() (to exit the while loop)
+		.WillOnce(testing::Return(2000L))		// 2000 for while loop in SpaceEvictionStrategy::doExecute()
+		.WillOnce(testing::Return(2000L))		// 2000 to calculate the number of bytes to evict
+		.WillOnce(testing::Return(1500L))		// 1500 for while loop (second iteration), e.g. data was added concurrently
+		.WillOnce(testing::Return(1500L))		// 1500 to calculate the number of bytes to evict
+		.WillOnce(testing::Return(1000L))		// 1000 for while loop in SpaceEvictionStrategy::doExecute() (to exit the while loop)
 		.WillRepeatedly(testing::Return(0L));	// just for safety
-	EXPECT_CALL(*mMockBeaconCache, evictRecordsByNumber(1, 1))
+	EXPECT_CALL(*mMockBeaconCache, getOldestRecords(testing::_, testing::_, 1))
+		.Times(testing::Exactly(4));
+	EXPECT_CALL(*mMockBeaconCache, evictRecordsByNumber(testing::_, 1))
 		.Times(testing::Exactly(2));
-	EXPECT_CALL(*mMockBeaconCache, evictRecordsByNumber(42, 1))
+
+	// when
+	target.execute();
+}
+
+TEST_F(SpaceEvictionStrategyTest, executeEvictionStopsIfThereAreNoRecordsToEvict)
+{
+	// given
+	auto configuration = std::make_shared<BeaconCacheConfiguration>(1000L, 1000L, 2000L);
+	SpaceEvictionStrategy target(mLogger, mMockBeaconCache, configuration, std::bind(&SpaceEvictionStrategyTest::mockedIsAliveFunctionAlwaysTrue, this));
+
+	ON_CALL(*mMockBeaconCache, getBeaconIDs())
+		.WillByDefault(testing::Return(std::unordered_set<int32_t>({ 1, 42 })));
+	ON_CALL(*mMockBeaconCache, getNumBytesInCache())
+		.WillByDefault(testing::Return(2001L));
+
+	// then
+	EXPECT_CALL(*mMockBeaconCache, getOldestRecords(testing::_, testing::_, testing::_))
 		.Times(testing::Exactly(2));
+	EXPECT_CALL(*mMockBeaconCache, evictRecordsByNumber(testing::_, testing::_))
+		.Times(testing::Exactly(0));
 
 	// when
 	target.execute();
@@ -322,20 +423,21 @@ TEST_F(SpaceEvictionStrategyTest, executeEvictionStopsIfThreadGetsInterruptedBet
 	ON_CALL(*mockIsAlive, isAlive())
 		.WillByDefault(testing::Invoke(
 			[&callCountIsAlive]() -> bool {
-		// isAlive shall return "false" after the 2nd call
+		// isAlive shall return "false" after the 4th call
 		callCountIsAlive++;
-		return callCountIsAlive <= 2;
+		return callCountIsAlive <= 4;
 	}
 	));
 	ON_CALL(*mMockBeaconCache, getBeaconIDs())
 		.WillByDefault(testing::Return(std::unordered_set<int32_t>({ 1, 42 })));
+	mockOldestRecords({ { 1, { { 1000L, 600L } } }, { 42, { { 1000L, 600L } } } });
 
 	// then
 	EXPECT_CALL(*mMockBeaconCache, getNumBytesInCache())
 		.WillOnce(testing::Return(2001L))		// 2001 for SpaceEvictionStrategy::shouldRun()
-		.WillOnce(testing::Return(2000L))		// 2000 for outer while loop in SpaceEvictionStrategy::doExecute()
-		.WillOnce(testing::Return(2000L))		// 2000 for inner while loop in SpaceEvictionStrategy::doExecute() which evicts beaconID 1
-		.WillRepeatedly(testing::Return(0L));	// just for safety
+		.WillOnce(testing::Return(2000L))		// 2000 for while loop in SpaceEvictionStrategy::doExecute()
+		.WillOnce(testing::Return(2000L))		// 2000 to calculate the number of bytes to evict
+		.WillRepeatedly(testing::Return(2000L));
 	EXPECT_CALL(*mMockBeaconCache, evictRecordsByNumber(testing::_, 1))
 		.Times(testing::Exactly(1));
 	
@@ -343,26 +445,33 @@ TEST_F(SpaceEvictionStrategyTest, executeEvictionStopsIfThreadGetsInterruptedBet
 	target.execute();
 }
 
-TEST_F(SpaceEvictionStrategyTest, executeEvictionStopsIfNumBytesInCacheFallsBelowLowerBoundBetweenTwoBeacons)
+TEST_F(SpaceEvictionStrategyTest, executeEvictionStopsIfThreadGetsInterruptedWhileSelectingRecords)
 {
 	// given
 	auto configuration = std::make_shared<BeaconCacheConfiguration>(1000L, 1000L, 2000L);
-	SpaceEvictionStrategy target(mLogger, mMockBeaconCache, configuration, std::bind(&SpaceEvictionStrategyTest::mockedIsAliveFunctionAlwaysTrue, this));
+	auto mockIsAlive = std::shared_ptr<testing::NiceMock<MockIsAlive>>(new testing::NiceMock<MockIsAlive>());
+	SpaceEvictionStrategy target(mLogger, mMockBeaconCache, configuration, std::bind(&MockIsAlive::isAlive, mockIsAlive));
+
+	uint32_t callCountIsAlive = 0;
+	ON_CALL(*mockIsAlive, isAlive())
+		.WillByDefault(testing::Invoke(
+			[&callCountIsAlive]() -> bool {
+		// isAlive shall return "false" after the 2nd call
+		callCountIsAlive++;
+		return callCountIsAlive <= 2;
+	}
+	));
 	ON_CALL(*mMockBeaconCache, getBeaconIDs())
 		.WillByDefault(testing::Return(std::unordered_set<int32_t>({ 1, 42 })));
+	mockOldestRecords({ { 1, { { 1000L, 600L } } }, { 42, { { 1000L, 600L } } } });
+	ON_CALL(*mMockBeaconCache, getNumBytesInCache())
+		.WillByDefault(testing::Return(2001L));
 
 	// then
-	EXPECT_CALL(*mMockBeaconCache, getNumBytesInCache())
-		.WillOnce(testing::Return(2001L))		// 2001 for SpaceEvictionStrategy::shouldRun()
-		.WillOnce(testing::Return(2000L))		// 2000 for outer while loop in SpaceEvictionStrategy::doExecute()
-		.WillOnce(testing::Return(2000L))		// 2000 for inner while loop in SpaceEvictionStrategy::doExecute() which evicts beaconID 1
-		.WillOnce(testing::Return(2000L))		// 2000 for inner while loop in SpaceEvictionStrategy::doExecute() which evicts beaconID 42
-		.WillOnce(testing::Return(1500L))		// 1500 for outer while loop (second iteration) in SpaceEvictionStrategy::doExecute()
-		.WillOnce(testing::Return(1500L))		// 1500 for inner while loop in SpaceEvictionStrategy::doExecute() which evicts beaconID 1
-		.WillOnce(testing::Return(1000L))		// 1000 for outer while loop in SpaceEvictionStrategy::doExecute() (to exit the while loop)
-		.WillRepeatedly(testing::Return(0L));	// just for safety
-	EXPECT_CALL(*mMockBeaconCache, evictRecordsByNumber(testing::An<int32_t>(), 1))
-		.Times(testing::Exactly(3));
+	EXPECT_CALL(*mMockBeaconCache, getOldestRecords(testing::_, testing::_, testing::_))
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mMockBeaconCache, evictRecordsByNumber(testing::_, testing::_))
+		.Times(testing::Exactly(0));
 	
 	// when
 	target.execute();
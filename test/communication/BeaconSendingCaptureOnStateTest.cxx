@@ -19,14 +19,21 @@
 
 #include "communication/BeaconSendingCaptureOnState.h"
 #include "communication/BeaconSendingCaptureOffState.h"
+#include "communication/BeaconSendingTimeSyncState.h"
 #include "communication/AbstractBeaconSendingState.h"
 
 #include "../communication/MockBeaconSendingContext.h"
 #include "../communication/CustomMatchers.h"
 #include "../protocol/MockStatusResponse.h"
 #include "../providers/MockHTTPClientProvider.h"
+#include "../protocol/MockHTTPMultiClient.h"
 #include "../core/MockSession.h"
 
+#include <algorithm>
+#include <deque>
+#include <limits>
+#include <map>
+
 class BeaconSendingCaptureOnStateTest : public testing::Test
 {
 public:
@@ -41,7 +48,64 @@ public:
 		, mMockHttpClientProvider(nullptr)
 		, mMockHttpClient(nullptr)
 		, mHttpClientConfiguration(nullptr)
+		, mMockMultiClient(nullptr)
+		, mBeaconResponses()
+		, mStartedRequests()
+		, mNextRequestID(1)
+		, mMaxRequestsInFlight(0)
+	{
+	}
+
+	///
+	/// Let the given session send a single beacon chunk, for which the mocked multi client reports the given response
+	///
+	void mockBeaconResponse(std::shared_ptr<testing::NiceMock<test::MockSession>> session, int32_t responseCode,
+		const protocol::Response::ResponseHeaders& responseHeaders = protocol::Response::ResponseHeaders())
+	{
+		auto requestID = mNextRequestID++;
+		mBeaconResponses[requestID] = std::make_shared<protocol::StatusResponse>(mLogger, "", responseCode, responseHeaders);
+		auto isChunkSent = std::make_shared<bool>(false);
+		ON_CALL(*session, sendNextBeaconChunk(testing::_))
+			.WillByDefault(testing::Invoke([this, requestID, isChunkSent](std::shared_ptr<protocol::IHTTPMultiClient>)
+			{
+				if (*isChunkSent)
+				{
+					return protocol::IHTTPMultiClient::INVALID_REQUEST_ID;
+				}
+				*isChunkSent = true;
+				mStartedRequests.push_back(requestID);
+				mMaxRequestsInFlight = std::max(mMaxRequestsInFlight, mStartedRequests.size());
+				return requestID;
+			}));
+	}
+
+	///
+	/// Create a context sharing the HTTP client of @c mMockContext, but with the given new session request batch window
+	///
+	std::shared_ptr<testing::NiceMock<test::MockBeaconSendingContext>> createContextWithNewSessionRequestBatchWindow(int64_t batchWindow)
 	{
+		auto configuration = std::make_shared<configuration::Configuration>(std::shared_ptr<configuration::Device>(new configuration::Device("", "", "")), configuration::OpenKitType::Type::DYNATRACE,
+			core::UTF8String(""), core::UTF8String(""), core::UTF8String(""), core::UTF8String("1"), core::UTF8String(""),
+			std::make_shared<providers::DefaultSessionIDProvider>(),
+			std::make_shared<protocol::SSLStrictTrustManager>(),
+			std::make_shared<configuration::BeaconCacheConfiguration>(-1, -1, -1),
+			std::make_shared<configuration::BeaconConfiguration>(),
+			configuration::HTTPClientConfiguration::DEFAULT_HTTP_CLIENT_POOL_SIZE,
+			configuration::HTTPClientConfiguration::DEFAULT_HTTP_CLIENT_IDLE_TIMEOUT_IN_MILLIS,
+			configuration::HTTPClientConfiguration::DEFAULT_MAX_CONCURRENT_BEACON_REQUESTS,
+			batchWindow);
+
+		auto context = std::make_shared<testing::NiceMock<test::MockBeaconSendingContext>>(mLogger, configuration);
+		ON_CALL(*context, isShutdownRequested())
+			.WillByDefault(testing::Return(false));
+		ON_CALL(*context, getCurrentTimestamp())
+			.WillByDefault(testing::Return(42L));
+		ON_CALL(*context, getHTTPClient())
+			.WillByDefault(testing::Return(mMockHttpClient));
+		ON_CALL(*context, getHTTPMultiClient())
+			.WillByDefault(testing::Return(mMockMultiClient));
+
+		return context;
 	}
 
 	void SetUp()
@@ -51,16 +115,16 @@ public:
 		mMockSession2Open = std::shared_ptr<testing::NiceMock<test::MockSession>>(new testing::NiceMock<test::MockSession>(mLogger));
 		mMockSession3Finished = std::shared_ptr<testing::NiceMock<test::MockSession>>(new testing::NiceMock<test::MockSession>(mLogger));
 		mMockSession4Finished = std::shared_ptr<testing::NiceMock<test::MockSession>>(new testing::NiceMock<test::MockSession>(mLogger));
-		ON_CALL(*mMockSession1Open, sendBeaconRawPtrProxy(testing::_))
-			.WillByDefault(testing::Invoke([&](std::shared_ptr<providers::IHTTPClientProvider>) -> protocol::StatusResponse* 
-			{
-				return new protocol::StatusResponse(mLogger, "", 200, protocol::Response::ResponseHeaders());
-			}));
-		ON_CALL(*mMockSession2Open, sendBeaconRawPtrProxy(testing::_))
-			.WillByDefault(testing::Invoke([&](std::shared_ptr<providers::IHTTPClientProvider>) -> protocol::StatusResponse*
-			{
-				return new protocol::StatusResponse(mLogger, "", 404, protocol::Response::ResponseHeaders());
-			}));
+		for (auto session : { mMockSession1Open, mMockSession2Open, mMockSession3Finished, mMockSession4Finished })
+		{
+			ON_CALL(*session, handleBeaconChunkResponse(testing::_))
+				.WillByDefault(testing::Invoke([](std::shared_ptr<protocol::StatusResponse> response)
+				{
+					return response != nullptr && !response->isErroneousResponse();
+				}));
+		}
+		mockBeaconResponse(mMockSession1Open, 200);
+		mockBeaconResponse(mMockSession2Open, 404);
 
 		mMockContext = std::shared_ptr<testing::NiceMock<test::MockBeaconSendingContext>>(new testing::NiceMock<test::MockBeaconSendingContext>(mLogger));
 		ON_CALL(*mMockContext, isTimeSyncSupported())
@@ -97,6 +161,28 @@ public:
 		ON_CALL(*mMockContext, getHTTPClient())
 			.WillByDefault(testing::Return(mMockHttpClient));
 
+		// the mocked multi client completes the started requests one after the other
+		mMockMultiClient = std::make_shared<testing::NiceMock<test::MockHTTPMultiClient>>();
+		ON_CALL(*mMockContext, getHTTPMultiClient())
+			.WillByDefault(testing::Return(mMockMultiClient));
+		ON_CALL(*mMockMultiClient, waitForCompletedRequests())
+			.WillByDefault(testing::Invoke([this]()
+			{
+				std::vector<protocol::IHTTPMultiClient::CompletedRequest> completedRequests;
+				if (!mStartedRequests.empty())
+				{
+					auto requestID = mStartedRequests.front();
+					mStartedRequests.pop_front();
+					completedRequests.push_back({ requestID, mBeaconResponses[requestID] });
+				}
+				return completedRequests;
+			}));
+		ON_CALL(*mMockMultiClient, cancelAllRequests())
+			.WillByDefault(testing::Invoke([this]()
+			{
+				mStartedRequests.clear();
+			}));
+
 		// testing::Return stores the result of the call as default value 
 		// this means that the instance of the StatusReponse* is returned as unique_ptr multiple times
 		// when deleting the instance the second time the test would crash
@@ -138,6 +224,8 @@ public:
 		mMockSession3Finished = nullptr;
 		mMockSession4Finished = nullptr;
 		mMockHttpClientProvider = nullptr;
+		mMockMultiClient = nullptr;
+		mBeaconResponses.clear();
 	}
 	
 	std::ostringstream devNull;
@@ -151,6 +239,11 @@ public:
 	std::shared_ptr<testing::NiceMock<test::MockHTTPClientProvider>> mMockHttpClientProvider;
 	std::shared_ptr<testing::NiceMock<test::MockHTTPClient>> mMockHttpClient;
 	std::shared_ptr<configuration::HTTPClientConfiguration> mHttpClientConfiguration;
+	std::shared_ptr<testing::NiceMock<test::MockHTTPMultiClient>> mMockMultiClient;
+	std::map<protocol::IHTTPMultiClient::RequestID, std::shared_ptr<protocol::StatusResponse>> mBeaconResponses;
+	std::deque<protocol::IHTTPMultiClient::RequestID> mStartedRequests;
+	protocol::IHTTPMultiClient::RequestID mNextRequestID;
+	size_t mMaxRequestsInFlight;
 };
 
 TEST_F(BeaconSendingCaptureOnStateTest, aBeaconSendingCaptureOnStateIsNotATerminalState)
@@ -248,33 +341,19 @@ TEST_F(BeaconSendingCaptureOnStateTest, aBeaconSendingCaptureOnStateContinuesWit
 	// given
 	auto target = communication::BeaconSendingCaptureOnState();
 
-	ON_CALL(*mMockSession3Finished, sendBeaconRawPtrProxy(testing::_))
-		.WillByDefault(testing::Invoke([&](std::shared_ptr<providers::IHTTPClientProvider>) -> protocol::StatusResponse* {
-			return new protocol::StatusResponse(mLogger, "", 400, protocol::Response::ResponseHeaders());
-		}));
-	ON_CALL(*mMockSession4Finished, sendBeaconRawPtrProxy(testing::_))
-		.WillByDefault(testing::Invoke([&](std::shared_ptr<providers::IHTTPClientProvider>) -> protocol::StatusResponse* {
-			return new protocol::StatusResponse(mLogger, "", 200, protocol::Response::ResponseHeaders());
-		}));
-	ON_CALL(*mMockSession1Open, sendBeaconRawPtrProxy(testing::_))
-		.WillByDefault(testing::Invoke([&](std::shared_ptr<providers::IHTTPClientProvider>) -> protocol::StatusResponse*
-		{
-			return new protocol::StatusResponse(mLogger, "", 200, protocol::Response::ResponseHeaders());
-		}));
-	ON_CALL(*mMockSession2Open, sendBeaconRawPtrProxy(testing::_))
-		.WillByDefault(testing::Invoke([&](std::shared_ptr<providers::IHTTPClientProvider>) -> protocol::StatusResponse*
-		{
-			return new protocol::StatusResponse(mLogger, "", 200, protocol::Response::ResponseHeaders());
-		}));
+	mockBeaconResponse(mMockSession3Finished, 400);
+	mockBeaconResponse(mMockSession4Finished, 200);
+	mockBeaconResponse(mMockSession1Open, 200);
+	mockBeaconResponse(mMockSession2Open, 200);
 	ON_CALL(*mMockContext, isCaptureOn())
 		.WillByDefault(testing::Return(true));
 	ON_CALL(*mMockSession3Finished, isEmpty())
 		.WillByDefault(testing::Return(true));
 
 	// then
-	EXPECT_CALL(*mMockSession1Open, sendBeaconRawPtrProxy(testing::_))
+	EXPECT_CALL(*mMockSession1Open, handleBeaconChunkResponse(testing::NotNull()))
 		.Times(testing::Exactly(1));
-	EXPECT_CALL(*mMockSession2Open, sendBeaconRawPtrProxy(testing::_))
+	EXPECT_CALL(*mMockSession2Open, handleBeaconChunkResponse(testing::NotNull()))
 		.Times(testing::Exactly(1));
 	EXPECT_CALL(*mMockSession1Open, clearCapturedData())
 		.Times(testing::Exactly(1));
@@ -413,6 +492,127 @@ TEST_F(BeaconSendingCaptureOnStateTest, newSessionRequestsAreMadeForAllNewSessio
 	ASSERT_EQ(capturedBeaconConfigurationForSession2->getCrashReportingLevel(), configuration::BeaconConfiguration::DEFAULT_CRASH_REPORTING_LEVEL);
 }
 
+// Expectation: Within the batch window a single new session request configures all new sessions
+TEST_F(BeaconSendingCaptureOnStateTest, newSessionRequestIsSharedByAllNewSessionsWithinTheBatchWindow)
+{
+	// given
+	auto target = communication::BeaconSendingCaptureOnState();
+	auto context = createContextWithNewSessionRequestBatchWindow(1000);
+
+	std::vector<std::shared_ptr<core::SessionWrapper>> newSessions;
+	std::vector<std::shared_ptr<configuration::BeaconConfiguration>> capturedBeaconConfigurations;
+	for (auto i = 0; i < 10; i++)
+	{
+		auto session = std::make_shared<testing::NiceMock<test::MockSession>>(mLogger);
+		ON_CALL(*session, getBeaconConfiguration())
+			.WillByDefault(testing::Return(std::make_shared<configuration::BeaconConfiguration>()));
+		ON_CALL(*session, setBeaconConfiguration(testing::_))
+			.WillByDefault(testing::Invoke([&capturedBeaconConfigurations](std::shared_ptr<configuration::BeaconConfiguration> beaconConfig)
+			{
+				capturedBeaconConfigurations.push_back(beaconConfig);
+			}));
+		newSessions.push_back(std::make_shared<core::SessionWrapper>(session));
+	}
+	ON_CALL(*context, getAllNewSessions())
+		.WillByDefault(testing::Return(newSessions));
+
+	ON_CALL(*mMockHttpClient, sendNewSessionRequestRawPtrProxy())
+		.WillByDefault(testing::Invoke([this]() -> protocol::StatusResponse*
+		{
+			return new protocol::StatusResponse(mLogger, "mp=5", 200, protocol::Response::ResponseHeaders());
+		}));
+
+	// then
+	EXPECT_CALL(*context, getHTTPClient())
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mMockHttpClient, sendNewSessionRequestRawPtrProxy())
+		.Times(testing::Exactly(1));
+
+	// when
+	target.execute(*context);
+
+	// then
+	ASSERT_EQ(capturedBeaconConfigurations.size(), newSessions.size());
+	for (auto beaconConfiguration : capturedBeaconConfigurations)
+	{
+		ASSERT_EQ(beaconConfiguration->getMultiplicity(), 5);
+	}
+}
+
+// Expectation: A new session request's response is not applied to sessions after the batch window has expired,
+// but all requests are sent with the same HTTP client
+TEST_F(BeaconSendingCaptureOnStateTest, newSessionRequestIsSentAgainAfterTheBatchWindowExpired)
+{
+	// given
+	auto target = communication::BeaconSendingCaptureOnState();
+	auto context = createContextWithNewSessionRequestBatchWindow(500);
+
+	auto currentTimestamp = int64_t(0);
+	ON_CALL(*context, getCurrentTimestamp())
+		.WillByDefault(testing::Invoke([&currentTimestamp]()
+		{
+			currentTimestamp += 300;
+			return currentTimestamp;
+		}));
+
+	std::vector<std::shared_ptr<core::SessionWrapper>> newSessions;
+	for (auto i = 0; i < 4; i++)
+	{
+		auto session = std::make_shared<testing::NiceMock<test::MockSession>>(mLogger);
+		ON_CALL(*session, getBeaconConfiguration())
+			.WillByDefault(testing::Return(std::make_shared<configuration::BeaconConfiguration>()));
+		newSessions.push_back(std::make_shared<core::SessionWrapper>(session));
+	}
+	ON_CALL(*context, getAllNewSessions())
+		.WillByDefault(testing::Return(newSessions));
+
+	// then sessions 1 and 3 send a request, sessions 2 and 4 reuse the response received 300ms earlier
+	EXPECT_CALL(*context, getHTTPClient())
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mMockHttpClient, sendNewSessionRequestRawPtrProxy())
+		.Times(testing::Exactly(2));
+
+	// when
+	target.execute(*context);
+}
+
+// Expectation: The batch window starts when the new session response was received, not when the request was sent
+TEST_F(BeaconSendingCaptureOnStateTest, batchWindowStartsWhenTheNewSessionResponseIsReceived)
+{
+	// given
+	auto target = communication::BeaconSendingCaptureOnState();
+	auto context = createContextWithNewSessionRequestBatchWindow(500);
+
+	// receiving the response takes longer than the batch window
+	auto currentTimestamp = int64_t(0);
+	ON_CALL(*context, getCurrentTimestamp())
+		.WillByDefault(testing::ReturnPointee(&currentTimestamp));
+	ON_CALL(*mMockHttpClient, sendNewSessionRequestRawPtrProxy())
+		.WillByDefault(testing::Invoke([this, &currentTimestamp]() -> protocol::StatusResponse*
+		{
+			currentTimestamp += 1000;
+			return new protocol::StatusResponse(mLogger, "", 200, protocol::Response::ResponseHeaders());
+		}));
+
+	std::vector<std::shared_ptr<core::SessionWrapper>> newSessions;
+	for (auto i = 0; i < 2; i++)
+	{
+		auto session = std::make_shared<testing::NiceMock<test::MockSession>>(mLogger);
+		ON_CALL(*session, getBeaconConfiguration())
+			.WillByDefault(testing::Return(std::make_shared<configuration::BeaconConfiguration>()));
+		newSessions.push_back(std::make_shared<core::SessionWrapper>(session));
+	}
+	ON_CALL(*context, getAllNewSessions())
+		.WillByDefault(testing::Return(newSessions));
+
+	// then the second session reuses the response of the first one
+	EXPECT_CALL(*mMockHttpClient, sendNewSessionRequestRawPtrProxy())
+		.Times(testing::Exactly(1));
+
+	// when
+	target.execute(*context);
+}
+
 // Expectation: Given enough failed new session requests the beacon configuration created by the method
 // performing new session requests has a mulitplicity of '0'
 TEST_F(BeaconSendingCaptureOnStateTest, multiplicityIsSetToZeroIfNoFurtherNewSessionRequestsAreAllowed)
@@ -497,6 +697,43 @@ TEST_F(BeaconSendingCaptureOnStateTest, multiplicityIsSetToZeroIfNoFurtherNewSes
 	ASSERT_EQ(capturedBeaconConfigurationForSession2->getCrashReportingLevel(), configuration::BeaconConfiguration::DEFAULT_CRASH_REPORTING_LEVEL);
 }
 
+TEST_F(BeaconSendingCaptureOnStateTest, newSessionRequestsFailingOnConnectionLevelDoNotUseUpTheAllowedRequests)
+{
+	// given
+	auto target = communication::BeaconSendingCaptureOnState();
+
+	ON_CALL(*mMockHttpClient, sendNewSessionRequestRawPtrProxy())
+		.WillByDefault(testing::Invoke([this]()
+		{
+			return new protocol::StatusResponse(mLogger, "", std::numeric_limits<int32_t>::max(), protocol::Response::ResponseHeaders());
+		}));
+
+	auto sessionWrapper1 = std::make_shared<core::SessionWrapper>(mMockSession1Open);
+	auto sessionWrapper2 = std::make_shared<core::SessionWrapper>(mMockSession2Open);
+	std::vector<std::shared_ptr<core::SessionWrapper>> newSessions = { sessionWrapper1, sessionWrapper2 };
+	ON_CALL(*mMockContext, getAllNewSessions())
+		.WillByDefault(testing::Return(newSessions));
+
+	// then the remaining sessions are skipped in each pass, as the server is not reachable
+	EXPECT_CALL(*mMockHttpClient, sendNewSessionRequestRawPtrProxy())
+		.Times(testing::Exactly(5));
+	// and the multiplicity is never changed
+	EXPECT_CALL(*mMockSession1Open, setBeaconConfiguration(testing::_))
+		.Times(testing::Exactly(0));
+	EXPECT_CALL(*mMockSession2Open, setBeaconConfiguration(testing::_))
+		.Times(testing::Exactly(0));
+
+	// when executing more often than new session requests are allowed
+	for (auto i = 0; i < 5; i++)
+	{
+		target.execute(*mMockContext);
+	}
+
+	// then
+	ASSERT_TRUE(sessionWrapper1->canSendNewSessionRequest());
+	ASSERT_TRUE(sessionWrapper2->canSendNewSessionRequest());
+}
+
 TEST_F(BeaconSendingCaptureOnStateTest, newSessionRequestsAreAbortedWhenTooManyRequestsResponseIsReceived)
 {
 	// given
@@ -552,9 +789,9 @@ TEST_F(BeaconSendingCaptureOnStateTest, newSessionRequestsAreAbortedWhenTooManyR
 		.WillOnce(testing::SaveArg<0>(&savedNextState));
 	EXPECT_CALL(*mMockHttpClient, sendNewSessionRequestRawPtrProxy())
 		.Times(testing::Exactly(1));
-	EXPECT_CALL(*mMockSession3Finished, sendBeaconRawPtrProxy(testing::_))
+	EXPECT_CALL(*mMockSession3Finished, sendNextBeaconChunk(testing::_))
 		.Times(testing::Exactly(0));
-	EXPECT_CALL(*mMockSession4Finished, sendBeaconRawPtrProxy(testing::_))
+	EXPECT_CALL(*mMockSession4Finished, sendNextBeaconChunk(testing::_))
 		.Times(testing::Exactly(0));
 
 	// when calling execute
@@ -586,18 +823,12 @@ TEST_F(BeaconSendingCaptureOnStateTest, finishedSessionsAreSent)
 	ON_CALL(*mMockContext, isCaptureOn())
 		.WillByDefault(testing::Return(true));
 
-	ON_CALL(*mMockSession3Finished, sendBeaconRawPtrProxy(testing::_))
-		.WillByDefault(testing::Invoke([&](std::shared_ptr<providers::IHTTPClientProvider>) -> protocol::StatusResponse*{
-			return new protocol::StatusResponse(mLogger, "", 200, protocol::Response::ResponseHeaders());
-		}));
-	ON_CALL(*mMockSession4Finished, sendBeaconRawPtrProxy(testing::_))
-		.WillByDefault(testing::Invoke([&](std::shared_ptr<providers::IHTTPClientProvider>) -> protocol::StatusResponse* {
-			return new protocol::StatusResponse(mLogger, "", 200, protocol::Response::ResponseHeaders());
-		}));
+	mockBeaconResponse(mMockSession3Finished, 200);
+	mockBeaconResponse(mMockSession4Finished, 200);
 
-	EXPECT_CALL(*mMockSession3Finished, sendBeaconRawPtrProxy(testing::_))
+	EXPECT_CALL(*mMockSession3Finished, handleBeaconChunkResponse(testing::NotNull()))
 		.Times(testing::Exactly(1));
-	EXPECT_CALL(*mMockSession4Finished, sendBeaconRawPtrProxy(testing::_))
+	EXPECT_CALL(*mMockSession4Finished, handleBeaconChunkResponse(testing::NotNull()))
 		.Times(testing::Exactly(1));
 	EXPECT_CALL(*mMockSession3Finished, clearCapturedData())
 		.Times(testing::Exactly(1));
@@ -610,6 +841,123 @@ TEST_F(BeaconSendingCaptureOnStateTest, finishedSessionsAreSent)
 	target.execute(*mMockContext);
 }
 
+TEST_F(BeaconSendingCaptureOnStateTest, finishedSessionsAreSentConcurrently)
+{
+	// given
+	auto target = communication::BeaconSendingCaptureOnState();
+
+	auto sessionWrapper1 = std::make_shared<core::SessionWrapper>(mMockSession3Finished);
+	sessionWrapper1->updateBeaconConfiguration(std::make_shared<configuration::BeaconConfiguration>());
+	auto sessionWrapper2 = std::make_shared<core::SessionWrapper>(mMockSession4Finished);
+	sessionWrapper2->updateBeaconConfiguration(std::make_shared<configuration::BeaconConfiguration>());
+	std::vector<std::shared_ptr<core::SessionWrapper>> finishedSessions = { sessionWrapper1, sessionWrapper2 };
+
+	ON_CALL(*mMockContext, getAllFinishedAndConfiguredSessions())
+		.WillByDefault(testing::Return(finishedSessions));
+	ON_CALL(*mMockContext, getAllNewSessions())
+		.WillByDefault(testing::Return(std::vector<std::shared_ptr<core::SessionWrapper>>()));
+	ON_CALL(*mMockContext, getAllOpenAndConfiguredSessions())
+		.WillByDefault(testing::Return(std::vector<std::shared_ptr<core::SessionWrapper>>()));
+	ON_CALL(*mMockContext, isCaptureOn())
+		.WillByDefault(testing::Return(true));
+
+	mockBeaconResponse(mMockSession3Finished, 200);
+	mockBeaconResponse(mMockSession4Finished, 200);
+
+	EXPECT_CALL(*mMockContext, getHTTPMultiClient())
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mMockMultiClient, waitForCompletedRequests())
+		.Times(testing::Exactly(2));
+
+	// when calling execute
+	target.execute(*mMockContext);
+
+	// then both sessions have been in flight at the same time
+	ASSERT_EQ(size_t(2), mMaxRequestsInFlight);
+}
+
+TEST_F(BeaconSendingCaptureOnStateTest, nextBeaconChunkOfASessionIsSentAfterThePreviousOneCompleted)
+{
+	// given
+	auto target = communication::BeaconSendingCaptureOnState();
+
+	auto sessionWrapper = std::make_shared<core::SessionWrapper>(mMockSession3Finished);
+	sessionWrapper->updateBeaconConfiguration(std::make_shared<configuration::BeaconConfiguration>());
+	std::vector<std::shared_ptr<core::SessionWrapper>> finishedSessions = { sessionWrapper };
+
+	ON_CALL(*mMockContext, getAllFinishedAndConfiguredSessions())
+		.WillByDefault(testing::Return(finishedSessions));
+	ON_CALL(*mMockContext, getAllNewSessions())
+		.WillByDefault(testing::Return(std::vector<std::shared_ptr<core::SessionWrapper>>()));
+	ON_CALL(*mMockContext, getAllOpenAndConfiguredSessions())
+		.WillByDefault(testing::Return(std::vector<std::shared_ptr<core::SessionWrapper>>()));
+	ON_CALL(*mMockContext, isCaptureOn())
+		.WillByDefault(testing::Return(true));
+
+	mBeaconResponses[1001] = std::make_shared<protocol::StatusResponse>(mLogger, "", 200, protocol::Response::ResponseHeaders());
+	mBeaconResponses[1002] = std::make_shared<protocol::StatusResponse>(mLogger, "", 200, protocol::Response::ResponseHeaders());
+	auto startRequest = [this](protocol::IHTTPMultiClient::RequestID requestID)
+	{
+		mStartedRequests.push_back(requestID);
+		return requestID;
+	};
+
+	// then the session's chunks are sent one after the other
+	{
+		testing::InSequence sequence;
+		EXPECT_CALL(*mMockSession3Finished, sendNextBeaconChunk(testing::_))
+			.WillOnce(testing::InvokeWithoutArgs([&startRequest]() { return startRequest(1001); }));
+		EXPECT_CALL(*mMockSession3Finished, handleBeaconChunkResponse(testing::Eq(mBeaconResponses[1001])));
+		EXPECT_CALL(*mMockSession3Finished, sendNextBeaconChunk(testing::_))
+			.WillOnce(testing::InvokeWithoutArgs([&startRequest]() { return startRequest(1002); }));
+		EXPECT_CALL(*mMockSession3Finished, handleBeaconChunkResponse(testing::Eq(mBeaconResponses[1002])));
+		EXPECT_CALL(*mMockSession3Finished, sendNextBeaconChunk(testing::_))
+			.WillOnce(testing::Return(protocol::IHTTPMultiClient::INVALID_REQUEST_ID));
+		EXPECT_CALL(*mMockContext, removeSession(testing::_))
+			.Times(testing::Exactly(1));
+	}
+
+	// when calling execute
+	target.execute(*mMockContext);
+}
+
+TEST_F(BeaconSendingCaptureOnStateTest, unsuccessfullySentFinishedSessionsAreRetriedAfterDefaultSleepTime)
+{
+	// given
+	auto target = communication::BeaconSendingCaptureOnState();
+
+	auto sessionWrapper = std::make_shared<core::SessionWrapper>(mMockSession3Finished);
+	sessionWrapper->updateBeaconConfiguration(std::make_shared<configuration::BeaconConfiguration>());
+	std::vector<std::shared_ptr<core::SessionWrapper>> finishedSessions = { sessionWrapper };
+
+	ON_CALL(*mMockContext, getAllFinishedAndConfiguredSessions())
+		.WillByDefault(testing::Return(finishedSessions));
+	ON_CALL(*mMockContext, getAllNewSessions())
+		.WillByDefault(testing::Return(std::vector<std::shared_ptr<core::SessionWrapper>>()));
+	ON_CALL(*mMockContext, getAllOpenAndConfiguredSessions())
+		.WillByDefault(testing::Return(std::vector<std::shared_ptr<core::SessionWrapper>>()));
+	ON_CALL(*mMockContext, isCaptureOn())
+		.WillByDefault(testing::Return(true));
+	ON_CALL(*mMockContext, getCurrentTimestamp())
+		.WillByDefault(testing::Return(100));
+	ON_CALL(*mMockContext, getLastTimeSyncTime())
+		.WillByDefault(testing::Return(100));
+	ON_CALL(*mMockContext, getSendInterval())
+		.WillByDefault(testing::Return(120000));
+	ON_CALL(*mMockContext, getLastOpenSessionBeaconSendTime())
+		.WillByDefault(testing::Return(100));
+
+	mockBeaconResponse(mMockSession3Finished, 400);
+
+	// then
+	EXPECT_CALL(*mMockContext, waitForWakeup(BeaconSendingContext::DEFAULT_SLEEP_TIME_MILLISECONDS.count()))
+		.Times(testing::Exactly(2));
+
+	// when calling execute twice
+	target.execute(*mMockContext);
+	target.execute(*mMockContext);
+}
+
 TEST_F(BeaconSendingCaptureOnStateTest, unsuccessfulFinishedSessionsAreNotRemovedFromCache)
 {
 	// given
@@ -631,16 +979,8 @@ TEST_F(BeaconSendingCaptureOnStateTest, unsuccessfulFinishedSessionsAreNotRemove
 	ON_CALL(*mMockContext, isCaptureOn())
 		.WillByDefault(testing::Return(true));
 
-	ON_CALL(*mMockSession3Finished, sendBeaconRawPtrProxy(testing::_))
-		.WillByDefault(testing::Invoke([&](std::shared_ptr<providers::IHTTPClientProvider>) -> protocol::StatusResponse*
-		{
-			return new protocol::StatusResponse(mLogger, core::UTF8String(), 400, protocol::Response::ResponseHeaders());
-		}));
-	ON_CALL(*mMockSession4Finished, sendBeaconRawPtrProxy(testing::_))
-		.WillByDefault(testing::Invoke([&](std::shared_ptr<providers::IHTTPClientProvider>) -> protocol::StatusResponse*
-		{
-			return new protocol::StatusResponse(mLogger, core::UTF8String(), 400, protocol::Response::ResponseHeaders());
-		}));
+	mockBeaconResponse(mMockSession3Finished, 400);
+	mockBeaconResponse(mMockSession4Finished, 400);
 
 	EXPECT_CALL(*mMockContext, getAllFinishedAndConfiguredSessions())
 		.Times(testing::Exactly(1));
@@ -672,26 +1012,23 @@ TEST_F(BeaconSendingCaptureOnStateTest, sendingFinishedSessionsIsAbortedImmediat
 	ON_CALL(*mMockContext, isCaptureOn())
 		.WillByDefault(testing::Return(true));
 
-	ON_CALL(*mMockSession3Finished, sendBeaconRawPtrProxy(testing::_))
-		.WillByDefault(testing::Invoke([&](std::shared_ptr<providers::IHTTPClientProvider>) -> protocol::StatusResponse* {
-			auto responseHeaders = protocol::Response::ResponseHeaders
-			{
-				{ "retry-after", {"678"} }
-			};
-			return new protocol::StatusResponse(mLogger, "", 429, responseHeaders);
-		}));
-	ON_CALL(*mMockSession4Finished, sendBeaconRawPtrProxy(testing::_))
-		.WillByDefault(testing::Invoke([&](std::shared_ptr<providers::IHTTPClientProvider>) -> protocol::StatusResponse* {
-			return new protocol::StatusResponse(mLogger, "", 200, protocol::Response::ResponseHeaders());
-		}));
+	auto responseHeaders = protocol::Response::ResponseHeaders
+	{
+		{ "retry-after", {"678"} }
+	};
+	mockBeaconResponse(mMockSession3Finished, 429, responseHeaders);
+	mockBeaconResponse(mMockSession4Finished, 200);
 
-	EXPECT_CALL(*mMockSession3Finished, sendBeaconRawPtrProxy(testing::_))
+	EXPECT_CALL(*mMockSession3Finished, handleBeaconChunkResponse(testing::NotNull()))
 		.Times(testing::Exactly(1));
-	EXPECT_CALL(*mMockSession4Finished, sendBeaconRawPtrProxy(testing::_))
-		.Times(testing::Exactly(0));
-	EXPECT_CALL(*mMockSession1Open, sendBeaconRawPtrProxy(testing::_))
+	// session 4 was sent concurrently, its request is aborted and its data is kept
+	EXPECT_CALL(*mMockSession4Finished, handleBeaconChunkResponse(testing::IsNull()))
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mMockMultiClient, cancelAllRequests())
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mMockSession1Open, sendNextBeaconChunk(testing::_))
 		.Times(testing::Exactly(0));
-	EXPECT_CALL(*mMockSession2Open, sendBeaconRawPtrProxy(testing::_))
+	EXPECT_CALL(*mMockSession2Open, sendNextBeaconChunk(testing::_))
 		.Times(testing::Exactly(0));
 	EXPECT_CALL(*mMockSession3Finished, clearCapturedData())
 		.Times(testing::Exactly(0));
@@ -712,85 +1049,498 @@ TEST_F(BeaconSendingCaptureOnStateTest, sendingFinishedSessionsIsAbortedImmediat
 	ASSERT_EQ(int64_t(678 * 1000), std::static_pointer_cast<BeaconSendingCaptureOffState>(savedNextState)->getSleepTimeInMilliseconds());
 }
 
-TEST_F(BeaconSendingCaptureOnStateTest, openSessionsAreSentIfSendIntervalIsExceeded)
+TEST_F(BeaconSendingCaptureOnStateTest, requestsWaitingForRetryAreAwaitedOnTheContext)
 {
 	// given
 	auto target = communication::BeaconSendingCaptureOnState();
 
-	auto sessionWrapper1 = std::make_shared<core::SessionWrapper>(mMockSession1Open);
-	sessionWrapper1->updateBeaconConfiguration(std::make_shared<configuration::BeaconConfiguration>(2, openkit::DataCollectionLevel::USER_BEHAVIOR, openkit::CrashReportingLevel::OPT_IN_CRASHES));
-	auto sessionWrapper2 = std::make_shared<core::SessionWrapper>(mMockSession2Open);
-	sessionWrapper2->updateBeaconConfiguration(std::make_shared<configuration::BeaconConfiguration>(2, openkit::DataCollectionLevel::USER_BEHAVIOR, openkit::CrashReportingLevel::OPT_IN_CRASHES));
-	std::vector<std::shared_ptr<core::SessionWrapper>> openSessions = { sessionWrapper1, sessionWrapper2 };
+	auto sessionWrapper = std::make_shared<core::SessionWrapper>(mMockSession3Finished);
+	sessionWrapper->updateBeaconConfiguration(std::make_shared<configuration::BeaconConfiguration>());
+	std::vector<std::shared_ptr<core::SessionWrapper>> finishedSessions = { sessionWrapper };
 
-	//only return the two new sessions for the new session request
 	ON_CALL(*mMockContext, getAllFinishedAndConfiguredSessions())
-		.WillByDefault(testing::Return(std::vector<std::shared_ptr<core::SessionWrapper>>()));
+		.WillByDefault(testing::Return(finishedSessions));
 	ON_CALL(*mMockContext, getAllNewSessions())
 		.WillByDefault(testing::Return(std::vector<std::shared_ptr<core::SessionWrapper>>()));
 	ON_CALL(*mMockContext, getAllOpenAndConfiguredSessions())
-		.WillByDefault(testing::Return(openSessions));
+		.WillByDefault(testing::Return(std::vector<std::shared_ptr<core::SessionWrapper>>()));
 	ON_CALL(*mMockContext, isCaptureOn())
 		.WillByDefault(testing::Return(true));
+	ON_CALL(*mMockMultiClient, getMillisecondsUntilNextRetry())
+		.WillByDefault(testing::Return(250));
 
-	ON_CALL(*mMockContext, getCurrentTimestamp())
-		.WillByDefault(testing::Return(100));
-	ON_CALL(*mMockContext, getSendInterval())
-		.WillByDefault(testing::Return(50));
-	ON_CALL(*mMockContext, getLastOpenSessionBeaconSendTime())
-		.WillByDefault(testing::Return(45));
+	mockBeaconResponse(mMockSession3Finished, 200);
 
-	EXPECT_CALL(*mMockSession1Open, sendBeaconRawPtrProxy(testing::_))
+	// then the request first waits for a retry and completes afterwards
+	EXPECT_CALL(*mMockMultiClient, waitForCompletedRequests())
+		.WillOnce(testing::Return(std::vector<protocol::IHTTPMultiClient::CompletedRequest>()))
+		.WillRepeatedly(testing::DoDefault());
+	EXPECT_CALL(*mMockContext, sleep(250))
 		.Times(testing::Exactly(1));
-	EXPECT_CALL(*mMockSession2Open, sendBeaconRawPtrProxy(testing::_))
-		.Times(testing::Exactly(1));
-	EXPECT_CALL(*mMockContext, setLastOpenSessionBeaconSendTime(testing::_))
+	EXPECT_CALL(*mMockSession3Finished, handleBeaconChunkResponse(testing::NotNull()))
 		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mMockMultiClient, cancelAllRequests())
+		.Times(testing::Exactly(0));
 
 	// when calling execute
 	target.execute(*mMockContext);
 }
 
-TEST_F(BeaconSendingCaptureOnStateTest, openSessionsAreNotSentIfSendIntervalIsNotExceeded)
+TEST_F(BeaconSendingCaptureOnStateTest, sendingIsAbortedIfShutdownIsRequestedWhileWaitingForRetry)
 {
 	// given
 	auto target = communication::BeaconSendingCaptureOnState();
 
-	auto sessionWrapper1 = std::make_shared<core::SessionWrapper>(mMockSession1Open);
-	auto sessionWrapper2 = std::make_shared<core::SessionWrapper>(mMockSession2Open);
-	std::vector<std::shared_ptr<core::SessionWrapper>> openSessions = { sessionWrapper1, sessionWrapper2 };
+	auto sessionWrapper = std::make_shared<core::SessionWrapper>(mMockSession3Finished);
+	sessionWrapper->updateBeaconConfiguration(std::make_shared<configuration::BeaconConfiguration>());
+	std::vector<std::shared_ptr<core::SessionWrapper>> finishedSessions = { sessionWrapper };
 
-	//only return the two new sessions for the new session request
 	ON_CALL(*mMockContext, getAllFinishedAndConfiguredSessions())
-		.WillByDefault(testing::Return(std::vector<std::shared_ptr<core::SessionWrapper>>()));
+		.WillByDefault(testing::Return(finishedSessions));
 	ON_CALL(*mMockContext, getAllNewSessions())
 		.WillByDefault(testing::Return(std::vector<std::shared_ptr<core::SessionWrapper>>()));
 	ON_CALL(*mMockContext, getAllOpenAndConfiguredSessions())
-		.WillByDefault(testing::Return(openSessions));
+		.WillByDefault(testing::Return(std::vector<std::shared_ptr<core::SessionWrapper>>()));
 	ON_CALL(*mMockContext, isCaptureOn())
 		.WillByDefault(testing::Return(true));
+	ON_CALL(*mMockMultiClient, waitForCompletedRequests())
+		.WillByDefault(testing::Return(std::vector<protocol::IHTTPMultiClient::CompletedRequest>()));
 
-	ON_CALL(*mMockSession3Finished, sendBeaconRawPtrProxy(testing::_))
-		.WillByDefault(testing::Return(nullptr));
-	ON_CALL(*mMockSession4Finished, sendBeaconRawPtrProxy(testing::_))
-		.WillByDefault(testing::Return(nullptr));
+	mockBeaconResponse(mMockSession3Finished, 200);
 
-	ON_CALL(*mMockContext, getCurrentTimestamp())
-		.WillByDefault(testing::Return(100));
-	ON_CALL(*mMockContext, getSendInterval())
-		.WillByDefault(testing::Return(50));
+	// then shutdown is requested while the request waits for a retry
+	EXPECT_CALL(*mMockContext, isShutdownRequested())
+		.WillOnce(testing::Return(false))		// after waiting for the next pass
+		.WillOnce(testing::Return(false))		// after sending new session requests
+		.WillRepeatedly(testing::Return(true));
+	EXPECT_CALL(*mMockMultiClient, waitForCompletedRequests())
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mMockMultiClient, cancelAllRequests())
+		.Times(testing::Exactly(1));
+	// the request is aborted and the session's data is kept
+	EXPECT_CALL(*mMockSession3Finished, handleBeaconChunkResponse(testing::IsNull()))
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mMockContext, removeSession(testing::_))
+		.Times(testing::Exactly(0));
+
+	// when calling execute
+	target.execute(*mMockContext);
+}
+
+TEST_F(BeaconSendingCaptureOnStateTest, openSessionsAreNotSentIfShutdownIsRequestedWhileSendingFinishedSessions)
+{
+	// given
+	auto target = communication::BeaconSendingCaptureOnState();
+
+	auto finishedSessionWrapper = std::make_shared<core::SessionWrapper>(mMockSession3Finished);
+	finishedSessionWrapper->updateBeaconConfiguration(std::make_shared<configuration::BeaconConfiguration>());
+	std::vector<std::shared_ptr<core::SessionWrapper>> finishedSessions = { finishedSessionWrapper };
+	auto openSessionWrapper = std::make_shared<core::SessionWrapper>(mMockSession1Open);
+	openSessionWrapper->updateBeaconConfiguration(std::make_shared<configuration::BeaconConfiguration>());
+	std::vector<std::shared_ptr<core::SessionWrapper>> openSessions = { openSessionWrapper };
+
+	ON_CALL(*mMockContext, getAllFinishedAndConfiguredSessions())
+		.WillByDefault(testing::Return(finishedSessions));
+	ON_CALL(*mMockContext, getAllNewSessions())
+		.WillByDefault(testing::Return(std::vector<std::shared_ptr<core::SessionWrapper>>()));
+	ON_CALL(*mMockContext, getAllOpenAndConfiguredSessions())
+		.WillByDefault(testing::Return(openSessions));
+	ON_CALL(*mMockContext, consumeOpenSessionsSendingRequest())
+		.WillByDefault(testing::Return(true));
+	ON_CALL(*mMockContext, isCaptureOn())
+		.WillByDefault(testing::Return(true));
+	ON_CALL(*mMockMultiClient, waitForCompletedRequests())
+		.WillByDefault(testing::Return(std::vector<protocol::IHTTPMultiClient::CompletedRequest>()));
+
+	mockBeaconResponse(mMockSession3Finished, 200);
+
+	// then shutdown is requested while the finished session's request waits for a retry
+	EXPECT_CALL(*mMockContext, isShutdownRequested())
+		.WillOnce(testing::Return(false))		// after waiting for the next pass
+		.WillOnce(testing::Return(false))		// after sending new session requests
+		.WillRepeatedly(testing::Return(true));
+	EXPECT_CALL(*mMockMultiClient, cancelAllRequests())
+		.Times(testing::Exactly(1));
+	// no further requests are started
+	EXPECT_CALL(*mMockSession1Open, sendNextBeaconChunk(testing::_))
+		.Times(testing::Exactly(0));
+	EXPECT_CALL(*mMockContext, setLastOpenSessionBeaconSendTime(testing::_))
+		.Times(testing::Exactly(0));
+
+	// when calling execute
+	target.execute(*mMockContext);
+}
+
+TEST_F(BeaconSendingCaptureOnStateTest, openSessionsAreSentIfSendIntervalIsExceeded)
+{
+	// given
+	auto target = communication::BeaconSendingCaptureOnState();
+
+	auto sessionWrapper1 = std::make_shared<core::SessionWrapper>(mMockSession1Open);
+	sessionWrapper1->updateBeaconConfiguration(std::make_shared<configuration::BeaconConfiguration>(2, openkit::DataCollectionLevel::USER_BEHAVIOR, openkit::CrashReportingLevel::OPT_IN_CRASHES));
+	auto sessionWrapper2 = std::make_shared<core::SessionWrapper>(mMockSession2Open);
+	sessionWrapper2->updateBeaconConfiguration(std::make_shared<configuration::BeaconConfiguration>(2, openkit::DataCollectionLevel::USER_BEHAVIOR, openkit::CrashReportingLevel::OPT_IN_CRASHES));
+	std::vector<std::shared_ptr<core::SessionWrapper>> openSessions = { sessionWrapper1, sessionWrapper2 };
+
+	//only return the two new sessions for the new session request
+	ON_CALL(*mMockContext, getAllFinishedAndConfiguredSessions())
+		.WillByDefault(testing::Return(std::vector<std::shared_ptr<core::SessionWrapper>>()));
+	ON_CALL(*mMockContext, getAllNewSessions())
+		.WillByDefault(testing::Return(std::vector<std::shared_ptr<core::SessionWrapper>>()));
+	ON_CALL(*mMockContext, getAllOpenAndConfiguredSessions())
+		.WillByDefault(testing::Return(openSessions));
+	ON_CALL(*mMockContext, isCaptureOn())
+		.WillByDefault(testing::Return(true));
+
+	ON_CALL(*mMockContext, getCurrentTimestamp())
+		.WillByDefault(testing::Return(100));
+	ON_CALL(*mMockContext, getSendInterval())
+		.WillByDefault(testing::Return(50));
+	ON_CALL(*mMockContext, getLastOpenSessionBeaconSendTime())
+		.WillByDefault(testing::Return(45));
+
+	EXPECT_CALL(*mMockSession1Open, handleBeaconChunkResponse(testing::NotNull()))
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mMockSession2Open, handleBeaconChunkResponse(testing::NotNull()))
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mMockContext, setLastOpenSessionBeaconSendTime(testing::_))
+		.Times(testing::Exactly(1));
+
+	// when calling execute
+	target.execute(*mMockContext);
+}
+
+TEST_F(BeaconSendingCaptureOnStateTest, openSessionsAreNotSentIfSendIntervalIsNotExceeded)
+{
+	// given
+	auto target = communication::BeaconSendingCaptureOnState();
+
+	auto sessionWrapper1 = std::make_shared<core::SessionWrapper>(mMockSession1Open);
+	auto sessionWrapper2 = std::make_shared<core::SessionWrapper>(mMockSession2Open);
+	std::vector<std::shared_ptr<core::SessionWrapper>> openSessions = { sessionWrapper1, sessionWrapper2 };
+
+	//only return the two new sessions for the new session request
+	ON_CALL(*mMockContext, getAllFinishedAndConfiguredSessions())
+		.WillByDefault(testing::Return(std::vector<std::shared_ptr<core::SessionWrapper>>()));
+	ON_CALL(*mMockContext, getAllNewSessions())
+		.WillByDefault(testing::Return(std::vector<std::shared_ptr<core::SessionWrapper>>()));
+	ON_CALL(*mMockContext, getAllOpenAndConfiguredSessions())
+		.WillByDefault(testing::Return(openSessions));
+	ON_CALL(*mMockContext, isCaptureOn())
+		.WillByDefault(testing::Return(true));
+
+
+	ON_CALL(*mMockContext, getCurrentTimestamp())
+		.WillByDefault(testing::Return(100));
+	ON_CALL(*mMockContext, getSendInterval())
+		.WillByDefault(testing::Return(50));
 	ON_CALL(*mMockContext, getLastOpenSessionBeaconSendTime())
 		.WillByDefault(testing::Return(49));
 
-	EXPECT_CALL(*mMockSession1Open, sendBeaconRawPtrProxy(testing::_))
+	EXPECT_CALL(*mMockSession1Open, sendNextBeaconChunk(testing::_))
 		.Times(testing::Exactly(0));
-	EXPECT_CALL(*mMockSession2Open, sendBeaconRawPtrProxy(testing::_))
+	EXPECT_CALL(*mMockSession2Open, sendNextBeaconChunk(testing::_))
 		.Times(testing::Exactly(0));
 
 	// when calling execute
 	target.execute(*mMockContext);
 }
 
+TEST_F(BeaconSendingCaptureOnStateTest, openSessionsAreSentBeforeSendIntervalIsExceededIfRequested)
+{
+	// given
+	auto target = communication::BeaconSendingCaptureOnState();
+
+	auto sessionWrapper1 = std::make_shared<core::SessionWrapper>(mMockSession1Open);
+	sessionWrapper1->updateBeaconConfiguration(std::make_shared<configuration::BeaconConfiguration>(2, openkit::DataCollectionLevel::USER_BEHAVIOR, openkit::CrashReportingLevel::OPT_IN_CRASHES));
+	std::vector<std::shared_ptr<core::SessionWrapper>> openSessions = { sessionWrapper1 };
+
+	ON_CALL(*mMockContext, getAllFinishedAndConfiguredSessions())
+		.WillByDefault(testing::Return(std::vector<std::shared_ptr<core::SessionWrapper>>()));
+	ON_CALL(*mMockContext, getAllNewSessions())
+		.WillByDefault(testing::Return(std::vector<std::shared_ptr<core::SessionWrapper>>()));
+	ON_CALL(*mMockContext, getAllOpenAndConfiguredSessions())
+		.WillByDefault(testing::Return(openSessions));
+	ON_CALL(*mMockContext, isCaptureOn())
+		.WillByDefault(testing::Return(true));
+	ON_CALL(*mMockContext, consumeOpenSessionsSendingRequest())
+		.WillByDefault(testing::Return(true));
+
+	ON_CALL(*mMockContext, getCurrentTimestamp())
+		.WillByDefault(testing::Return(100));
+	ON_CALL(*mMockContext, getSendInterval())
+		.WillByDefault(testing::Return(50));
+	ON_CALL(*mMockContext, getLastOpenSessionBeaconSendTime())
+		.WillByDefault(testing::Return(99));
+
+	EXPECT_CALL(*mMockSession1Open, handleBeaconChunkResponse(testing::NotNull()))
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mMockContext, setLastOpenSessionBeaconSendTime(100))
+		.Times(testing::Exactly(1));
+
+	// when calling execute
+	target.execute(*mMockContext);
+}
+
+TEST_F(BeaconSendingCaptureOnStateTest, openSessionsAreSentBeforeSendIntervalIsExceededIfFlushIsRequested)
+{
+	// given
+	auto target = communication::BeaconSendingCaptureOnState();
+
+	auto sessionWrapper1 = std::make_shared<core::SessionWrapper>(mMockSession1Open);
+	sessionWrapper1->updateBeaconConfiguration(std::make_shared<configuration::BeaconConfiguration>(2, openkit::DataCollectionLevel::USER_BEHAVIOR, openkit::CrashReportingLevel::OPT_IN_CRASHES));
+	std::vector<std::shared_ptr<core::SessionWrapper>> openSessions = { sessionWrapper1 };
+
+	ON_CALL(*mMockContext, getAllFinishedAndConfiguredSessions())
+		.WillByDefault(testing::Return(std::vector<std::shared_ptr<core::SessionWrapper>>()));
+	ON_CALL(*mMockContext, getAllNewSessions())
+		.WillByDefault(testing::Return(std::vector<std::shared_ptr<core::SessionWrapper>>()));
+	ON_CALL(*mMockContext, getAllOpenAndConfiguredSessions())
+		.WillByDefault(testing::Return(openSessions));
+	ON_CALL(*mMockContext, isCaptureOn())
+		.WillByDefault(testing::Return(true));
+
+	ON_CALL(*mMockContext, getCurrentTimestamp())
+		.WillByDefault(testing::Return(100));
+	ON_CALL(*mMockContext, getSendInterval())
+		.WillByDefault(testing::Return(50));
+	ON_CALL(*mMockContext, getLastOpenSessionBeaconSendTime())
+		.WillByDefault(testing::Return(99));
+
+	auto flushID = mMockContext->requestFlush();
+
+	EXPECT_CALL(*mMockSession1Open, handleBeaconChunkResponse(testing::NotNull()))
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mMockContext, setLastOpenSessionBeaconSendTime(100))
+		.Times(testing::Exactly(1));
+
+	// when calling execute
+	target.execute(*mMockContext);
+
+	// then
+	ASSERT_EQ(mMockContext->getLastCompletedFlushID(), flushID);
+	ASSERT_TRUE(mMockContext->waitForFlush(flushID, 0L));
+}
+
+TEST_F(BeaconSendingCaptureOnStateTest, flushIsNotCompletedIfSendingOpenSessionsFails)
+{
+	// given
+	auto target = communication::BeaconSendingCaptureOnState();
+
+	auto sessionWrapper1 = std::make_shared<core::SessionWrapper>(mMockSession1Open);
+	sessionWrapper1->updateBeaconConfiguration(std::make_shared<configuration::BeaconConfiguration>(2, openkit::DataCollectionLevel::USER_BEHAVIOR, openkit::CrashReportingLevel::OPT_IN_CRASHES));
+	auto sessionWrapper2 = std::make_shared<core::SessionWrapper>(mMockSession2Open);
+	sessionWrapper2->updateBeaconConfiguration(std::make_shared<configuration::BeaconConfiguration>(2, openkit::DataCollectionLevel::USER_BEHAVIOR, openkit::CrashReportingLevel::OPT_IN_CRASHES));
+	std::vector<std::shared_ptr<core::SessionWrapper>> openSessions = { sessionWrapper1, sessionWrapper2 };
+
+	ON_CALL(*mMockContext, getAllFinishedAndConfiguredSessions())
+		.WillByDefault(testing::Return(std::vector<std::shared_ptr<core::SessionWrapper>>()));
+	ON_CALL(*mMockContext, getAllNewSessions())
+		.WillByDefault(testing::Return(std::vector<std::shared_ptr<core::SessionWrapper>>()));
+	ON_CALL(*mMockContext, getAllOpenAndConfiguredSessions())
+		.WillByDefault(testing::Return(openSessions));
+	ON_CALL(*mMockContext, isCaptureOn())
+		.WillByDefault(testing::Return(true));
+	ON_CALL(*mMockContext, getCurrentTimestamp())
+		.WillByDefault(testing::Return(100));
+	ON_CALL(*mMockContext, getSendInterval())
+		.WillByDefault(testing::Return(120000));
+	ON_CALL(*mMockContext, getLastOpenSessionBeaconSendTime())
+		.WillByDefault(testing::Return(100));
+	ON_CALL(*mMockContext, getLastTimeSyncTime())
+		.WillByDefault(testing::Return(100));
+
+	auto flushID = mMockContext->requestFlush();
+
+	// then the second session's beacon is rejected, so the flush is retried after the default sleep time
+	testing::InSequence s;
+	EXPECT_CALL(*mMockContext, waitForWakeup(BeaconSendingContext::DEFAULT_SLEEP_TIME_MILLISECONDS.count()))
+		.Times(testing::Exactly(2));
+
+	// when calling execute twice
+	target.execute(*mMockContext);
+	target.execute(*mMockContext);
+
+	// then
+	ASSERT_EQ(mMockContext->getLastCompletedFlushID(), 0);
+	ASSERT_FALSE(mMockContext->waitForFlush(flushID, 0L));
+}
+
+TEST_F(BeaconSendingCaptureOnStateTest, onlyFlushedOpenSessionsAreSentBeforeSendIntervalIsExceeded)
+{
+	// given
+	auto target = communication::BeaconSendingCaptureOnState();
+
+	auto sessionWrapper1 = std::make_shared<core::SessionWrapper>(mMockSession1Open);
+	sessionWrapper1->updateBeaconConfiguration(std::make_shared<configuration::BeaconConfiguration>(2, openkit::DataCollectionLevel::USER_BEHAVIOR, openkit::CrashReportingLevel::OPT_IN_CRASHES));
+	auto sessionWrapper2 = std::make_shared<core::SessionWrapper>(mMockSession2Open);
+	sessionWrapper2->updateBeaconConfiguration(std::make_shared<configuration::BeaconConfiguration>(2, openkit::DataCollectionLevel::USER_BEHAVIOR, openkit::CrashReportingLevel::OPT_IN_CRASHES));
+	std::vector<std::shared_ptr<core::SessionWrapper>> openSessions = { sessionWrapper1, sessionWrapper2 };
+
+	ON_CALL(*mMockContext, getAllFinishedAndConfiguredSessions())
+		.WillByDefault(testing::Return(std::vector<std::shared_ptr<core::SessionWrapper>>()));
+	ON_CALL(*mMockContext, getAllNewSessions())
+		.WillByDefault(testing::Return(std::vector<std::shared_ptr<core::SessionWrapper>>()));
+	ON_CALL(*mMockContext, getAllOpenAndConfiguredSessions())
+		.WillByDefault(testing::Return(openSessions));
+	ON_CALL(*mMockContext, isCaptureOn())
+		.WillByDefault(testing::Return(true));
+	ON_CALL(*mMockContext, consumeSessionFlushRequest())
+		.WillByDefault(testing::Return(true));
+
+	ON_CALL(*mMockContext, getCurrentTimestamp())
+		.WillByDefault(testing::Return(100));
+	ON_CALL(*mMockContext, getSendInterval())
+		.WillByDefault(testing::Return(50));
+	ON_CALL(*mMockContext, getLastOpenSessionBeaconSendTime())
+		.WillByDefault(testing::Return(99));
+
+	sessionWrapper2->requestFlush();
+
+	EXPECT_CALL(*mMockSession1Open, sendNextBeaconChunk(testing::_))
+		.Times(testing::Exactly(0));
+	EXPECT_CALL(*mMockSession2Open, handleBeaconChunkResponse(testing::NotNull()))
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mMockContext, setLastOpenSessionBeaconSendTime(testing::_))
+		.Times(testing::Exactly(0));
+
+	// when calling execute
+	target.execute(*mMockContext);
+
+	// then the flush request was consumed
+	ASSERT_FALSE(sessionWrapper2->consumeFlushRequest());
+}
+
+TEST_F(BeaconSendingCaptureOnStateTest, sessionFlushRequestIsKeptForFlushedSessionsWhichAreNotConfiguredYet)
+{
+	// given
+	auto target = communication::BeaconSendingCaptureOnState();
+
+	auto openSessionWrapper = std::make_shared<core::SessionWrapper>(mMockSession1Open);
+	openSessionWrapper->updateBeaconConfiguration(std::make_shared<configuration::BeaconConfiguration>(2, openkit::DataCollectionLevel::USER_BEHAVIOR, openkit::CrashReportingLevel::OPT_IN_CRASHES));
+	auto newSessionWrapper = std::make_shared<core::SessionWrapper>(mMockSession2Open);
+	std::vector<std::shared_ptr<core::SessionWrapper>> openSessions = { openSessionWrapper };
+	std::vector<std::shared_ptr<core::SessionWrapper>> newSessions = { newSessionWrapper };
+
+	ON_CALL(*mMockContext, getAllFinishedAndConfiguredSessions())
+		.WillByDefault(testing::Return(std::vector<std::shared_ptr<core::SessionWrapper>>()));
+	ON_CALL(*mMockContext, getAllNewSessions())
+		.WillByDefault(testing::Return(newSessions));
+	ON_CALL(*mMockContext, getAllOpenAndConfiguredSessions())
+		.WillByDefault(testing::Return(openSessions));
+	ON_CALL(*mMockContext, isCaptureOn())
+		.WillByDefault(testing::Return(true));
+	ON_CALL(*mMockContext, consumeSessionFlushRequest())
+		.WillByDefault(testing::Return(true));
+	// the new session request fails, so the new session is not configured in this pass
+	ON_CALL(*mMockHttpClient, sendNewSessionRequestRawPtrProxy())
+		.WillByDefault(testing::Invoke([this]() -> protocol::StatusResponse*
+		{
+			return new protocol::StatusResponse(mLogger, "", 500, protocol::Response::ResponseHeaders());
+		}));
+
+	ON_CALL(*mMockContext, getCurrentTimestamp())
+		.WillByDefault(testing::Return(100));
+	ON_CALL(*mMockContext, getSendInterval())
+		.WillByDefault(testing::Return(50));
+	ON_CALL(*mMockContext, getLastOpenSessionBeaconSendTime())
+		.WillByDefault(testing::Return(99));
+
+	openSessionWrapper->requestFlush();
+	newSessionWrapper->requestFlush();
+
+	// then the flushed open session is sent and the request is kept for the new session
+	EXPECT_CALL(*mMockSession1Open, handleBeaconChunkResponse(testing::NotNull()))
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mMockContext, keepSessionFlushRequest())
+		.Times(testing::Exactly(1));
+
+	// when calling execute
+	target.execute(*mMockContext);
+
+	// then
+	ASSERT_FALSE(openSessionWrapper->isFlushRequested());
+	ASSERT_TRUE(newSessionWrapper->isFlushRequested());
+}
+
+TEST_F(BeaconSendingCaptureOnStateTest, sessionFlushRequestIsNotKeptIfAllFlushedSessionsAreHandled)
+{
+	// given
+	auto target = communication::BeaconSendingCaptureOnState();
+
+	auto openSessionWrapper = std::make_shared<core::SessionWrapper>(mMockSession1Open);
+	openSessionWrapper->updateBeaconConfiguration(std::make_shared<configuration::BeaconConfiguration>(2, openkit::DataCollectionLevel::USER_BEHAVIOR, openkit::CrashReportingLevel::OPT_IN_CRASHES));
+	auto newSessionWrapper = std::make_shared<core::SessionWrapper>(mMockSession2Open);
+	std::vector<std::shared_ptr<core::SessionWrapper>> openSessions = { openSessionWrapper };
+	std::vector<std::shared_ptr<core::SessionWrapper>> newSessions = { newSessionWrapper };
+
+	ON_CALL(*mMockContext, getAllFinishedAndConfiguredSessions())
+		.WillByDefault(testing::Return(std::vector<std::shared_ptr<core::SessionWrapper>>()));
+	ON_CALL(*mMockContext, getAllNewSessions())
+		.WillByDefault(testing::Return(newSessions));
+	ON_CALL(*mMockContext, getAllOpenAndConfiguredSessions())
+		.WillByDefault(testing::Return(openSessions));
+	ON_CALL(*mMockContext, isCaptureOn())
+		.WillByDefault(testing::Return(true));
+	ON_CALL(*mMockContext, consumeSessionFlushRequest())
+		.WillByDefault(testing::Return(true));
+	ON_CALL(*mMockHttpClient, sendNewSessionRequestRawPtrProxy())
+		.WillByDefault(testing::Invoke([this]() -> protocol::StatusResponse*
+		{
+			return new protocol::StatusResponse(mLogger, "", 500, protocol::Response::ResponseHeaders());
+		}));
+
+	ON_CALL(*mMockContext, getCurrentTimestamp())
+		.WillByDefault(testing::Return(100));
+	ON_CALL(*mMockContext, getSendInterval())
+		.WillByDefault(testing::Return(50));
+	ON_CALL(*mMockContext, getLastOpenSessionBeaconSendTime())
+		.WillByDefault(testing::Return(99));
+
+	openSessionWrapper->requestFlush();
+
+	// then
+	EXPECT_CALL(*mMockContext, keepSessionFlushRequest())
+		.Times(testing::Exactly(0));
+
+	// when calling execute
+	target.execute(*mMockContext);
+}
+
+TEST_F(BeaconSendingCaptureOnStateTest, stateWaitsUntilNextDeadlineIfAllDataWasSent)
+{
+	// given
+	auto target = communication::BeaconSendingCaptureOnState();
+
+	ON_CALL(*mMockContext, getAllFinishedAndConfiguredSessions())
+		.WillByDefault(testing::Return(std::vector<std::shared_ptr<core::SessionWrapper>>()));
+	ON_CALL(*mMockContext, getAllNewSessions())
+		.WillByDefault(testing::Return(std::vector<std::shared_ptr<core::SessionWrapper>>()));
+	ON_CALL(*mMockContext, getAllOpenAndConfiguredSessions())
+		.WillByDefault(testing::Return(std::vector<std::shared_ptr<core::SessionWrapper>>()));
+	ON_CALL(*mMockContext, isCaptureOn())
+		.WillByDefault(testing::Return(true));
+	ON_CALL(*mMockContext, getCurrentTimestamp())
+		.WillByDefault(testing::Return(100));
+	ON_CALL(*mMockContext, getSendInterval())
+		.WillByDefault(testing::Return(120000));
+	ON_CALL(*mMockContext, getLastOpenSessionBeaconSendTime())
+		.WillByDefault(testing::Return(100));
+	ON_CALL(*mMockContext, getLastTimeSyncTime())
+		.WillByDefault(testing::Return(100));
+
+	// then the first pass happens after the default sleep time at latest, further passes when the time sync interval expires
+	testing::InSequence s;
+	EXPECT_CALL(*mMockContext, waitForWakeup(BeaconSendingContext::DEFAULT_SLEEP_TIME_MILLISECONDS.count()))
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mMockContext, waitForWakeup(BeaconSendingTimeSyncState::TIME_SYNC_INTERVAL_IN_MILLIS.count() + 1))
+		.Times(testing::Exactly(1));
+
+	// when calling execute twice
+	target.execute(*mMockContext);
+	target.execute(*mMockContext);
+}
+
 TEST_F(BeaconSendingCaptureOnStateTest, sendingOpenSessionsIsAbortedImmediatelyWhenTooManyRequestsResponseIsReceived)
 {
 	// given
@@ -812,20 +1562,12 @@ TEST_F(BeaconSendingCaptureOnStateTest, sendingOpenSessionsIsAbortedImmediatelyW
 	ON_CALL(*mMockContext, isCaptureOn())
 		.WillByDefault(testing::Return(true));
 
-	ON_CALL(*mMockSession1Open, sendBeaconRawPtrProxy(testing::_))
-		.WillByDefault(testing::Invoke([&](std::shared_ptr<providers::IHTTPClientProvider>) -> protocol::StatusResponse*
-	{
-		auto responseHeaders = protocol::Response::ResponseHeaders
-		{
-			{ "retry-after", {"678"} }
-		};
-		return new protocol::StatusResponse(mLogger, "", 429, responseHeaders);
-	}));
-	ON_CALL(*mMockSession2Open, sendBeaconRawPtrProxy(testing::_))
-		.WillByDefault(testing::Invoke([&](std::shared_ptr<providers::IHTTPClientProvider>) -> protocol::StatusResponse*
+	auto responseHeaders = protocol::Response::ResponseHeaders
 	{
-		return new protocol::StatusResponse(mLogger, core::UTF8String(), 200, protocol::Response::ResponseHeaders());
-	}));
+		{ "retry-after", {"678"} }
+	};
+	mockBeaconResponse(mMockSession1Open, 429, responseHeaders);
+	mockBeaconResponse(mMockSession2Open, 200);
 
 	ON_CALL(*mMockContext, getCurrentTimestamp())
 		.WillByDefault(testing::Return(100));
@@ -834,10 +1576,13 @@ TEST_F(BeaconSendingCaptureOnStateTest, sendingOpenSessionsIsAbortedImmediatelyW
 	ON_CALL(*mMockContext, getLastOpenSessionBeaconSendTime())
 		.WillByDefault(testing::Return(45));
 
-	EXPECT_CALL(*mMockSession1Open, sendBeaconRawPtrProxy(testing::_))
+	EXPECT_CALL(*mMockSession1Open, handleBeaconChunkResponse(testing::NotNull()))
+		.Times(testing::Exactly(1));
+	// session 2 was sent concurrently, its request is aborted and its data is kept
+	EXPECT_CALL(*mMockSession2Open, handleBeaconChunkResponse(testing::IsNull()))
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mMockMultiClient, cancelAllRequests())
 		.Times(testing::Exactly(1));
-	EXPECT_CALL(*mMockSession2Open, sendBeaconRawPtrProxy(testing::_))
-		.Times(testing::Exactly(0));
 
 	std::shared_ptr<AbstractBeaconSendingState> savedNextState = nullptr;
 	EXPECT_CALL(*mMockContext, setNextState(IsABeaconSendingCaptureOffState()))
@@ -884,29 +1629,17 @@ TEST_F(BeaconSendingCaptureOnStateTest, nothingIsSentIfStateIsInterruptedDuringS
 	ON_CALL(*mMockContext, isShutdownRequested())
 		.WillByDefault(testing::Return(true));
 
-	ON_CALL(*mMockSession1Open, sendBeaconRawPtrProxy(testing::_))
-		.WillByDefault(testing::Invoke([&](std::shared_ptr<providers::IHTTPClientProvider>) -> protocol::StatusResponse*
-	{
-		return new protocol::StatusResponse(mLogger, core::UTF8String(), 200, protocol::Response::ResponseHeaders());
-	}));
-	ON_CALL(*mMockSession2Open, sendBeaconRawPtrProxy(testing::_))
-		.WillByDefault(testing::Invoke([&](std::shared_ptr<providers::IHTTPClientProvider>) -> protocol::StatusResponse*
-	{
-		return new protocol::StatusResponse(mLogger, core::UTF8String(), 200, protocol::Response::ResponseHeaders());
-	}));
-	ON_CALL(*mMockSession3Finished, sendBeaconRawPtrProxy(testing::_))
-		.WillByDefault(testing::Invoke([&](std::shared_ptr<providers::IHTTPClientProvider>) -> protocol::StatusResponse*
-	{
-		return new protocol::StatusResponse(mLogger, core::UTF8String(), 200, protocol::Response::ResponseHeaders());
-	}));
+	mockBeaconResponse(mMockSession1Open, 200);
+	mockBeaconResponse(mMockSession2Open, 200);
+	mockBeaconResponse(mMockSession3Finished, 200);
 
 	EXPECT_CALL(*mMockHttpClient, sendNewSessionRequestRawPtrProxy())
 		.Times(testing::Exactly(0));
-	EXPECT_CALL(*mMockSession1Open, sendBeaconRawPtrProxy(testing::_))
+	EXPECT_CALL(*mMockSession1Open, sendNextBeaconChunk(testing::_))
 		.Times(testing::Exactly(0));
-	EXPECT_CALL(*mMockSession2Open, sendBeaconRawPtrProxy(testing::_))
+	EXPECT_CALL(*mMockSession2Open, sendNextBeaconChunk(testing::_))
 		.Times(testing::Exactly(0));
-	EXPECT_CALL(*mMockSession3Finished, sendBeaconRawPtrProxy(testing::_))
+	EXPECT_CALL(*mMockSession3Finished, sendNextBeaconChunk(testing::_))
 		.Times(testing::Exactly(0));
 
 	EXPECT_CALL(*mMockContext, setNextState(IsABeaconSendingFlushSessionsState()))
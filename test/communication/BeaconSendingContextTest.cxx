@@ -33,6 +33,9 @@
 #include "../communication/CustomMatchers.h"
 #include "../core/MockSession.h"
 
+#include <chrono>
+#include <thread>
+
 class BeaconSendingContextTest : public testing::Test
 {
 public:
@@ -436,6 +439,206 @@ TEST_F(BeaconSendingContextTest, sleepWithGivenTime)
 	ASSERT_GE(duration, std::chrono::milliseconds(100L));
 }
 
+TEST_F(BeaconSendingContextTest, waitForWakeupWaitsForGivenTimeWithoutWakeup)
+{
+	// given
+	auto target = std::shared_ptr<BeaconSendingContext>(new BeaconSendingContext(mLogger, mMockHttpClientProvider, mMockTimingProvider, mConfiguration));
+
+	// when
+	auto start = std::chrono::steady_clock::now();
+	target->waitForWakeup(100L);
+	auto duration = std::chrono::steady_clock::now() - start;
+
+	// then
+	ASSERT_GE(duration, std::chrono::milliseconds(100L));
+}
+
+TEST_F(BeaconSendingContextTest, waitForWakeupReturnsImmediatelyAfterWakeup)
+{
+	// given
+	auto target = std::shared_ptr<BeaconSendingContext>(new BeaconSendingContext(mLogger, mMockHttpClientProvider, mMockTimingProvider, mConfiguration));
+	target->wakeup();
+
+	// when
+	auto start = std::chrono::steady_clock::now();
+	target->waitForWakeup(60 * 1000L);
+	auto duration = std::chrono::steady_clock::now() - start;
+
+	// then
+	ASSERT_LT(duration, std::chrono::seconds(10));
+
+	// and when waiting again, the wakeup has been consumed
+	start = std::chrono::steady_clock::now();
+	target->waitForWakeup(100L);
+	duration = std::chrono::steady_clock::now() - start;
+
+	// then
+	ASSERT_GE(duration, std::chrono::milliseconds(100L));
+}
+
+TEST_F(BeaconSendingContextTest, startingAndFinishingASessionWakesUpTheSendingThread)
+{
+	// given
+	auto target = std::shared_ptr<BeaconSendingContext>(new BeaconSendingContext(mLogger, mMockHttpClientProvider, mMockTimingProvider, mConfiguration));
+	auto mockSession = std::shared_ptr<testing::NiceMock<test::MockSession>>(new testing::NiceMock<test::MockSession>(mLogger));
+
+	// when
+	target->startSession(mockSession);
+	auto start = std::chrono::steady_clock::now();
+	target->waitForWakeup(60 * 1000L);
+
+	// then
+	ASSERT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(10));
+
+	// and when
+	target->finishSession(mockSession);
+	start = std::chrono::steady_clock::now();
+	target->waitForWakeup(60 * 1000L);
+
+	// then
+	ASSERT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(10));
+}
+
+TEST_F(BeaconSendingContextTest, openSessionsSendingRequestIsConsumedOnce)
+{
+	// given
+	auto target = std::shared_ptr<BeaconSendingContext>(new BeaconSendingContext(mLogger, mMockHttpClientProvider, mMockTimingProvider, mConfiguration));
+
+	// then
+	ASSERT_FALSE(target->consumeOpenSessionsSendingRequest());
+
+	// and when
+	target->requestOpenSessionsSending();
+
+	// then
+	ASSERT_TRUE(target->consumeOpenSessionsSendingRequest());
+	ASSERT_FALSE(target->consumeOpenSessionsSendingRequest());
+}
+
+TEST_F(BeaconSendingContextTest, requestingAFlushWakesUpTheSendingThread)
+{
+	// given
+	auto target = std::shared_ptr<BeaconSendingContext>(new BeaconSendingContext(mLogger, mMockHttpClientProvider, mMockTimingProvider, mConfiguration));
+
+	// when
+	auto firstFlushID = target->requestFlush();
+	auto secondFlushID = target->requestFlush();
+	auto start = std::chrono::steady_clock::now();
+	target->waitForWakeup(60 * 1000L);
+
+	// then
+	ASSERT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(10));
+	ASSERT_GT(secondFlushID, firstFlushID);
+	ASSERT_EQ(target->getLastRequestedFlushID(), secondFlushID);
+	ASSERT_EQ(target->getLastCompletedFlushID(), 0);
+}
+
+TEST_F(BeaconSendingContextTest, waitForFlushReturnsFalseIfFlushIsNotCompletedInTime)
+{
+	// given
+	auto target = std::shared_ptr<BeaconSendingContext>(new BeaconSendingContext(mLogger, mMockHttpClientProvider, mMockTimingProvider, mConfiguration));
+	auto flushID = target->requestFlush();
+
+	// when
+	auto start = std::chrono::steady_clock::now();
+	auto obtained = target->waitForFlush(flushID, 100L);
+	auto duration = std::chrono::steady_clock::now() - start;
+
+	// then
+	ASSERT_FALSE(obtained);
+	ASSERT_GE(duration, std::chrono::milliseconds(100L));
+}
+
+TEST_F(BeaconSendingContextTest, waitForFlushReturnsWhenTheFlushIsCompleted)
+{
+	// given
+	auto target = std::shared_ptr<BeaconSendingContext>(new BeaconSendingContext(mLogger, mMockHttpClientProvider, mMockTimingProvider, mConfiguration));
+	auto firstFlushID = target->requestFlush();
+	auto secondFlushID = target->requestFlush();
+
+	// when
+	std::thread sendingThread([target, secondFlushID]() { target->setFlushCompleted(secondFlushID); });
+	auto start = std::chrono::steady_clock::now();
+	auto obtained = target->waitForFlush(firstFlushID, 60 * 1000L);
+	sendingThread.join();
+
+	// then the earlier flush is completed too
+	ASSERT_TRUE(obtained);
+	ASSERT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(10));
+	ASSERT_TRUE(target->waitForFlush(secondFlushID, 0L));
+	ASSERT_EQ(target->getLastCompletedFlushID(), secondFlushID);
+}
+
+TEST_F(BeaconSendingContextTest, waitForFlushReturnsFalseWhenShutdownIsRequested)
+{
+	// given
+	auto target = std::shared_ptr<BeaconSendingContext>(new BeaconSendingContext(mLogger, mMockHttpClientProvider, mMockTimingProvider, mConfiguration));
+	auto flushID = target->requestFlush();
+	target->requestShutdown();
+
+	// when
+	auto start = std::chrono::steady_clock::now();
+	auto obtained = target->waitForFlush(flushID, 60 * 1000L);
+
+	// then
+	ASSERT_FALSE(obtained);
+	ASSERT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(10));
+}
+
+TEST_F(BeaconSendingContextTest, flushingASessionMarksTheSessionAndWakesUpTheSendingThread)
+{
+	// given
+	auto target = std::shared_ptr<BeaconSendingContext>(new BeaconSendingContext(mLogger, mMockHttpClientProvider, mMockTimingProvider, mConfiguration));
+	auto mockSession = std::shared_ptr<testing::NiceMock<test::MockSession>>(new testing::NiceMock<test::MockSession>(mLogger));
+	target->startSession(mockSession);
+	target->waitForWakeup(0L);
+	ASSERT_FALSE(target->consumeSessionFlushRequest());
+
+	// when
+	target->flushSession(mockSession);
+	auto start = std::chrono::steady_clock::now();
+	target->waitForWakeup(60 * 1000L);
+
+	// then
+	ASSERT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(10));
+	ASSERT_TRUE(target->consumeSessionFlushRequest());
+	ASSERT_FALSE(target->consumeSessionFlushRequest());
+
+	auto sessionWrapper = target->findSessionWrapper(mockSession);
+	ASSERT_TRUE(sessionWrapper->consumeFlushRequest());
+	ASSERT_FALSE(sessionWrapper->consumeFlushRequest());
+}
+
+TEST_F(BeaconSendingContextTest, aConsumedSessionFlushRequestCanBeKept)
+{
+	// given
+	auto target = std::shared_ptr<BeaconSendingContext>(new BeaconSendingContext(mLogger, mMockHttpClientProvider, mMockTimingProvider, mConfiguration));
+	auto mockSession = std::shared_ptr<testing::NiceMock<test::MockSession>>(new testing::NiceMock<test::MockSession>(mLogger));
+	target->startSession(mockSession);
+	target->flushSession(mockSession);
+	ASSERT_TRUE(target->consumeSessionFlushRequest());
+
+	// when
+	target->keepSessionFlushRequest();
+
+	// then
+	ASSERT_TRUE(target->consumeSessionFlushRequest());
+	ASSERT_FALSE(target->consumeSessionFlushRequest());
+}
+
+TEST_F(BeaconSendingContextTest, flushingASessionThatHasNotBeenStartedBeforeIsIgnored)
+{
+	// given
+	auto target = std::shared_ptr<BeaconSendingContext>(new BeaconSendingContext(mLogger, mMockHttpClientProvider, mMockTimingProvider, mConfiguration));
+	auto mockSession = std::shared_ptr<testing::NiceMock<test::MockSession>>(new testing::NiceMock<test::MockSession>(mLogger));
+
+	// when
+	target->flushSession(mockSession);
+
+	// then
+	ASSERT_FALSE(target->consumeSessionFlushRequest());
+}
+
 TEST_F(BeaconSendingContextTest, defaultLastTimeSyncTimeIsMinusOne)
 {
 	// given
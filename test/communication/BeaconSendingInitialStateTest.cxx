@@ -193,19 +193,21 @@ TEST_F(BeaconSendingInitialStateTest, sleepTimeIsDoubledBetweenStatusRequestRetr
 		}));
 
 	// check for 
-	uint64_t initialSleep = communication::BeaconSendingInitialState::INITIAL_RETRY_SLEEP_TIME_MILLISECONDS.count();
+	auto retryPolicy = mockContext.getConfiguration()->getHTTPClientConfiguration()->getStatusRequestRetryPolicy();
+	int64_t initialSleep = retryPolicy->getInitialDelayInMilliseconds();
+	auto jitterFactor = retryPolicy->getJitterFactor();
 	testing::InSequence s;
 	EXPECT_CALL(mockContext, sleep(::testing::_))
 		.Times(::testing::Exactly(0));
-	EXPECT_CALL(mockContext, sleep(initialSleep))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep, jitterFactor)))
 		.Times(::testing::Exactly(1));
-	EXPECT_CALL(mockContext, sleep(initialSleep * 2))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep * 2, jitterFactor)))
 		.Times(::testing::Exactly(1));
-	EXPECT_CALL(mockContext, sleep(initialSleep * 4))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep * 4, jitterFactor)))
 		.Times(::testing::Exactly(1));
-	EXPECT_CALL(mockContext, sleep(initialSleep * 8))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep * 8, jitterFactor)))
 		.Times(::testing::Exactly(1));
-	EXPECT_CALL(mockContext, sleep(initialSleep * 16))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep * 16, jitterFactor)))
 		.Times(::testing::Exactly(1));
 	EXPECT_CALL(mockContext, sleep(BeaconSendingInitialState::REINIT_DELAY_MILLISECONDS[0].count()))
 		.Times(::testing::Exactly(1));
@@ -304,107 +306,108 @@ TEST_F(BeaconSendingInitialStateTest, reinitializeSleepsBeforeSendingStatusReque
 
 	testing::InSequence s;
 
-	uint64_t initialSleep = communication::BeaconSendingInitialState::INITIAL_RETRY_SLEEP_TIME_MILLISECONDS.count();
+	auto retryPolicy = mockContext.getConfiguration()->getHTTPClientConfiguration()->getStatusRequestRetryPolicy();
+	int64_t initialSleep = retryPolicy->getInitialDelayInMilliseconds();
+	auto jitterFactor = retryPolicy->getJitterFactor();
 	
 	// then
 	// the "unexpected" call
 	EXPECT_CALL(mockContext, sleep(::testing::_))
 		.Times(::testing::Exactly(0));
 	// from first round
-	EXPECT_CALL(mockContext, sleep(initialSleep))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep, jitterFactor)))
 		.Times(::testing::Exactly(1));
-	EXPECT_CALL(mockContext, sleep(initialSleep * 2))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep * 2, jitterFactor)))
 		.Times(::testing::Exactly(1));
-	EXPECT_CALL(mockContext, sleep(initialSleep * 4))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep * 4, jitterFactor)))
 		.Times(::testing::Exactly(1));
-	EXPECT_CALL(mockContext, sleep(initialSleep * 8))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep * 8, jitterFactor)))
 		.Times(::testing::Exactly(1));
-	EXPECT_CALL(mockContext, sleep(initialSleep * 16))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep * 16, jitterFactor)))
 		.Times(::testing::Exactly(1));
 	// delay between first and second attempt
 	EXPECT_CALL(mockContext, sleep(communication::BeaconSendingInitialState::REINIT_DELAY_MILLISECONDS[0].count()))
 		.Times(::testing::Exactly(1));
 	// and again the sequence
-	EXPECT_CALL(mockContext, sleep(initialSleep))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep, jitterFactor)))
 		.Times(::testing::Exactly(1));
-	EXPECT_CALL(mockContext, sleep(initialSleep * 2))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep * 2, jitterFactor)))
 		.Times(::testing::Exactly(1));
-	EXPECT_CALL(mockContext, sleep(initialSleep * 4))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep * 4, jitterFactor)))
 		.Times(::testing::Exactly(1));
-	EXPECT_CALL(mockContext, sleep(initialSleep * 8))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep * 8, jitterFactor)))
 		.Times(::testing::Exactly(1));
-	EXPECT_CALL(mockContext, sleep(initialSleep * 16))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep * 16, jitterFactor)))
 		.Times(::testing::Exactly(1));
 	// delay between second and third attempt
 	EXPECT_CALL(mockContext, sleep(communication::BeaconSendingInitialState::REINIT_DELAY_MILLISECONDS[1].count()))
 		.Times(::testing::Exactly(1));
 	// and again the sequence
-	EXPECT_CALL(mockContext, sleep(initialSleep))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep, jitterFactor)))
 		.Times(::testing::Exactly(1));
-	EXPECT_CALL(mockContext, sleep(initialSleep * 2))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep * 2, jitterFactor)))
 		.Times(::testing::Exactly(1));
-	EXPECT_CALL(mockContext, sleep(initialSleep * 4))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep * 4, jitterFactor)))
 		.Times(::testing::Exactly(1));
-	EXPECT_CALL(mockContext, sleep(initialSleep * 8))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep * 8, jitterFactor)))
 		.Times(::testing::Exactly(1));
-	EXPECT_CALL(mockContext, sleep(initialSleep * 16))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep * 16, jitterFactor)))
 		.Times(::testing::Exactly(1));
 	// delay between third and fourth attempt
 	EXPECT_CALL(mockContext, sleep(communication::BeaconSendingInitialState::REINIT_DELAY_MILLISECONDS[2].count()))
 		.Times(::testing::Exactly(1));
 	// and again the sequence
-	EXPECT_CALL(mockContext, sleep(initialSleep))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep, jitterFactor)))
 		.Times(::testing::Exactly(1));
-	EXPECT_CALL(mockContext, sleep(initialSleep * 2))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep * 2, jitterFactor)))
 		.Times(::testing::Exactly(1));
-	EXPECT_CALL(mockContext, sleep(initialSleep * 4))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep * 4, jitterFactor)))
 		.Times(::testing::Exactly(1));
-	EXPECT_CALL(mockContext, sleep(initialSleep * 8))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep * 8, jitterFactor)))
 		.Times(::testing::Exactly(1));
-	EXPECT_CALL(mockContext, sleep(initialSleep * 16))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep * 16, jitterFactor)))
 		.Times(::testing::Exactly(1));
 	// delay between fourth and fifth attempt
 	EXPECT_CALL(mockContext, sleep(communication::BeaconSendingInitialState::REINIT_DELAY_MILLISECONDS[3].count()))
 		.Times(::testing::Exactly(1));
 	// and again the sequence
-	EXPECT_CALL(mockContext, sleep(initialSleep))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep, jitterFactor)))
 		.Times(::testing::Exactly(1));
-	EXPECT_CALL(mockContext, sleep(initialSleep * 2))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep * 2, jitterFactor)))
 		.Times(::testing::Exactly(1));
-	EXPECT_CALL(mockContext, sleep(initialSleep * 4))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep * 4, jitterFactor)))
 		.Times(::testing::Exactly(1));
-	EXPECT_CALL(mockContext, sleep(initialSleep * 8))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep * 8, jitterFactor)))
 		.Times(::testing::Exactly(1));
-	EXPECT_CALL(mockContext, sleep(initialSleep * 16))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep * 16, jitterFactor)))
 		.Times(::testing::Exactly(1));
 	// delay between fifth and sixth attempt
 	EXPECT_CALL(mockContext, sleep(communication::BeaconSendingInitialState::REINIT_DELAY_MILLISECONDS[4].count()))
 		.Times(::testing::Exactly(1));
 	// and again the sequence
-	EXPECT_CALL(mockContext, sleep(initialSleep))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep, jitterFactor)))
 		.Times(::testing::Exactly(1));
-	EXPECT_CALL(mockContext, sleep(initialSleep * 2))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep * 2, jitterFactor)))
 		.Times(::testing::Exactly(1));
-	EXPECT_CALL(mockContext, sleep(initialSleep * 4))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep * 4, jitterFactor)))
 		.Times(::testing::Exactly(1));
-	EXPECT_CALL(mockContext, sleep(initialSleep * 8))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep * 8, jitterFactor)))
 		.Times(::testing::Exactly(1));
-	EXPECT_CALL(mockContext, sleep(initialSleep * 16))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep * 16, jitterFactor)))
 		.Times(::testing::Exactly(1));
 	// delay between sixth and seventh attempt
 	EXPECT_CALL(mockContext, sleep(communication::BeaconSendingInitialState::REINIT_DELAY_MILLISECONDS[4].count()))
 		.Times(::testing::Exactly(1));
 	// and again the sequence
-	EXPECT_CALL(mockContext, sleep(initialSleep))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep, jitterFactor)))
 		.Times(::testing::Exactly(1));
-	EXPECT_CALL(mockContext, sleep(initialSleep * 2))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep * 2, jitterFactor)))
 		.Times(::testing::Exactly(1));
-	EXPECT_CALL(mockContext, sleep(initialSleep * 4))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep * 4, jitterFactor)))
 		.Times(::testing::Exactly(1));
-	EXPECT_CALL(mockContext, sleep(initialSleep * 8))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep * 8, jitterFactor)))
 		.Times(::testing::Exactly(1));
-	EXPECT_CALL(mockContext, sleep(initialSleep * 
-		16))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep * 16, jitterFactor)))
 		.Times(::testing::Exactly(1));
 		EXPECT_CALL(mockContext, sleep(communication::BeaconSendingInitialState::REINIT_DELAY_MILLISECONDS[4].count()))
 		.Times(::testing::Exactly(1));
@@ -66,7 +66,7 @@ TEST_F(BeaconSendingRequestUtilTest, sendStatusRequestIsAbortedWhenShutdownIsReq
 		.Times(::testing::Exactly(1));
 
 	// when
-	auto obtained = BeaconSendingRequestUtil::sendStatusRequest(*mMockContext, 5, 1000L);
+	auto obtained = BeaconSendingRequestUtil::sendStatusRequest(*mMockContext, protocol::RetryPolicy(5, 1000L, 60000L, 0.0));
 
 	// then
 	ASSERT_NE(nullptr, obtained);
@@ -89,7 +89,7 @@ TEST_F(BeaconSendingRequestUtilTest, sendStatusRequestIsAbortedIfTheNumberOfRetr
 		.Times(::testing::Exactly(4));
 
 	// when
-	auto obtained = BeaconSendingRequestUtil::sendStatusRequest(*mMockContext, 3, 1000L);
+	auto obtained = BeaconSendingRequestUtil::sendStatusRequest(*mMockContext, protocol::RetryPolicy(3, 1000L, 60000L, 0.0));
 
 	// then
 	ASSERT_NE(nullptr, obtained);
@@ -112,7 +112,7 @@ TEST_F(BeaconSendingRequestUtilTest, sendStatusRequestIsDoneWhenHttpClientReturn
 		.Times(::testing::Exactly(1));
 
 	// when
-	auto obtained = BeaconSendingRequestUtil::sendStatusRequest(*mMockContext, 3, 1000L);
+	auto obtained = BeaconSendingRequestUtil::sendStatusRequest(*mMockContext, protocol::RetryPolicy(3, 1000L, 60000L, 0.0));
 
 	// then
 	ASSERT_NE(nullptr, obtained);
@@ -140,7 +140,57 @@ TEST_F(BeaconSendingRequestUtilTest, sleepTimeIsDoubledBetweenConsecutiveRetries
 		.Times(::testing::Exactly(6));
 
 	// when
-	auto obtained = BeaconSendingRequestUtil::sendStatusRequest(*mMockContext, 5, 1000L);
+	auto obtained = BeaconSendingRequestUtil::sendStatusRequest(*mMockContext, protocol::RetryPolicy(5, 1000L, 60000L, 0.0));
+
+	// then
+	ASSERT_NE(nullptr, obtained);
+}
+
+TEST_F(BeaconSendingRequestUtilTest, sleepTimeIsCappedByTheRetryPolicy)
+{
+	// given
+	ON_CALL(*mMockHTTPClient, sendStatusRequestRawPtrProxy())
+		.WillByDefault(testing::Invoke([&]() ->  protocol::StatusResponse* { return new protocol::StatusResponse(mLogger, "", 400, protocol::Response::ResponseHeaders()); }));
+	ON_CALL(*mMockContext, isShutdownRequested())
+		.WillByDefault(testing::Return(false));
+
+	// verify
+	{
+		testing::InSequence dummy;
+		EXPECT_CALL(*mMockContext, sleep(1000L));
+		EXPECT_CALL(*mMockContext, sleep(2000L));
+		EXPECT_CALL(*mMockContext, sleep(3000L));
+		EXPECT_CALL(*mMockContext, sleep(3000L));
+	}
+
+	EXPECT_CALL(*mMockHTTPClient, sendStatusRequestRawPtrProxy())
+		.Times(::testing::Exactly(5));
+
+	// when
+	auto obtained = BeaconSendingRequestUtil::sendStatusRequest(*mMockContext, protocol::RetryPolicy(4, 1000L, 3000L, 0.0));
+
+	// then
+	ASSERT_NE(nullptr, obtained);
+}
+
+TEST_F(BeaconSendingRequestUtilTest, sleepTimeHonoursRetryAfterResponseHeader)
+{
+	// given
+	ON_CALL(*mMockHTTPClient, sendStatusRequestRawPtrProxy())
+		.WillByDefault(testing::Invoke([&]() ->  protocol::StatusResponse* {
+			return new protocol::StatusResponse(mLogger, "", 503, protocol::Response::ResponseHeaders{ { "retry-after", { "30" } } });
+		}));
+	ON_CALL(*mMockContext, isShutdownRequested())
+		.WillByDefault(testing::Return(false));
+
+	// verify
+	EXPECT_CALL(*mMockContext, sleep(30000L))
+		.Times(::testing::Exactly(2));
+	EXPECT_CALL(*mMockHTTPClient, sendStatusRequestRawPtrProxy())
+		.Times(::testing::Exactly(3));
+
+	// when
+	auto obtained = BeaconSendingRequestUtil::sendStatusRequest(*mMockContext, protocol::RetryPolicy(2, 1000L, 60000L, 0.0));
 
 	// then
 	ASSERT_NE(nullptr, obtained);
@@ -163,7 +213,7 @@ TEST_F(BeaconSendingRequestUtilTest, sendStatusRequestHandlesNullResponsesSameAs
 		.Times(::testing::Exactly(4));
 
 	// when
-	auto obtained = BeaconSendingRequestUtil::sendStatusRequest(*mMockContext, 3, 1000L);
+	auto obtained = BeaconSendingRequestUtil::sendStatusRequest(*mMockContext, protocol::RetryPolicy(3, 1000L, 60000L, 0.0));
 
 	// then
 	ASSERT_EQ(nullptr, obtained);
@@ -186,7 +236,7 @@ TEST_F(BeaconSendingRequestUtilTest, sendStatusRequestReturnsTooManyRequestsResp
 		.Times(::testing::Exactly(1));
 
 	// when
-	auto obtained = BeaconSendingRequestUtil::sendStatusRequest(*mMockContext, 5, 1000L);
+	auto obtained = BeaconSendingRequestUtil::sendStatusRequest(*mMockContext, protocol::RetryPolicy(5, 1000L, 60000L, 0.0));
 
 	// then
 	ASSERT_NE(nullptr, obtained);
@@ -17,6 +17,7 @@
 #include "communication/BeaconSendingResponseUtil.h"
 #include "../protocol/NullLogger.h"
 
+#include <limits>
 #include <memory>
 
 #include <gtest/gtest.h>
@@ -110,6 +111,39 @@ TEST_F(BeaconSendingResponseUtilTest, isTooManyRequestsResponseReturnsTrueIfResp
 	// when
 	auto obtained = communication::BeaconSendingResponseUtil::isTooManyRequestsResponse(response);
 
+	// then
+	ASSERT_TRUE(obtained);
+}
+
+TEST_F(BeaconSendingResponseUtilTest, isConnectionErrorResponseReturnsFalseIfResponseIsNull)
+{
+	// when
+	auto obtained = communication::BeaconSendingResponseUtil::isConnectionErrorResponse(nullptr);
+
+	// then
+	ASSERT_FALSE(obtained);
+}
+
+TEST_F(BeaconSendingResponseUtilTest, isConnectionErrorResponseReturnsFalseIfServerResponded)
+{
+	// given
+	auto response = std::make_shared<StubResponse>(500, protocol::Response::ResponseHeaders());
+
+	// when
+	auto obtained = communication::BeaconSendingResponseUtil::isConnectionErrorResponse(response);
+
+	// then
+	ASSERT_FALSE(obtained);
+}
+
+TEST_F(BeaconSendingResponseUtilTest, isConnectionErrorResponseReturnsTrueIfRequestFailedOnConnectionLevel)
+{
+	// given
+	auto response = std::make_shared<StubResponse>(std::numeric_limits<int32_t>::max(), protocol::Response::ResponseHeaders());
+
+	// when
+	auto obtained = communication::BeaconSendingResponseUtil::isConnectionErrorResponse(response);
+
 	// then
 	ASSERT_TRUE(obtained);
 }
\ No newline at end of file
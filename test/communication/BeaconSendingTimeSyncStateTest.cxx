@@ -297,19 +297,21 @@ TEST_F(BeaconSendingTimeSyncTest, sleepTimeDoublesBetweenConsecutiveTimeSyncRequ
 	// then
 	testing::InSequence s;
 
-	uint64_t initialSleep = communication::BeaconSendingTimeSyncState::INITIAL_RETRY_SLEEP_TIME_MILLISECONDS.count();
+	auto retryPolicy = mockContext.getConfiguration()->getHTTPClientConfiguration()->getTimeSyncRequestRetryPolicy();
+	int64_t initialSleep = retryPolicy->getInitialDelayInMilliseconds();
+	auto jitterFactor = retryPolicy->getJitterFactor();
 
 	// then
 	// from first round
-	EXPECT_CALL(mockContext, sleep(initialSleep))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep, jitterFactor)))
 		.Times(::testing::Exactly(1));
-	EXPECT_CALL(mockContext, sleep(initialSleep * 2))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep * 2, jitterFactor)))
 		.Times(::testing::Exactly(1));
-	EXPECT_CALL(mockContext, sleep(initialSleep * 4))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep * 4, jitterFactor)))
 		.Times(::testing::Exactly(1));
-	EXPECT_CALL(mockContext, sleep(initialSleep * 8))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep * 8, jitterFactor)))
 		.Times(::testing::Exactly(1));
-	EXPECT_CALL(mockContext, sleep(initialSleep * 16))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialSleep * 16, jitterFactor)))
 		.Times(::testing::Exactly(1));
 
 	// when
@@ -364,44 +366,46 @@ TEST_F(BeaconSendingTimeSyncTest, sleepTimeIsResetToInitialValueAfterASuccessful
 	}));
 
 	testing::Sequence s;
-	uint64_t initialRetrySleepTime = communication::BeaconSendingTimeSyncState::INITIAL_RETRY_SLEEP_TIME_MILLISECONDS.count();
+	auto retryPolicy = mockContext.getConfiguration()->getHTTPClientConfiguration()->getTimeSyncRequestRetryPolicy();
+	int64_t initialRetrySleepTime = retryPolicy->getInitialDelayInMilliseconds();
+	auto jitterFactor = retryPolicy->getJitterFactor();
 
 	// then verify init was done
-	EXPECT_CALL(mockContext, initializeTimeSync(2L, true))
+	EXPECT_CALL(mockContext, initializeTimeSync(1L, true))
 		.Times(testing::Exactly(1));
 
 	// and verify method calls
-	EXPECT_CALL(mockContext, sleep(initialRetrySleepTime))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialRetrySleepTime, jitterFactor)))
 		.Times(testing::Exactly(1))
 		.InSequence(s);
 	// second time sync request -> 2 retries
-	EXPECT_CALL(mockContext, sleep(initialRetrySleepTime))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialRetrySleepTime, jitterFactor)))
 		.Times(testing::Exactly(1))
 		.InSequence(s);
-	EXPECT_CALL(mockContext, sleep(initialRetrySleepTime * 2))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialRetrySleepTime * 2, jitterFactor)))
 		.Times(testing::Exactly(1))
 		.InSequence(s);
 	// third time sync request -> 3 retries
-	EXPECT_CALL(mockContext, sleep(initialRetrySleepTime))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialRetrySleepTime, jitterFactor)))
 		.Times(testing::Exactly(1))
 		.InSequence(s);
-	EXPECT_CALL(mockContext, sleep(initialRetrySleepTime * 2))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialRetrySleepTime * 2, jitterFactor)))
 		.Times(testing::Exactly(1))
 		.InSequence(s);
-	EXPECT_CALL(mockContext, sleep(initialRetrySleepTime * 4))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialRetrySleepTime * 4, jitterFactor)))
 		.Times(testing::Exactly(1))
 		.InSequence(s);
 	// fourth time sync request -> 4 retries
-	EXPECT_CALL(mockContext, sleep(initialRetrySleepTime))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialRetrySleepTime, jitterFactor)))
 		.Times(testing::Exactly(1))
 		.InSequence(s);
-	EXPECT_CALL(mockContext, sleep(initialRetrySleepTime * 2))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialRetrySleepTime * 2, jitterFactor)))
 		.Times(testing::Exactly(1))
 		.InSequence(s);
-	EXPECT_CALL(mockContext, sleep(initialRetrySleepTime * 4))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialRetrySleepTime * 4, jitterFactor)))
 		.Times(testing::Exactly(1))
 		.InSequence(s);
-	EXPECT_CALL(mockContext, sleep(initialRetrySleepTime * 8))
+	EXPECT_CALL(mockContext, sleep(IsRetryDelay(initialRetrySleepTime * 8, jitterFactor)))
 		.Times(testing::Exactly(1))
 		.InSequence(s);
 	// fifth time sync request -> 0 retries
@@ -462,13 +466,13 @@ TEST_F(BeaconSendingTimeSyncTest, successfulTimeSyncInitializesTimeProvider)
 
 
 	// verify init was done
-	EXPECT_CALL(mockContext, initializeTimeSync(2L, true))
+	EXPECT_CALL(mockContext, initializeTimeSync(1L, true))
 		.Times(testing::Exactly(1));
 
 	// verify number of method calls
 	uint32_t numberOfTimeSyncRequests = communication::BeaconSendingTimeSyncState::REQUIRED_TIME_SYNC_REQUESTS;
 	EXPECT_CALL(mockContext, getHTTPClient())
-		.Times(testing::Exactly(numberOfTimeSyncRequests));
+		.Times(testing::Exactly(1));
 	EXPECT_CALL(*mMockHTTPClient, sendTimeSyncRequestRawPtrProxy())
 		.Times(testing::Exactly(numberOfTimeSyncRequests));
 	EXPECT_CALL(mockContext, getCurrentTimestamp())
@@ -534,13 +538,13 @@ TEST_F(BeaconSendingTimeSyncTest, successfulTimeSyncSetSuccessfulInitCompletionI
 
 
 	// verify init was done
-	EXPECT_CALL(mockContext, initializeTimeSync(2L, true))
+	EXPECT_CALL(mockContext, initializeTimeSync(1L, true))
 		.Times(testing::Exactly(1));
 
 	// verify number of method calls
 	uint32_t numberOfTimeSyncRequests = communication::BeaconSendingTimeSyncState::REQUIRED_TIME_SYNC_REQUESTS;
 	EXPECT_CALL(mockContext, getHTTPClient())
-		.Times(testing::Exactly(numberOfTimeSyncRequests));
+		.Times(testing::Exactly(1));
 	EXPECT_CALL(*mMockHTTPClient, sendTimeSyncRequestRawPtrProxy())
 		.Times(testing::Exactly(numberOfTimeSyncRequests));
 	EXPECT_CALL(mockContext, getCurrentTimestamp())
@@ -554,6 +558,52 @@ TEST_F(BeaconSendingTimeSyncTest, successfulTimeSyncSetSuccessfulInitCompletionI
 	target.execute(mockContext);
 }
 
+TEST_F(BeaconSendingTimeSyncTest, clusterTimeOffsetIsTakenFromTheRequestWithTheSmallestRoundTripTime)
+{
+	// given
+	auto target = communication::BeaconSendingTimeSyncState(false);
+
+	testing::NiceMock<test::MockBeaconSendingContext> mockContext(mLogger);
+	ON_CALL(mockContext, getLastTimeSyncTime())
+		.WillByDefault(testing::Return(-1));
+	ON_CALL(mockContext, isTimeSyncSupported())
+		.WillByDefault(testing::Return(true));
+	ON_CALL(mockContext, getHTTPClient())
+		.WillByDefault(testing::Return(mMockHTTPClient));
+
+	// server side timestamps (request receive time, response send time) of the time sync requests
+	std::vector<std::pair<int64_t, int64_t>> serverTimestamps = { { 100, 101 }, { 250, 251 }, { 400, 401 }, { 500, 501 }, { 600, 601 } };
+	ON_CALL(*mMockHTTPClient, sendTimeSyncRequestRawPtrProxy())
+		.WillByDefault(testing::Invoke([&]() -> protocol::TimeSyncResponse* {
+			auto timestamps = serverTimestamps.front();
+			serverTimestamps.erase(serverTimestamps.begin());
+
+			core::UTF8String response(protocol::RESPONSE_KEY_REQUEST_RECEIVE_TIME);
+			response.concatenate("=" + std::to_string(timestamps.first) + "&");
+			response.concatenate(protocol::RESPONSE_KEY_RESPONSE_SEND_TIME);
+			response.concatenate("=" + std::to_string(timestamps.second));
+			return new protocol::TimeSyncResponse(mLogger, response, 200, protocol::Response::ResponseHeaders());
+		}));
+
+	// client side timestamps (request send time, response receive time), the second request has the smallest round trip time
+	std::vector<int64_t> clientTimestamps = { 0, 50, 100, 110, 200, 260, 300, 340, 400, 450, 500 };
+	ON_CALL(mockContext, getCurrentTimestamp())
+		.WillByDefault(testing::Invoke([&clientTimestamps]() -> int64_t {
+			auto time = clientTimestamps.front();
+			clientTimestamps.erase(clientTimestamps.begin());
+			return time;
+		}));
+
+	// verify offset of the second request ((250 - 100) + (251 - 110)) / 2 is used
+	EXPECT_CALL(mockContext, initializeTimeSync(145L, true))
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(mockContext, setLastTimeSyncTime(500L))
+		.Times(testing::Exactly(1));
+
+	// when
+	target.execute(mockContext);
+}
+
 TEST_F(BeaconSendingTimeSyncTest, timeSyncSupportIsDisabledIfBothTimeStampsInTimeSyncResponseAreNegative)
 {
 	// given
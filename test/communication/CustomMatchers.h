@@ -99,4 +99,17 @@ MATCHER(IsABeaconSendingTerminalState, "")
 	return false;
 }
 
+/// Checks if the argument is a retry delay derived from the given delay, which was shortened by at most the given jitter factor
+MATCHER_P2(IsRetryDelay, delay, jitterFactor, "")
+{
+	auto minDelay = static_cast<int64_t>(delay) - static_cast<int64_t>(delay * jitterFactor);
+	if (arg >= minDelay && arg <= static_cast<int64_t>(delay))
+	{
+		return true;
+	}
+	*result_listener << "Expected retry delay in range [" << minDelay << ", " << delay << "]";
+
+	return false;
+}
+
 #endif
\ No newline at end of file
@@ -58,6 +58,14 @@ namespace test
 		{
 		}
 
+		MockBeaconSendingContext(std::shared_ptr<openkit::ILogger> logger, std::shared_ptr<configuration::Configuration> configuration)
+			: BeaconSendingContext(logger,
+				std::make_shared<test::MockHTTPClientProvider>(),
+				std::make_shared<test::MockTimingProvider>(),
+				configuration)
+		{
+		}
+
 		MOCK_METHOD0(requestShutdown, void());
 		MOCK_CONST_METHOD0(isShutdownRequested, bool());
 		MOCK_METHOD1(setInitCompleted, void(bool));
@@ -70,9 +78,14 @@ namespace test
 		MOCK_METHOD1(setNextState, void(std::shared_ptr<AbstractBeaconSendingState> nextState));
 		MOCK_METHOD0(getHTTPClientProvider, std::shared_ptr<providers::IHTTPClientProvider>());
 		MOCK_METHOD0(getHTTPClient, std::shared_ptr<protocol::IHTTPClient>());
+		MOCK_METHOD0(getHTTPMultiClient, std::shared_ptr<protocol::IHTTPMultiClient>());
 		MOCK_CONST_METHOD0(getCurrentTimestamp, int64_t());
 		MOCK_METHOD0(sleep, void());
 		MOCK_METHOD1(sleep, void(int64_t));
+		MOCK_METHOD1(waitForWakeup, void(int64_t));
+		MOCK_METHOD0(consumeOpenSessionsSendingRequest, bool());
+		MOCK_METHOD0(consumeSessionFlushRequest, bool());
+		MOCK_METHOD0(keepSessionFlushRequest, void());
 		MOCK_METHOD1(setLastOpenSessionBeaconSendTime, void(int64_t));
 		MOCK_CONST_METHOD0(getLastOpenSessionBeaconSendTime, int64_t());
 		MOCK_METHOD1(setLastStatusCheckTime, void(int64_t));
@@ -69,4 +69,24 @@ TEST_F(BeaconCacheConfigurationTest, getCacheSizeUpperBound)
 
 	config = new BeaconCacheConfiguration(0L, 1, 2);
 	ASSERT_EQ(config->getCacheSizeUpperBound(), 2L);
+}
+
+TEST_F(BeaconCacheConfigurationTest, evictionNotificationDefaultsToUpperBoundAndDefaultInterval)
+{
+	// given
+	BeaconCacheConfiguration config(0L, 1, 2);
+
+	// then
+	ASSERT_EQ(config.getEvictionNotificationThreshold(), 2L);
+	ASSERT_EQ(config.getEvictionNotificationInterval(), BeaconCacheConfiguration::DEFAULT_EVICTION_NOTIFICATION_INTERVAL_IN_MILLIS.count());
+}
+
+TEST_F(BeaconCacheConfigurationTest, getEvictionNotificationSettings)
+{
+	// given
+	BeaconCacheConfiguration config(0L, 1, 2, 1024, 250);
+
+	// then
+	ASSERT_EQ(config.getEvictionNotificationThreshold(), 1024L);
+	ASSERT_EQ(config.getEvictionNotificationInterval(), 250L);
 }
\ No newline at end of file
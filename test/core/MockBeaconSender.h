@@ -46,6 +46,7 @@ namespace test {
 
 		MOCK_METHOD1(startSession, void(std::shared_ptr<core::Session>));
 		MOCK_METHOD1(finishSession, void(std::shared_ptr<core::Session>));
+		MOCK_METHOD1(flushSession, void(std::shared_ptr<core::Session>));
 	};
 }
 #endif
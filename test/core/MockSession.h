@@ -46,6 +46,8 @@ namespace test
 		MOCK_METHOD1(enterAction, std::shared_ptr<openkit::IRootAction>(const char*));
 		MOCK_METHOD0(end, void());
 		MOCK_METHOD1(sendBeaconRawPtrProxy, protocol::StatusResponse*(std::shared_ptr<providers::IHTTPClientProvider>));
+		MOCK_METHOD1(sendNextBeaconChunk, protocol::IHTTPMultiClient::RequestID(std::shared_ptr<protocol::IHTTPMultiClient>));
+		MOCK_METHOD1(handleBeaconChunkResponse, bool(std::shared_ptr<protocol::StatusResponse>));
 		MOCK_CONST_METHOD0(isEmpty, bool());
 		MOCK_METHOD0(clearCapturedData, void());
 		MOCK_CONST_METHOD0(getEndTime, int64_t());
@@ -0,0 +1,218 @@
+/**
+* Copyright 2018 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "core/SessionRegistry.h"
+#include "core/SessionWrapper.h"
+#include "configuration/BeaconConfiguration.h"
+
+#include "MockSession.h"
+
+#include <sstream>
+
+class SessionRegistryTest : public testing::Test
+{
+public:
+	SessionRegistryTest()
+		: devNull()
+		, mLogger(nullptr)
+	{
+	}
+
+	void SetUp()
+	{
+		mLogger = std::make_shared<core::util::DefaultLogger>(devNull, true);
+	}
+
+	std::shared_ptr<core::SessionWrapper> createSessionWrapper()
+	{
+		auto session = std::make_shared<testing::NiceMock<test::MockSession>>(mLogger);
+		return std::make_shared<core::SessionWrapper>(session);
+	}
+
+	std::ostringstream devNull;
+	std::shared_ptr<openkit::ILogger> mLogger;
+};
+
+TEST_F(SessionRegistryTest, addedSessionsAreNew)
+{
+	// given
+	core::SessionRegistry target;
+	auto first = createSessionWrapper();
+	auto second = createSessionWrapper();
+
+	// when
+	target.add(first);
+	target.add(second);
+
+	// then
+	ASSERT_EQ(target.getNewSessions(), std::vector<std::shared_ptr<core::SessionWrapper>>({ first, second }));
+	ASSERT_TRUE(target.getOpenAndConfiguredSessions().empty());
+	ASSERT_TRUE(target.getFinishedAndConfiguredSessions().empty());
+}
+
+TEST_F(SessionRegistryTest, configuringASessionMovesItToOpenSessions)
+{
+	// given
+	core::SessionRegistry target;
+	auto first = createSessionWrapper();
+	auto second = createSessionWrapper();
+	target.add(first);
+	target.add(second);
+
+	// when
+	second->updateBeaconConfiguration(std::make_shared<configuration::BeaconConfiguration>());
+
+	// then
+	ASSERT_EQ(target.getNewSessions(), std::vector<std::shared_ptr<core::SessionWrapper>>({ first }));
+	ASSERT_EQ(target.getOpenAndConfiguredSessions(), std::vector<std::shared_ptr<core::SessionWrapper>>({ second }));
+	ASSERT_TRUE(target.getFinishedAndConfiguredSessions().empty());
+}
+
+TEST_F(SessionRegistryTest, finishingAnOpenSessionMovesItToFinishedSessions)
+{
+	// given
+	core::SessionRegistry target;
+	auto sessionWrapper = createSessionWrapper();
+	target.add(sessionWrapper);
+	sessionWrapper->updateBeaconConfiguration(std::make_shared<configuration::BeaconConfiguration>());
+
+	// when
+	sessionWrapper->finishSession();
+
+	// then
+	ASSERT_TRUE(target.getNewSessions().empty());
+	ASSERT_TRUE(target.getOpenAndConfiguredSessions().empty());
+	ASSERT_EQ(target.getFinishedAndConfiguredSessions(), std::vector<std::shared_ptr<core::SessionWrapper>>({ sessionWrapper }));
+}
+
+TEST_F(SessionRegistryTest, finishedSessionStaysNewUntilItIsConfigured)
+{
+	// given
+	core::SessionRegistry target;
+	auto sessionWrapper = createSessionWrapper();
+	target.add(sessionWrapper);
+
+	// when
+	sessionWrapper->finishSession();
+
+	// then
+	ASSERT_EQ(target.getNewSessions(), std::vector<std::shared_ptr<core::SessionWrapper>>({ sessionWrapper }));
+
+	// and when
+	sessionWrapper->updateBeaconConfiguration(std::make_shared<configuration::BeaconConfiguration>());
+
+	// then
+	ASSERT_TRUE(target.getNewSessions().empty());
+	ASSERT_TRUE(target.getOpenAndConfiguredSessions().empty());
+	ASSERT_EQ(target.getFinishedAndConfiguredSessions(), std::vector<std::shared_ptr<core::SessionWrapper>>({ sessionWrapper }));
+}
+
+TEST_F(SessionRegistryTest, findReturnsTheWrapperOfARegisteredSession)
+{
+	// given
+	core::SessionRegistry target;
+	auto sessionWrapper = createSessionWrapper();
+	auto unregisteredSessionWrapper = createSessionWrapper();
+	target.add(sessionWrapper);
+
+	// then
+	ASSERT_EQ(target.find(sessionWrapper->getWrappedSession()), sessionWrapper);
+	ASSERT_EQ(sessionWrapper->getWrappedSession()->getSessionWrapper(), sessionWrapper);
+	ASSERT_EQ(target.find(unregisteredSessionWrapper->getWrappedSession()), nullptr);
+}
+
+TEST_F(SessionRegistryTest, removedSessionsAreNoLongerFound)
+{
+	// given
+	core::SessionRegistry target;
+	auto first = createSessionWrapper();
+	auto second = createSessionWrapper();
+	target.add(first);
+	target.add(second);
+	second->updateBeaconConfiguration(std::make_shared<configuration::BeaconConfiguration>());
+
+	// when
+	auto firstRemoved = target.remove(first);
+	auto secondRemoved = target.remove(second);
+
+	// then
+	ASSERT_TRUE(firstRemoved);
+	ASSERT_TRUE(secondRemoved);
+	ASSERT_TRUE(target.getAllSessions().empty());
+	ASSERT_EQ(target.find(first->getWrappedSession()), nullptr);
+
+	// and when removing again
+	auto removedAgain = target.remove(first);
+
+	// then
+	ASSERT_FALSE(removedAgain);
+}
+
+TEST_F(SessionRegistryTest, stateChangesOfRemovedSessionsAreIgnored)
+{
+	// given
+	core::SessionRegistry target;
+	auto sessionWrapper = createSessionWrapper();
+	target.add(sessionWrapper);
+	target.remove(sessionWrapper);
+
+	// when
+	sessionWrapper->updateBeaconConfiguration(std::make_shared<configuration::BeaconConfiguration>());
+	sessionWrapper->finishSession();
+
+	// then
+	ASSERT_TRUE(target.getAllSessions().empty());
+}
+
+TEST_F(SessionRegistryTest, getAllSessionsReturnsSessionsOfAllStates)
+{
+	// given
+	core::SessionRegistry target;
+	auto newSession = createSessionWrapper();
+	auto openSession = createSessionWrapper();
+	auto finishedSession = createSessionWrapper();
+	target.add(newSession);
+	target.add(openSession);
+	target.add(finishedSession);
+	openSession->updateBeaconConfiguration(std::make_shared<configuration::BeaconConfiguration>());
+	finishedSession->updateBeaconConfiguration(std::make_shared<configuration::BeaconConfiguration>());
+	finishedSession->finishSession();
+
+	// when
+	auto obtained = target.getAllSessions();
+
+	// then
+	ASSERT_EQ(obtained, std::vector<std::shared_ptr<core::SessionWrapper>>({ newSession, openSession, finishedSession }));
+}
+
+TEST_F(SessionRegistryTest, sessionWrappersCanOutliveTheRegistry)
+{
+	// given
+	auto sessionWrapper = createSessionWrapper();
+	{
+		core::SessionRegistry target;
+		target.add(sessionWrapper);
+	}
+
+	// when, then no registry is accessed anymore
+	sessionWrapper->updateBeaconConfiguration(std::make_shared<configuration::BeaconConfiguration>());
+	sessionWrapper->finishSession();
+	ASSERT_TRUE(sessionWrapper->isSessionFinished());
+}
@@ -427,6 +427,39 @@ TEST_F(SessionTest, endSessionTwice)
 	ASSERT_NE(target->getEndTime(), -1);
 }
 
+TEST_F(SessionTest, flushSessionForwardsToBeaconSender)
+{
+	EXPECT_CALL(*mockBeaconSender, startSession(testing::_))
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mockBeaconSender, flushSession(testing::_))
+		.Times(testing::Exactly(1));
+
+	// given
+	auto target = std::make_shared<core::Session>(logger, mockBeaconSender, mockBeaconNice);
+	target->startSession();
+
+	// when
+	target->flush();
+}
+
+TEST_F(SessionTest, flushDoesNothingIfSessionIsEnded)
+{
+	EXPECT_CALL(*mockBeaconSender, startSession(testing::_))
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mockBeaconSender, finishSession(testing::_))
+		.Times(testing::Exactly(1));
+	EXPECT_CALL(*mockBeaconSender, flushSession(testing::_))
+		.Times(testing::Exactly(0));
+
+	// given
+	auto target = std::make_shared<core::Session>(logger, mockBeaconSender, mockBeaconNice);
+	target->startSession();
+	target->end();
+
+	// when
+	target->flush();
+}
+
 TEST_F(SessionTest, endSessionWithOpenRootActions)
 {
 	// set mock behavior of HTTPClient and HTTPClientProvider
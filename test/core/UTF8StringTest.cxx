@@ -17,6 +17,8 @@
 #include "memory.h"
 
 #include <cstdint>
+#include <random>
+#include <string>
 #include <gtest/gtest.h>
 
 using namespace core;
@@ -33,6 +35,70 @@ public:
 	{
 
 	}
+
+	///
+	/// Byte by byte reference validation, used to verify the optimized implementation.
+	/// Returns the validated data and stores the number of characters in @c characterCount.
+	///
+	static std::string referenceValidate(const std::string& input, size_t& characterCount)
+	{
+		std::string result;
+		characterCount = 0;
+
+		int sequenceLength = -1;
+		int sequencePosition = -1;
+		for (size_t i = 0; i < input.size(); i++)
+		{
+			auto character = static_cast<unsigned char>(input[i]);
+			int width = (character & 0x80) == 0 ? 1
+				: (character & 0xE0) == 0xC0 ? 2
+				: (character & 0xF0) == 0xE0 ? 3
+				: (character & 0xF8) == 0xF0 ? 4 : 0;
+
+			if ((character & 0xC0) == 0x80)
+			{
+				sequencePosition++;
+				if (sequencePosition > sequenceLength - 1)
+				{
+					result += "\xEF\xBF\xBD";
+					characterCount++;
+					sequenceLength = -1;
+					sequencePosition = -1;
+				}
+				else if (sequencePosition == sequenceLength - 1)
+				{
+					result += input.substr(i - sequenceLength + 1, sequenceLength);
+					characterCount++;
+					sequenceLength = -1;
+					sequencePosition = -1;
+				}
+			}
+			else if (width == 1)
+			{
+				if (sequenceLength >= 0)
+				{
+					result += "\xEF\xBF\xBD";
+					characterCount++;
+				}
+				result += input[i];
+				characterCount++;
+				sequenceLength = -1;
+				sequencePosition = -1;
+			}
+			else if (width > 1)
+			{
+				if (sequenceLength != -1)
+				{
+					result += "\xEF\xBF\xBD";
+					characterCount++;
+				}
+				sequenceLength = width;
+				sequencePosition = 0;
+			}
+		}
+
+		return result;
+	}
 };
 
 TEST_F(UTF8StringTest, aStringCanBeInitializedWithAnASCIIString)
@@ -747,4 +813,85 @@ TEST_F(UTF8StringTest, notEqualUtf8Strings)
 
 	EXPECT_FALSE(s1 == s2);
 	EXPECT_TRUE(s1 != s2);
-}
\ No newline at end of file
+}
+
+TEST_F(UTF8StringTest, longASCIIStringIsCopiedUnchanged)
+{
+	std::string data;
+	for (auto i = 0; i < 1000; i++)
+	{
+		data += static_cast<char>(1 + i % 127);
+	}
+
+	UTF8String s(data);
+
+	EXPECT_EQ(s.getStringData(), data);
+	EXPECT_EQ(s.getStringLength(), data.size());
+}
+
+TEST_F(UTF8StringTest, invalidByteIsReplacedAtEveryPositionOfALongString)
+{
+	// move an invalid continuation byte through strings of different lengths, to cover block boundaries
+	for (size_t length = 1; length < 80; length++)
+	{
+		for (size_t position = 0; position < length; position++)
+		{
+			std::string data(length, 'a');
+			data[position] = '\x80';
+
+			UTF8String s(data);
+
+			std::string expected(length, 'a');
+			expected.replace(position, 1, "\xEF\xBF\xBD");
+			EXPECT_EQ(s.getStringData(), expected) << "length " << length << ", position " << position;
+			EXPECT_EQ(s.getStringLength(), length);
+		}
+	}
+}
+
+TEST_F(UTF8StringTest, validationMatchesReferenceForRandomData)
+{
+	// bytes which are interesting for UTF8 validation
+	const unsigned char alphabet[] = { 'a', 'Z', '0', ' ', 0x7F, 0x80, 0xBF, 0xC3, 0xA4, 0xE2, 0x82, 0xAC, 0xF0, 0x9F, 0x98, 0x8B, 0xF8, 0xFF };
+
+	std::mt19937 generator(42);
+	std::uniform_int_distribution<size_t> lengthDistribution(1, 100);
+	std::uniform_int_distribution<size_t> characterDistribution(0, sizeof(alphabet) - 1);
+	std::uniform_int_distribution<int> asciiRunDistribution(0, 3);
+
+	for (auto iteration = 0; iteration < 5000; iteration++)
+	{
+		std::string data;
+		auto length = lengthDistribution(generator);
+		while (data.size() < length)
+		{
+			if (asciiRunDistribution(generator) == 0)
+			{
+				// long US-ASCII runs exercise the fast path
+				data.append(lengthDistribution(generator), 'x');
+			}
+			else
+			{
+				data += static_cast<char>(alphabet[characterDistribution(generator)]);
+			}
+		}
+
+		size_t expectedLength = 0;
+		auto expected = referenceValidate(data, expectedLength);
+
+		UTF8String s(data);
+
+		ASSERT_EQ(s.getStringData(), expected) << "iteration " << iteration;
+		ASSERT_EQ(s.getStringLength(), expectedLength) << "iteration " << iteration;
+
+		size_t byteLength = 0;
+		UTF8String::size_type stringLength = 0;
+		auto wellFormed = UTF8String::isWellFormed(data.c_str(), byteLength, stringLength);
+		ASSERT_EQ(wellFormed, expected == data) << "iteration " << iteration;
+		if (wellFormed)
+		{
+			ASSERT_EQ(byteLength, data.size()) << "iteration " << iteration;
+			ASSERT_EQ(stringLength, expectedLength) << "iteration " << iteration;
+		}
+	}
+}
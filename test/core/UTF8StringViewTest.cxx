@@ -0,0 +1,168 @@
+/**
+* Copyright 2018 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "core/UTF8StringView.h"
+
+#include <sstream>
+#include <string>
+#include <gtest/gtest.h>
+
+using namespace core;
+
+class UTF8StringViewTest : public testing::Test
+{
+};
+
+TEST_F(UTF8StringViewTest, defaultConstructedViewIsEmpty)
+{
+	UTF8StringView target;
+
+	EXPECT_TRUE(target.empty());
+	EXPECT_EQ(target.getByteLength(), 0u);
+	EXPECT_EQ(target.getStringLength(), 0u);
+	EXPECT_NE(target.getData(), nullptr);
+}
+
+TEST_F(UTF8StringViewTest, viewOnStringReferencesStringData)
+{
+	UTF8String string("H\xC3\xA4llo");
+
+	UTF8StringView target(string);
+
+	EXPECT_EQ(target.getData(), string.getStringData().data());
+	EXPECT_EQ(target.getByteLength(), 6u);
+	EXPECT_EQ(target.getStringLength(), 5u);
+}
+
+TEST_F(UTF8StringViewTest, validateReferencesWellFormedInputWithoutCopying)
+{
+	const char* input = "Z\xC3\xBCrich \xE2\x82\xAC \xF0\x9F\x98\x80";
+	UTF8String storage;
+
+	auto target = UTF8StringView::validate(input, storage);
+
+	EXPECT_EQ(target.getData(), input);
+	EXPECT_EQ(target.getByteLength(), strlen(input));
+	EXPECT_EQ(target.getStringLength(), 10u);
+	EXPECT_TRUE(storage.empty());
+}
+
+TEST_F(UTF8StringViewTest, validateReplacesInvalidInputUsingStorage)
+{
+	const char* input = "a\xC3" "b";
+	UTF8String storage;
+
+	auto target = UTF8StringView::validate(input, storage);
+
+	EXPECT_EQ(target.getData(), storage.getStringData().data());
+	EXPECT_EQ(storage, UTF8String(input));
+	EXPECT_EQ(target.getStringLength(), storage.getStringLength());
+}
+
+TEST_F(UTF8StringViewTest, validateProducesSameDataAsUTF8String)
+{
+	const char* inputs[] = { "", "plain ASCII", "\xC3\xA4\xC3\xB6\xC3\xBC", "\xF8\xF9" "abc", "abc\xE2\x82", "\x80", "\xED\xA0\x80" };
+	for (auto input : inputs)
+	{
+		UTF8String storage;
+		auto target = UTF8StringView::validate(input, storage);
+		UTF8String expected(input);
+
+		EXPECT_EQ(target.toUTF8String(), expected);
+		EXPECT_EQ(target.getStringLength(), expected.getStringLength());
+	}
+}
+
+TEST_F(UTF8StringViewTest, validateNullptrGivesEmptyView)
+{
+	UTF8String storage;
+
+	auto target = UTF8StringView::validate(nullptr, storage);
+
+	EXPECT_TRUE(target.empty());
+	EXPECT_EQ(target.getByteLength(), 0u);
+}
+
+TEST_F(UTF8StringViewTest, prefixOfShortViewIsSameView)
+{
+	UTF8String string("abc");
+	UTF8StringView target(string);
+
+	auto prefix = target.prefix(3);
+
+	EXPECT_EQ(prefix.getData(), target.getData());
+	EXPECT_EQ(prefix.getByteLength(), 3u);
+	EXPECT_EQ(prefix.getStringLength(), 3u);
+}
+
+TEST_F(UTF8StringViewTest, prefixOfASCIIView)
+{
+	UTF8String string("abcdef");
+	UTF8StringView target(string);
+
+	auto prefix = target.prefix(2);
+
+	EXPECT_EQ(prefix.getData(), target.getData());
+	EXPECT_EQ(prefix.toUTF8String(), UTF8String("ab"));
+	EXPECT_EQ(prefix.getStringLength(), 2u);
+}
+
+TEST_F(UTF8StringViewTest, prefixOfMultibyteViewMatchesSubstring)
+{
+	UTF8String string("a\xC3\xA4\xE2\x82\xAC\xF0\x9F\x98\x80z");
+	UTF8StringView target(string);
+
+	for (UTF8String::size_type length = 0; length <= string.getStringLength(); length++)
+	{
+		auto prefix = target.prefix(length);
+
+		EXPECT_EQ(prefix.toUTF8String(), string.substring(0, length));
+		EXPECT_EQ(prefix.getStringLength(), length);
+	}
+}
+
+TEST_F(UTF8StringViewTest, toUTF8StringCopiesData)
+{
+	UTF8String storage;
+	auto target = UTF8StringView::validate("\xC3\xA4pfel", storage);
+
+	auto copy = target.toUTF8String();
+
+	EXPECT_EQ(copy, UTF8String("\xC3\xA4pfel"));
+	EXPECT_EQ(copy.getStringLength(), 5u);
+}
+
+TEST_F(UTF8StringViewTest, viewsWithEqualDataCompareEqual)
+{
+	UTF8String first("same");
+	UTF8String second("same");
+	UTF8String third("other");
+
+	EXPECT_TRUE(UTF8StringView(first) == UTF8StringView(second));
+	EXPECT_FALSE(UTF8StringView(first) != UTF8StringView(second));
+	EXPECT_TRUE(UTF8StringView(first) != UTF8StringView(third));
+	EXPECT_TRUE(UTF8StringView() == UTF8StringView(UTF8String()));
+}
+
+TEST_F(UTF8StringViewTest, streamOperatorWritesReferencedBytes)
+{
+	UTF8String string("abcdef");
+	std::ostringstream stream;
+
+	stream << UTF8StringView(string).prefix(3);
+
+	EXPECT_EQ(stream.str(), "abc");
+}
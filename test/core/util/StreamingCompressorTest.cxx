@@ -0,0 +1,158 @@
+/**
+* Copyright 2018 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "core/util/StreamingCompressor.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <zlib.h>
+
+using namespace base::util;
+
+class StreamingCompressorTest : public testing::Test
+{
+public:
+	///
+	/// Read all compressed data in pieces of the given size
+	///
+	static std::vector<unsigned char> readAll(StreamingCompressor& target, size_t bufferSize)
+	{
+		std::vector<unsigned char> result;
+		std::vector<unsigned char> buffer(bufferSize);
+		size_t written = 0;
+		while ((written = target.read(buffer.data(), buffer.size())) > 0)
+		{
+			result.insert(result.end(), buffer.begin(), buffer.begin() + written);
+		}
+		return result;
+	}
+
+	///
+	/// Decompress gzip compressed data
+	///
+	static std::string decompress(std::vector<unsigned char>& compressedData)
+	{
+		std::string result;
+		unsigned char buffer[1024];
+
+		z_stream stream = z_stream();
+		inflateInit2(&stream, 15 | 16);
+		stream.next_in = compressedData.data();
+		stream.avail_in = static_cast<uInt>(compressedData.size());
+
+		int inflateResult = Z_OK;
+		while (inflateResult == Z_OK)
+		{
+			stream.next_out = buffer;
+			stream.avail_out = sizeof(buffer);
+			inflateResult = inflate(&stream, Z_NO_FLUSH);
+			result.append(reinterpret_cast<char*>(buffer), sizeof(buffer) - stream.avail_out);
+		}
+		inflateEnd(&stream);
+
+		EXPECT_EQ(inflateResult, Z_STREAM_END);
+		return result;
+	}
+};
+
+TEST_F(StreamingCompressorTest, nothingIsReadBeforeReset)
+{
+	StreamingCompressor target;
+	unsigned char buffer[16];
+
+	EXPECT_EQ(target.read(buffer, sizeof(buffer)), 0u);
+	EXPECT_FALSE(target.hasError());
+}
+
+TEST_F(StreamingCompressorTest, gzipCompressHelloWorld)
+{
+	const std::string inData = "Hello World";
+	StreamingCompressor target;
+
+	ASSERT_TRUE(target.reset(inData.data(), inData.size()));
+	auto compressedData = readAll(target, 1024);
+
+	// verify the GZIP magical number
+	ASSERT_GT(compressedData.size(), 3u);
+	EXPECT_EQ(compressedData[0], 0x1F);
+	EXPECT_EQ(compressedData[1], 0x8B);
+	EXPECT_EQ(compressedData[2], 0x08);
+	EXPECT_EQ(decompress(compressedData), inData);
+	EXPECT_FALSE(target.hasError());
+}
+
+TEST_F(StreamingCompressorTest, dataCanBeReadInSmallPieces)
+{
+	std::string inData;
+	for (auto i = 0; i < 10000; i++)
+	{
+		inData.append("et=1&na=" + std::to_string(i * 7919) + "&");
+	}
+	StreamingCompressor target;
+
+	ASSERT_TRUE(target.reset(inData.data(), inData.size()));
+	auto compressedData = readAll(target, 7);
+
+	EXPECT_LT(compressedData.size(), inData.size());
+	EXPECT_EQ(decompress(compressedData), inData);
+}
+
+TEST_F(StreamingCompressorTest, emptyInputGivesValidGzipData)
+{
+	StreamingCompressor target;
+
+	ASSERT_TRUE(target.reset(nullptr, 0));
+	auto compressedData = readAll(target, 64);
+
+	EXPECT_EQ(decompress(compressedData), "");
+}
+
+TEST_F(StreamingCompressorTest, resetRestartsCompression)
+{
+	const std::string firstData = "first data";
+	const std::string secondData = "second data";
+	StreamingCompressor target;
+	unsigned char buffer[4];
+
+	// when the first input is only partially read
+	ASSERT_TRUE(target.reset(firstData.data(), firstData.size()));
+	target.read(buffer, sizeof(buffer));
+
+	// then a reset starts over with new input
+	ASSERT_TRUE(target.reset(secondData.data(), secondData.size()));
+	auto compressedData = readAll(target, 1024);
+	EXPECT_EQ(decompress(compressedData), secondData);
+
+	// and the same input can be compressed again
+	ASSERT_TRUE(target.reset(secondData.data(), secondData.size()));
+	EXPECT_EQ(readAll(target, 1024), compressedData);
+}
+
+TEST_F(StreamingCompressorTest, segmentsAreCompressedAsContiguousInput)
+{
+	core::UTF8String first("prefix");
+	core::UTF8String second("&");
+	core::UTF8String third("d\xC3\xA4ta");
+	std::vector<core::UTF8StringView> segments = { first, second, core::UTF8StringView(), third };
+	StreamingCompressor target;
+
+	ASSERT_TRUE(target.reset(segments));
+	auto compressedData = readAll(target, 5);
+
+	EXPECT_EQ(decompress(compressedData), "prefix&d\xC3\xA4ta");
+}
@@ -17,6 +17,7 @@
 #include "memory.h"
 
 #include <cstdint>
+#include <string>
 #include <gtest/gtest.h>
 
 using namespace core;
@@ -25,6 +26,31 @@ class URLEncodingTest : public testing::Test
 {
 public:
 
+	///
+	/// Straightforward byte by byte encoding used as reference for the optimized implementation
+	///
+	static std::string referenceEncode(const std::string& data)
+	{
+		static const std::string unreserved = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_.~";
+		static const char hexDigits[] = "0123456789ABCDEF";
+
+		std::string encoded;
+		for (auto character : data)
+		{
+			if (unreserved.find(character) != std::string::npos)
+			{
+				encoded += character;
+			}
+			else
+			{
+				auto byte = static_cast<unsigned char>(character);
+				encoded += '%';
+				encoded += hexDigits[byte >> 4];
+				encoded += hexDigits[byte & 0x0F];
+			}
+		}
+		return encoded;
+	}
 };
 
 
@@ -125,4 +151,59 @@ TEST_F(URLEncodingTest, urlEncodeDecodePercentSignPreserved)
 
 	EXPECT_TRUE(decoded.equals(s));
 
-}
\ No newline at end of file
+}
+
+TEST_F(URLEncodingTest, urlEncodeAppendsToExistingBuffer)
+{
+	std::string encoded("na=");
+	core::util::URLEncoding::urlencode(UTF8String("a b"), encoded);
+
+	EXPECT_EQ(encoded, "na=a%20b");
+}
+
+TEST_F(URLEncodingTest, urlEncodeEveryByteValue)
+{
+	for (auto value = 0; value < 256; value++)
+	{
+		std::string data(1, static_cast<char>(value));
+		std::string encoded;
+		core::util::URLEncoding::urlencode(data.data(), data.size(), encoded);
+
+		EXPECT_EQ(encoded, referenceEncode(data)) << "byte value " << value;
+	}
+}
+
+TEST_F(URLEncodingTest, urlEncodeMatchesReferenceForAllLengthsAndPositions)
+{
+	// move a reserved character through strings of different lengths, to cover block boundaries
+	for (size_t length = 0; length < 70; length++)
+	{
+		for (size_t position = 0; position <= length; position++)
+		{
+			std::string data(length, 'x');
+			if (position < length)
+			{
+				data[position] = position % 2 == 0 ? ' ' : '\xC3';
+			}
+
+			std::string encoded;
+			core::util::URLEncoding::urlencode(data.data(), data.size(), encoded);
+
+			EXPECT_EQ(encoded, referenceEncode(data)) << "length " << length << ", position " << position;
+		}
+	}
+}
+
+TEST_F(URLEncodingTest, urlEncodeMatchesReferenceForMixedData)
+{
+	std::string data;
+	for (auto i = 0; i < 1024; i++)
+	{
+		data += static_cast<char>((i * 37 + i / 7) & 0xFF);
+	}
+
+	std::string encoded;
+	core::util::URLEncoding::urlencode(data.data(), data.size(), encoded);
+
+	EXPECT_EQ(encoded, referenceEncode(data));
+}
@@ -31,6 +31,7 @@
 #include "configuration/Configuration.h"
 
 #include "../protocol/MockHTTPClient.h"
+#include "../protocol/MockHTTPMultiClient.h"
 #include "../providers/MockHTTPClientProvider.h"
 #include "../core/MockWebRequestTracer.h"
 #include "../providers/MockPRNGenerator.h"
@@ -96,6 +97,13 @@ protected:
 		return std::make_shared<protocol::Beacon>(logger, beaconCache, configuration, core::UTF8String(""), threadIDProvider, mockTimingProvider, randomGeneratorMock);
 	}
 
+	std::shared_ptr<protocol::Beacon> buildBeaconWithSharedImmutableData(std::shared_ptr<const protocol::ImmutableBeaconData> immutableBeaconData)
+	{
+		// uses the configuration of the most recently built beacon, but a separate cache
+		return std::make_shared<protocol::Beacon>(logger, std::make_shared<caching::BeaconCache>(logger), configuration, core::UTF8String(""),
+			threadIDProvider, mockTimingProvider, randomGeneratorMock, immutableBeaconData);
+	}
+
 	std::shared_ptr<testing::NiceMock<test::MockWebRequestTracer>> createMockedWebRequestTracer(std::shared_ptr<protocol::Beacon> beacon)
 	{
 		return std::make_shared<testing::NiceMock<test::MockWebRequestTracer>>(logger, beacon);
@@ -131,6 +139,16 @@ protected:
 		return mockTimingProvider;
 	}
 
+	std::shared_ptr<testing::NiceMock<test::MockHTTPClientProvider>> getHTTPClientProviderMock()
+	{
+		return mockHTTPClientProvider;
+	}
+
+	std::shared_ptr<testing::NiceMock<test::MockHTTPClient>> getHTTPClientMock()
+	{
+		return mockHTTPClient;
+	}
+
 	std::shared_ptr<configuration::Configuration> getConfiguration()
 	{
 		return configuration;
@@ -141,6 +159,16 @@ protected:
 		return logger;
 	}
 
+	std::shared_ptr<caching::BeaconCache> getBeaconCache()
+	{
+		return beaconCache;
+	}
+
+	std::shared_ptr<providers::IThreadIDProvider> getThreadIDProvider()
+	{
+		return threadIDProvider;
+	}
+
 	void TearDown()
 	{
 
@@ -731,7 +759,7 @@ TEST_F(BeaconTest, intValueNotReportedForDataCollectionLevel0)
 		.Times(0);
 
 	// when
-	target->reportValue(1, "the answer", 42);
+	target->reportValue(1, core::UTF8String("the answer"), 42);
 
 	//then
 	ASSERT_TRUE(target->isEmpty());
@@ -747,7 +775,7 @@ TEST_F(BeaconTest, intValueNotReportedForDataCollectionLevel1)
 		.Times(0);
 
 	// when
-	target->reportValue(1, "the answer", 42);
+	target->reportValue(1, core::UTF8String("the answer"), 42);
 
 	//then
 	ASSERT_TRUE(target->isEmpty());
@@ -764,7 +792,7 @@ TEST_F(BeaconTest, intValueReportedForDataCollectionLevel2)
 		.Times(1);
 
 	// when
-	target->reportValue(1, "the answer", 42);
+	target->reportValue(1, core::UTF8String("the answer"), 42);
 
 	//then
 	ASSERT_FALSE(target->isEmpty());
@@ -780,7 +808,7 @@ TEST_F(BeaconTest, doubleValueNotReportedForDataCollectionLevel0)
 		.Times(0);
 
 	// when
-	target->reportValue(1, "the answer", 42.0);
+	target->reportValue(1, core::UTF8String("the answer"), 42.0);
 
 	//then
 	ASSERT_TRUE(target->isEmpty());
@@ -796,7 +824,7 @@ TEST_F(BeaconTest, doubleValueNotReportedForDataCollectionLevel1)
 		.Times(0);
 
 	// when
-	target->reportValue(1, "the answer", 42.0);
+	target->reportValue(1, core::UTF8String("the answer"), 42.0);
 
 	//then
 	ASSERT_TRUE(target->isEmpty());
@@ -813,7 +841,7 @@ TEST_F(BeaconTest, doubleValueReportedForDataCollectionLevel2)
 		.Times(1);
 
 	// when
-	target->reportValue(1, "the answer", 42.0);
+	target->reportValue(1, core::UTF8String("the answer"), 42.0);
 
 	//then
 	ASSERT_FALSE(target->isEmpty());
@@ -829,7 +857,7 @@ TEST_F(BeaconTest, stringValueNotReportedForDataCollectionLevel0)
 		.Times(0);
 
 	// when
-	target->reportValue(1, "the answer", "the answer is 42");
+	target->reportValue(1, core::UTF8String("the answer"), core::UTF8String("the answer is 42"));
 
 	//then
 	ASSERT_TRUE(target->isEmpty());
@@ -845,7 +873,7 @@ TEST_F(BeaconTest, stringValueNotReportedForDataCollectionLevel1)
 		.Times(0);
 
 	// when
-	target->reportValue(1, "the answer", "the answer is 42");
+	target->reportValue(1, core::UTF8String("the answer"), core::UTF8String("the answer is 42"));
 
 	//then
 	ASSERT_TRUE(target->isEmpty());
@@ -862,7 +890,7 @@ TEST_F(BeaconTest, stringValueReportedForDataCollectionLevel2)
 		.Times(1);
 
 	// when
-	target->reportValue(1, "the answer", "the answer is 42");
+	target->reportValue(1, core::UTF8String("the answer"), core::UTF8String("the answer is 42"));
 
 	//then
 	ASSERT_FALSE(target->isEmpty());
@@ -878,7 +906,7 @@ TEST_F(BeaconTest, namedEventNotReportedForDataCollectionLevel0)
 		.Times(0);
 
 	// when
-	target->reportEvent(1, "2 equals to 3 for large values of 2");
+	target->reportEvent(1, core::UTF8String("2 equals to 3 for large values of 2"));
 
 	//then
 	ASSERT_TRUE(target->isEmpty());
@@ -894,7 +922,7 @@ TEST_F(BeaconTest, namedEventNotReportedForDataCollectionLevel1)
 		.Times(0);
 
 	// when
-	target->reportEvent(1, "2 equals to 3 for large values of 2");
+	target->reportEvent(1, core::UTF8String("2 equals to 3 for large values of 2"));
 
 	//then
 	ASSERT_TRUE(target->isEmpty());
@@ -911,7 +939,7 @@ TEST_F(BeaconTest, namedEventNotReportedForDataCollectionLevel2)
 		.Times(1);
 
 	// when
-	target->reportEvent(1, "2 equals to 3 for large values of 2");
+	target->reportEvent(1, core::UTF8String("2 equals to 3 for large values of 2"));
 
 	//then
 	ASSERT_FALSE(target->isEmpty());
@@ -964,3 +992,281 @@ TEST_F(BeaconTest, sessionStartIsReportedForDataCollectionLevel2)
 	//then
 	ASSERT_FALSE(target->isEmpty());
 }
+
+TEST_F(BeaconTest, reportValueIntSerializesEventData)
+{
+	// given
+	auto target = buildBeacon(openkit::DataCollectionLevel::USER_BEHAVIOR, openkit::CrashReportingLevel::OFF);
+	auto threadID = std::to_string(getThreadIDProvider()->getThreadID());
+
+	// when
+	target->reportValue(3, core::UTF8String("the answer"), 42);
+
+	// then
+	auto events = getBeaconCache()->getEvents(target->getSessionNumber());
+	ASSERT_EQ(events.size(), 1u);
+	EXPECT_EQ(events[0].getStringData(), "et=12&na=the%20answer&it=" + threadID + "&pa=3&s0=1&t0=0&vl=42");
+}
+
+TEST_F(BeaconTest, reportValueDoubleSerializesEventData)
+{
+	// given
+	auto target = buildBeacon(openkit::DataCollectionLevel::USER_BEHAVIOR, openkit::CrashReportingLevel::OFF);
+	auto threadID = std::to_string(getThreadIDProvider()->getThreadID());
+
+	// when
+	target->reportValue(3, core::UTF8String("pi"), 3.1415);
+
+	// then
+	auto events = getBeaconCache()->getEvents(target->getSessionNumber());
+	ASSERT_EQ(events.size(), 1u);
+	EXPECT_EQ(events[0].getStringData(), "et=13&na=pi&it=" + threadID + "&pa=3&s0=1&t0=0&vl=3.141500");
+}
+
+TEST_F(BeaconTest, reportErrorSerializesEventData)
+{
+	// given
+	auto target = buildBeacon(openkit::DataCollectionLevel::PERFORMANCE, openkit::CrashReportingLevel::OFF);
+	auto threadID = std::to_string(getThreadIDProvider()->getThreadID());
+
+	// when
+	target->reportError(7, core::UTF8String("error"), -132, core::UTF8String("no reason"));
+
+	// then
+	auto events = getBeaconCache()->getEvents(target->getSessionNumber());
+	ASSERT_EQ(events.size(), 1u);
+	EXPECT_EQ(events[0].getStringData(), "et=40&na=error&it=" + threadID + "&pa=7&s0=1&t0=0&ev=-132&rs=no%20reason");
+}
+
+TEST_F(BeaconTest, eventNameIsTruncatedTo250Characters)
+{
+	// given
+	auto target = buildBeacon(openkit::DataCollectionLevel::USER_BEHAVIOR, openkit::CrashReportingLevel::OFF);
+	auto threadID = std::to_string(getThreadIDProvider()->getThreadID());
+
+	// when
+	target->reportEvent(1, core::UTF8String(std::string(250, 'a') + "b"));
+
+	// then
+	auto events = getBeaconCache()->getEvents(target->getSessionNumber());
+	ASSERT_EQ(events.size(), 1u);
+	EXPECT_EQ(events[0].getStringData(), "et=10&na=" + std::string(250, 'a') + "&it=" + threadID + "&pa=1&s0=1&t0=0");
+}
+
+TEST_F(BeaconTest, sendNextChunkReturnsInvalidRequestIDIfThereIsNoData)
+{
+	// given
+	auto target = buildBeaconWithDefaultConfig();
+	auto multiClient = std::make_shared<testing::NiceMock<test::MockHTTPMultiClient>>();
+
+	// then
+	EXPECT_CALL(*multiClient, addBeaconRequest(testing::_, testing::_, testing::_))
+		.Times(testing::Exactly(0));
+
+	// when
+	auto requestID = target->sendNextChunk(multiClient);
+
+	// then
+	ASSERT_EQ(IHTTPMultiClient::INVALID_REQUEST_ID, requestID);
+}
+
+TEST_F(BeaconTest, sendNextChunkAddsBeaconRequestToMultiClient)
+{
+	// given
+	auto target = buildBeaconWithDefaultConfig();
+	target->reportEvent(1, core::UTF8String("event"));
+	auto multiClient = std::make_shared<testing::NiceMock<test::MockHTTPMultiClient>>();
+	std::shared_ptr<const caching::BeaconChunk> sentBeaconChunk;
+
+	// then
+	EXPECT_CALL(*multiClient, addBeaconRequest(testing::_, testing::_, testing::_))
+		.Times(testing::Exactly(1))
+		.WillOnce(testing::DoAll(testing::SaveArg<2>(&sentBeaconChunk), testing::Return(IHTTPMultiClient::RequestID(42))));
+
+	// when
+	auto requestID = target->sendNextChunk(multiClient);
+
+	// then
+	ASSERT_EQ(IHTTPMultiClient::RequestID(42), requestID);
+	ASSERT_NE(nullptr, sentBeaconChunk);
+	ASSERT_NE(std::string::npos, sentBeaconChunk->toUTF8String().getStringData().find("et=10&na=event"));
+}
+
+TEST_F(BeaconTest, successfulChunkResponseRemovesSentData)
+{
+	// given
+	auto target = buildBeaconWithDefaultConfig();
+	target->reportEvent(1, core::UTF8String("event"));
+	auto multiClient = std::make_shared<testing::NiceMock<test::MockHTTPMultiClient>>();
+	ON_CALL(*multiClient, addBeaconRequest(testing::_, testing::_, testing::_))
+		.WillByDefault(testing::Return(IHTTPMultiClient::RequestID(1)));
+	target->sendNextChunk(multiClient);
+
+	// when
+	auto isChunkSent = target->handleChunkResponse(std::make_shared<StatusResponse>(getLogger(), "", 200, Response::ResponseHeaders()));
+
+	// then
+	ASSERT_TRUE(isChunkSent);
+	ASSERT_TRUE(target->isEmpty());
+}
+
+TEST_F(BeaconTest, failedChunkResponseKeepsData)
+{
+	// given
+	auto target = buildBeaconWithDefaultConfig();
+	target->reportEvent(1, core::UTF8String("event"));
+	auto multiClient = std::make_shared<testing::NiceMock<test::MockHTTPMultiClient>>();
+	ON_CALL(*multiClient, addBeaconRequest(testing::_, testing::_, testing::_))
+		.WillByDefault(testing::Return(IHTTPMultiClient::RequestID(1)));
+	target->sendNextChunk(multiClient);
+
+	// when
+	auto isChunkSentAfterError = target->handleChunkResponse(std::make_shared<StatusResponse>(getLogger(), "", 400, Response::ResponseHeaders()));
+	target->sendNextChunk(multiClient);
+	auto isChunkSentAfterAbort = target->handleChunkResponse(nullptr);
+
+	// then
+	ASSERT_FALSE(isChunkSentAfterError);
+	ASSERT_FALSE(isChunkSentAfterAbort);
+	ASSERT_FALSE(target->isEmpty());
+}
+
+TEST_F(BeaconTest, sendRetriesChunkFailingOnConnectionLevel)
+{
+	// given
+	auto target = buildBeaconWithDefaultConfig();
+	target->reportEvent(1, core::UTF8String("event"));
+	ON_CALL(*getHTTPClientProviderMock(), createClient(testing::_, testing::_))
+		.WillByDefault(testing::Return(getHTTPClientMock()));
+
+	// expect
+	EXPECT_CALL(*getHTTPClientMock(), sendBeaconRequestRawPtrProxy(testing::_, testing::_))
+		.WillOnce(testing::Return(new StatusResponse(getLogger(), "", std::numeric_limits<int32_t>::max(), Response::ResponseHeaders())))
+		.WillOnce(testing::Return(new StatusResponse(getLogger(), "", 200, Response::ResponseHeaders())));
+	EXPECT_CALL(*getTimingProviderMock(), sleep(testing::_))
+		.Times(testing::Exactly(1));
+
+	// when
+	auto response = target->send(getHTTPClientProviderMock());
+
+	// then
+	ASSERT_NE(nullptr, response);
+	ASSERT_EQ(200, response->getResponseCode());
+	ASSERT_TRUE(target->isEmpty());
+}
+
+TEST_F(BeaconTest, sendGivesUpAfterAllRetriesFailedOnConnectionLevel)
+{
+	// given
+	auto target = buildBeaconWithDefaultConfig();
+	target->reportEvent(1, core::UTF8String("event"));
+	ON_CALL(*getHTTPClientProviderMock(), createClient(testing::_, testing::_))
+		.WillByDefault(testing::Return(getHTTPClientMock()));
+	ON_CALL(*getHTTPClientMock(), sendBeaconRequestRawPtrProxy(testing::_, testing::_))
+		.WillByDefault(testing::InvokeWithoutArgs([this]() { return new StatusResponse(getLogger(), "", std::numeric_limits<int32_t>::max(), Response::ResponseHeaders()); }));
+
+	// expect the first attempt and all retries
+	auto maxRetries = getConfiguration()->getHTTPClientConfiguration()->getBeaconRequestRetryPolicy()->getMaxRetries();
+	EXPECT_CALL(*getHTTPClientMock(), sendBeaconRequestRawPtrProxy(testing::_, testing::_))
+		.Times(testing::Exactly(maxRetries + 1));
+	EXPECT_CALL(*getTimingProviderMock(), sleep(testing::_))
+		.Times(testing::Exactly(maxRetries));
+
+	// when
+	auto response = target->send(getHTTPClientProviderMock());
+
+	// then
+	ASSERT_NE(nullptr, response);
+	ASSERT_TRUE(response->isConnectionErrorResponse());
+	ASSERT_FALSE(target->isEmpty());
+}
+
+TEST_F(BeaconTest, sendDoesNotRetryErroneousHTTPResponse)
+{
+	// given
+	auto target = buildBeaconWithDefaultConfig();
+	target->reportEvent(1, core::UTF8String("event"));
+	ON_CALL(*getHTTPClientProviderMock(), createClient(testing::_, testing::_))
+		.WillByDefault(testing::Return(getHTTPClientMock()));
+
+	// expect
+	EXPECT_CALL(*getHTTPClientMock(), sendBeaconRequestRawPtrProxy(testing::_, testing::_))
+		.WillOnce(testing::Return(new StatusResponse(getLogger(), "", 400, Response::ResponseHeaders())));
+	EXPECT_CALL(*getTimingProviderMock(), sleep(testing::_))
+		.Times(testing::Exactly(0));
+
+	// when
+	auto response = target->send(getHTTPClientProviderMock());
+
+	// then
+	ASSERT_NE(nullptr, response);
+	ASSERT_EQ(400, response->getResponseCode());
+	ASSERT_FALSE(target->isEmpty());
+}
+
+TEST_F(BeaconTest, beaconWithSharedImmutableDataSendsSamePrefixAsBeaconWithOwnData)
+{
+	// given
+	auto beacon = buildBeaconWithDefaultConfig();
+	auto immutableBeaconData = std::make_shared<ImmutableBeaconData>(getConfiguration());
+	auto target = buildBeaconWithSharedImmutableData(immutableBeaconData);
+	beacon->reportEvent(1, core::UTF8String("event"));
+	target->reportEvent(1, core::UTF8String("event"));
+
+	auto multiClient = std::make_shared<testing::NiceMock<test::MockHTTPMultiClient>>();
+	std::shared_ptr<const caching::BeaconChunk> expectedChunk;
+	std::shared_ptr<const caching::BeaconChunk> sentChunk;
+	EXPECT_CALL(*multiClient, addBeaconRequest(testing::_, testing::_, testing::_))
+		.Times(testing::Exactly(2))
+		.WillOnce(testing::DoAll(testing::SaveArg<2>(&expectedChunk), testing::Return(IHTTPMultiClient::RequestID(1))))
+		.WillOnce(testing::DoAll(testing::SaveArg<2>(&sentChunk), testing::Return(IHTTPMultiClient::RequestID(2))));
+
+	// when
+	beacon->sendNextChunk(multiClient);
+	target->sendNextChunk(multiClient);
+
+	// then
+	ASSERT_NE(nullptr, expectedChunk);
+	ASSERT_NE(nullptr, sentChunk);
+	ASSERT_EQ(expectedChunk->toUTF8String(), sentChunk->toUTF8String());
+	ASSERT_EQ(0u, sentChunk->toUTF8String().getStringData().find(immutableBeaconData->getApplicationData().getStringData() + "&vi=deviceID&"));
+}
+
+TEST_F(BeaconTest, mutablePrefixDataIsUpdatedForEachChunk)
+{
+	// given
+	auto target = buildBeaconWithDefaultConfig();
+	auto multiClient = std::make_shared<testing::NiceMock<test::MockHTTPMultiClient>>();
+	std::shared_ptr<const caching::BeaconChunk> firstChunk;
+	std::shared_ptr<const caching::BeaconChunk> secondChunk;
+	EXPECT_CALL(*multiClient, addBeaconRequest(testing::_, testing::_, testing::_))
+		.Times(testing::Exactly(2))
+		.WillOnce(testing::DoAll(testing::SaveArg<2>(&firstChunk), testing::Return(IHTTPMultiClient::RequestID(1))))
+		.WillOnce(testing::DoAll(testing::SaveArg<2>(&secondChunk), testing::Return(IHTTPMultiClient::RequestID(2))));
+
+	auto timingProviderMock = getTimingProviderMock();
+	ON_CALL(*timingProviderMock, provideTimestampInMilliseconds())
+		.WillByDefault(testing::Return(1000));
+	target->reportEvent(1, core::UTF8String("first"));
+	target->sendNextChunk(multiClient);
+	target->handleChunkResponse(std::make_shared<StatusResponse>(getLogger(), "", 200, Response::ResponseHeaders()));
+
+	// when
+	ON_CALL(*timingProviderMock, provideTimestampInMilliseconds())
+		.WillByDefault(testing::Return(123456789));
+	target->reportEvent(1, core::UTF8String("second"));
+	target->sendNextChunk(multiClient);
+
+	// then
+	ASSERT_NE(nullptr, firstChunk);
+	ASSERT_NE(nullptr, secondChunk);
+	auto firstData = firstChunk->toUTF8String().getStringData();
+	auto secondData = secondChunk->toUTF8String().getStringData();
+	auto firstMutableData = firstData.find("&tv=");
+	auto secondMutableData = secondData.find("&tv=");
+	ASSERT_NE(std::string::npos, firstMutableData);
+	ASSERT_EQ(firstData.substr(0, firstMutableData), secondData.substr(0, secondMutableData));
+	ASSERT_NE(std::string::npos, firstData.find("&tx=1000&mp=1&"));
+	ASSERT_NE(std::string::npos, secondData.find("&tx=123456789&mp=1&"));
+	ASSERT_EQ(std::string::npos, secondData.find("&tx=1000"));
+}
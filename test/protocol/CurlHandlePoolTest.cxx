@@ -0,0 +1,221 @@
+/**
+* Copyright 2018 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "gtest/gtest.h"
+
+#include "protocol/CurlHandlePool.h"
+
+#include <chrono>
+#include <thread>
+
+using namespace protocol;
+
+class CurlHandlePoolTest : public testing::Test
+{
+public:
+	void SetUp()
+	{
+		curl_global_init(CURL_GLOBAL_DEFAULT);
+	}
+
+	void TearDown()
+	{
+		curl_global_cleanup();
+	}
+};
+
+TEST_F(CurlHandlePoolTest, aNewPoolHasNoIdleHandles)
+{
+	// given
+	CurlHandlePool target(4, std::chrono::milliseconds(60000));
+
+	// then
+	ASSERT_EQ(target.getNumberOfIdleHandles(), 0u);
+}
+
+TEST_F(CurlHandlePoolTest, releasedHandlesAreKeptUpToTheMaximum)
+{
+	// given
+	CurlHandlePool target(2, std::chrono::milliseconds(60000));
+	auto first = target.acquire();
+	auto second = target.acquire();
+	auto third = target.acquire();
+	ASSERT_NE(first, nullptr);
+	ASSERT_NE(second, nullptr);
+	ASSERT_NE(third, nullptr);
+
+	// when
+	target.release(first);
+	target.release(second);
+	target.release(third);
+
+	// then
+	ASSERT_EQ(target.getNumberOfIdleHandles(), 2u);
+}
+
+TEST_F(CurlHandlePoolTest, releasedHandlesAreNotKeptIfPoolSizeIsZero)
+{
+	// given
+	CurlHandlePool target(0, std::chrono::milliseconds(60000));
+	auto handle = target.acquire();
+
+	// when
+	target.release(handle);
+
+	// then
+	ASSERT_EQ(target.getNumberOfIdleHandles(), 0u);
+}
+
+TEST_F(CurlHandlePoolTest, acquireReusesAReleasedHandle)
+{
+	// given
+	CurlHandlePool target(4, std::chrono::milliseconds(60000));
+	auto first = target.acquire();
+	target.release(first);
+
+	// when
+	auto second = target.acquire();
+
+	// then
+	ASSERT_EQ(second, first);
+	ASSERT_EQ(target.getNumberOfIdleHandles(), 0u);
+
+	target.release(second);
+}
+
+TEST_F(CurlHandlePoolTest, idleHandlesAreDiscardedAfterIdleTimeout)
+{
+	// given
+	CurlHandlePool target(4, std::chrono::milliseconds(1));
+	target.release(target.acquire());
+	ASSERT_EQ(target.getNumberOfIdleHandles(), 1u);
+
+	// when
+	std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	auto handle = target.acquire();
+
+	// then
+	ASSERT_NE(handle, nullptr);
+	ASSERT_EQ(target.getNumberOfIdleHandles(), 0u);
+
+	target.release(handle);
+}
+
+TEST_F(CurlHandlePoolTest, clearRemovesAllIdleHandles)
+{
+	// given
+	CurlHandlePool target(4, std::chrono::milliseconds(60000));
+	auto first = target.acquire();
+	auto second = target.acquire();
+	target.release(first);
+	target.release(second);
+	ASSERT_EQ(target.getNumberOfIdleHandles(), 2u);
+
+	// when
+	target.clear();
+
+	// then
+	ASSERT_EQ(target.getNumberOfIdleHandles(), 0u);
+}
+
+TEST_F(CurlHandlePoolTest, noShareIsCreatedIfPoolSizeIsZero)
+{
+	// given
+	CurlHandlePool target(0, std::chrono::milliseconds(60000));
+
+	// when
+	auto handle = target.acquire();
+
+	// then
+	ASSERT_NE(handle, nullptr);
+	ASSERT_FALSE(target.hasShare());
+
+	target.release(handle);
+}
+
+TEST_F(CurlHandlePoolTest, clearReleasesTheShareIfNoHandleIsInUse)
+{
+	// given
+	CurlHandlePool target(4, std::chrono::milliseconds(60000));
+	target.release(target.acquire());
+	ASSERT_TRUE(target.hasShare());
+
+	// when
+	target.clear();
+
+	// then
+	ASSERT_FALSE(target.hasShare());
+}
+
+TEST_F(CurlHandlePoolTest, clearKeepsTheShareIfAHandleIsInUse)
+{
+	// given
+	CurlHandlePool target(4, std::chrono::milliseconds(60000));
+	auto handle = target.acquire();
+
+	// when
+	target.clear();
+
+	// then
+	ASSERT_TRUE(target.hasShare());
+
+	target.release(handle);
+}
+
+TEST_F(CurlHandlePoolTest, acquireCompressorReusesAReleasedCompressor)
+{
+	// given
+	CurlHandlePool target(4, std::chrono::milliseconds(60000));
+	auto first = target.acquireCompressor();
+	auto firstPtr = first.get();
+	target.releaseCompressor(std::move(first));
+	ASSERT_EQ(target.getNumberOfIdleCompressors(), 1u);
+
+	// when
+	auto second = target.acquireCompressor();
+
+	// then
+	ASSERT_EQ(second.get(), firstPtr);
+	ASSERT_EQ(target.getNumberOfIdleCompressors(), 0u);
+}
+
+TEST_F(CurlHandlePoolTest, releasedCompressorsAreNotKeptIfPoolSizeIsZero)
+{
+	// given
+	CurlHandlePool target(0, std::chrono::milliseconds(60000));
+	auto compressor = target.acquireCompressor();
+	ASSERT_NE(compressor, nullptr);
+
+	// when
+	target.releaseCompressor(std::move(compressor));
+
+	// then
+	ASSERT_EQ(target.getNumberOfIdleCompressors(), 0u);
+}
+
+TEST_F(CurlHandlePoolTest, clearRemovesAllIdleCompressors)
+{
+	// given
+	CurlHandlePool target(4, std::chrono::milliseconds(60000));
+	target.releaseCompressor(target.acquireCompressor());
+	ASSERT_EQ(target.getNumberOfIdleCompressors(), 1u);
+
+	// when
+	target.clear();
+
+	// then
+	ASSERT_EQ(target.getNumberOfIdleCompressors(), 0u);
+}
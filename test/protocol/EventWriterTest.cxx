@@ -0,0 +1,164 @@
+/**
+* Copyright 2018 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "protocol/EventWriter.h"
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <gtest/gtest.h>
+
+using namespace protocol;
+
+class EventWriterTest : public testing::Test
+{
+};
+
+TEST_F(EventWriterTest, newWriterIsEmpty)
+{
+	EventWriter target;
+
+	EXPECT_TRUE(target.empty());
+	EXPECT_TRUE(target.getData().empty());
+}
+
+TEST_F(EventWriterTest, firstKeyValuePairIsNotPrecededByDelimiter)
+{
+	EventWriter target;
+	target.addKeyValuePair("et", int32_t(1));
+
+	EXPECT_FALSE(target.empty());
+	EXPECT_EQ(target.getData().getStringData(), "et=1");
+}
+
+TEST_F(EventWriterTest, consecutiveKeyValuePairsAreDelimited)
+{
+	EventWriter target;
+	target.addKeyValuePair("et", int32_t(12));
+	target.addKeyValuePair("na", core::UTF8String("name"));
+	target.addKeyValuePair("t0", int64_t(42));
+
+	EXPECT_EQ(target.getData().getStringData(), "et=12&na=name&t0=42");
+}
+
+TEST_F(EventWriterTest, stringValuesAreURLEncoded)
+{
+	EventWriter target;
+	target.addKeyValuePair("na", core::UTF8String("q=greater than 5\xD7\xAA"));
+
+	auto data = target.getData();
+	EXPECT_EQ(data.getStringData(), "na=q%3Dgreater%20than%205%D7%AA");
+	EXPECT_EQ(data.getStringLength(), data.getStringData().size());
+}
+
+TEST_F(EventWriterTest, emptyStringValueOnlyWritesKey)
+{
+	EventWriter target;
+	target.addKeyValuePair("rs", core::UTF8String());
+
+	EXPECT_EQ(target.getData().getStringData(), "rs=");
+}
+
+TEST_F(EventWriterTest, int32ValuesAreFormattedLikeToString)
+{
+	const int32_t values[] = { 0, 1, -1, 9, 10, 123456789, std::numeric_limits<int32_t>::max(), std::numeric_limits<int32_t>::min() };
+	for (auto value : values)
+	{
+		EventWriter target;
+		target.addKeyValuePair("vl", value);
+
+		EXPECT_EQ(target.getData().getStringData(), "vl=" + std::to_string(value));
+	}
+}
+
+TEST_F(EventWriterTest, int64ValuesAreFormattedLikeToString)
+{
+	const int64_t values[] = { 0, -1, 1543234567890, std::numeric_limits<int64_t>::max(), std::numeric_limits<int64_t>::min() };
+	for (auto value : values)
+	{
+		EventWriter target;
+		target.addKeyValuePair("vl", value);
+
+		EXPECT_EQ(target.getData().getStringData(), "vl=" + std::to_string(value));
+	}
+}
+
+TEST_F(EventWriterTest, doubleValuesAreFormattedLikeToString)
+{
+	const double values[] = { 0.0, -0.5, 3.14159265, 1e-9, 1e20, std::numeric_limits<double>::max(), -std::numeric_limits<double>::max() };
+	for (auto value : values)
+	{
+		EventWriter target;
+		target.addKeyValuePair("vl", value);
+
+		EXPECT_EQ(target.getData().getStringData(), "vl=" + std::to_string(value));
+	}
+}
+
+TEST_F(EventWriterTest, nestedWritersDoNotInterfere)
+{
+	EventWriter outer;
+	outer.addKeyValuePair("a", int32_t(1));
+
+	{
+		EventWriter inner;
+		inner.addKeyValuePair("b", int32_t(2));
+		EXPECT_EQ(inner.getData().getStringData(), "b=2");
+	}
+
+	outer.addKeyValuePair("c", int32_t(3));
+	EXPECT_EQ(outer.getData().getStringData(), "a=1&c=3");
+}
+
+TEST_F(EventWriterTest, consecutiveWritersStartEmpty)
+{
+	{
+		EventWriter first;
+		first.addKeyValuePair("a", int32_t(1));
+	}
+
+	EventWriter second;
+	EXPECT_TRUE(second.empty());
+}
+
+TEST_F(EventWriterTest, writerWithExternalBufferAppendsToExistingData)
+{
+	std::string buffer("vv=3");
+
+	{
+		EventWriter target(buffer);
+		target.addKeyValuePair("tx", int64_t(42));
+
+		EXPECT_FALSE(target.empty());
+		EXPECT_EQ(target.getData().getStringData(), "vv=3&tx=42");
+	}
+
+	EXPECT_EQ(buffer, "vv=3&tx=42");
+}
+
+TEST_F(EventWriterTest, writerWithExternalBufferDoesNotUseThreadLocalBuffer)
+{
+	std::string buffer;
+	EventWriter outer(buffer);
+	outer.addKeyValuePair("a", int32_t(1));
+
+	EventWriter inner;
+	EXPECT_TRUE(inner.empty());
+	inner.addKeyValuePair("b", int32_t(2));
+
+	EXPECT_EQ(buffer, "a=1");
+	EXPECT_EQ(inner.getData().getStringData(), "b=2");
+}
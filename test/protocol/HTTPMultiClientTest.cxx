@@ -0,0 +1,207 @@
+/**
+* Copyright 2018 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "protocol/HTTPMultiClient.h"
+#include "protocol/CurlHandlePool.h"
+#include "protocol/RetryPolicy.h"
+#include "configuration/HTTPClientConfiguration.h"
+
+#include "../protocol/NullLogger.h"
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <thread>
+
+using namespace protocol;
+
+// nothing listens on port 1, so connecting fails immediately with CURLE_COULDNT_CONNECT
+static const char UNREACHABLE_URL[] = "http://127.0.0.1:1";
+
+class HTTPMultiClientTest : public testing::Test
+{
+public:
+	HTTPMultiClientTest()
+		: mLogger(nullptr)
+		, mHandlePool(nullptr)
+	{
+	}
+
+	void SetUp()
+	{
+		curl_global_init(CURL_GLOBAL_DEFAULT);
+		mLogger = std::make_shared<NullLogger>();
+		mHandlePool = std::make_shared<CurlHandlePool>(4, std::chrono::milliseconds(60000));
+	}
+
+	void TearDown()
+	{
+		mHandlePool = nullptr;
+		curl_global_cleanup();
+	}
+
+	std::shared_ptr<configuration::HTTPClientConfiguration> createConfiguration(uint32_t maxRetries, int64_t retryDelayInMilliseconds)
+	{
+		auto beaconRequestRetryPolicy = std::make_shared<RetryPolicy>(maxRetries, retryDelayInMilliseconds, retryDelayInMilliseconds, 0.0);
+		return std::make_shared<configuration::HTTPClientConfiguration>(core::UTF8String(UNREACHABLE_URL), 1, core::UTF8String("appID"), nullptr,
+			configuration::HTTPClientConfiguration::DEFAULT_HTTP_CLIENT_POOL_SIZE,
+			configuration::HTTPClientConfiguration::DEFAULT_HTTP_CLIENT_IDLE_TIMEOUT_IN_MILLIS,
+			configuration::HTTPClientConfiguration::DEFAULT_MAX_CONCURRENT_BEACON_REQUESTS,
+			configuration::HTTPClientConfiguration::DEFAULT_NEW_SESSION_REQUEST_BATCH_WINDOW_IN_MILLIS,
+			nullptr, nullptr, beaconRequestRetryPolicy);
+	}
+
+	std::shared_ptr<openkit::ILogger> mLogger;
+	std::shared_ptr<CurlHandlePool> mHandlePool;
+};
+
+TEST_F(HTTPMultiClientTest, aNewClientHasNoPendingRequests)
+{
+	// given
+	HTTPMultiClient target(mLogger, mHandlePool);
+
+	// then
+	ASSERT_EQ(target.getNumberOfPendingRequests(), 0u);
+	ASSERT_EQ(target.getMillisecondsUntilNextRetry(), 0);
+	ASSERT_TRUE(target.waitForCompletedRequests().empty());
+}
+
+TEST_F(HTTPMultiClientTest, requestWithoutRetriesCompletesWithConnectionError)
+{
+	// given
+	HTTPMultiClient target(mLogger, mHandlePool);
+	auto requestID = target.addBeaconRequest(createConfiguration(0, 0), core::UTF8String(), nullptr);
+
+	// when
+	auto completedRequests = target.waitForCompletedRequests();
+
+	// then
+	ASSERT_EQ(completedRequests.size(), 1u);
+	ASSERT_EQ(completedRequests[0].requestID, requestID);
+	ASSERT_NE(completedRequests[0].response, nullptr);
+	ASSERT_TRUE(completedRequests[0].response->isConnectionErrorResponse());
+	ASSERT_EQ(target.getNumberOfPendingRequests(), 0u);
+}
+
+TEST_F(HTTPMultiClientTest, failedRequestIsScheduledForRetry)
+{
+	// given
+	HTTPMultiClient target(mLogger, mHandlePool);
+	target.addBeaconRequest(createConfiguration(1, 60000), core::UTF8String(), nullptr);
+
+	// when
+	auto completedRequests = target.waitForCompletedRequests();
+
+	// then
+	ASSERT_TRUE(completedRequests.empty());
+	ASSERT_EQ(target.getNumberOfPendingRequests(), 1u);
+	auto millisecondsUntilNextRetry = target.getMillisecondsUntilNextRetry();
+	ASSERT_GT(millisecondsUntilNextRetry, 0);
+	ASSERT_LE(millisecondsUntilNextRetry, 60001);
+}
+
+TEST_F(HTTPMultiClientTest, waitReturnsImmediatelyIfAllRequestsWaitForRetry)
+{
+	// given
+	HTTPMultiClient target(mLogger, mHandlePool);
+	target.addBeaconRequest(createConfiguration(1, 60000), core::UTF8String(), nullptr);
+	target.addBeaconRequest(createConfiguration(1, 60000), core::UTF8String(), nullptr);
+	ASSERT_TRUE(target.waitForCompletedRequests().empty());
+
+	// when
+	auto start = std::chrono::steady_clock::now();
+	auto completedRequests = target.waitForCompletedRequests();
+	auto duration = std::chrono::steady_clock::now() - start;
+
+	// then
+	ASSERT_TRUE(completedRequests.empty());
+	ASSERT_EQ(target.getNumberOfPendingRequests(), 2u);
+	ASSERT_LT(duration, std::chrono::seconds(1));
+}
+
+TEST_F(HTTPMultiClientTest, dueRetriesAreStartedUntilAllRetriesAreUsedUp)
+{
+	// given
+	HTTPMultiClient target(mLogger, mHandlePool);
+	auto requestID = target.addBeaconRequest(createConfiguration(2, 10), core::UTF8String(), nullptr);
+
+	// when
+	std::vector<IHTTPMultiClient::CompletedRequest> completedRequests;
+	auto numWaits = 0;
+	while (completedRequests.empty())
+	{
+		numWaits++;
+		ASSERT_LE(numWaits, 10);
+		std::this_thread::sleep_for(std::chrono::milliseconds(target.getMillisecondsUntilNextRetry()));
+		completedRequests = target.waitForCompletedRequests();
+	}
+
+	// then the first attempt and both retries failed
+	ASSERT_EQ(numWaits, 3);
+	ASSERT_EQ(completedRequests.size(), 1u);
+	ASSERT_EQ(completedRequests[0].requestID, requestID);
+	ASSERT_TRUE(completedRequests[0].response->isConnectionErrorResponse());
+	ASSERT_EQ(target.getNumberOfPendingRequests(), 0u);
+	ASSERT_EQ(target.getMillisecondsUntilNextRetry(), 0);
+}
+
+TEST_F(HTTPMultiClientTest, retryIsNotStartedBeforeItIsDue)
+{
+	// given
+	HTTPMultiClient target(mLogger, mHandlePool);
+	target.addBeaconRequest(createConfiguration(1, 60000), core::UTF8String(), nullptr);
+	ASSERT_TRUE(target.waitForCompletedRequests().empty());
+
+	// when
+	auto completedRequests = target.waitForCompletedRequests();
+
+	// then the request still waits for its only retry, instead of failing finally
+	ASSERT_TRUE(completedRequests.empty());
+	ASSERT_EQ(target.getNumberOfPendingRequests(), 1u);
+	ASSERT_GT(target.getMillisecondsUntilNextRetry(), 0);
+}
+
+TEST_F(HTTPMultiClientTest, cancelAllRequestsRemovesRequestsWaitingForRetry)
+{
+	// given
+	HTTPMultiClient target(mLogger, mHandlePool);
+	target.addBeaconRequest(createConfiguration(1, 60000), core::UTF8String(), nullptr);
+	ASSERT_TRUE(target.waitForCompletedRequests().empty());
+	ASSERT_EQ(target.getNumberOfPendingRequests(), 1u);
+
+	// when
+	target.cancelAllRequests();
+
+	// then
+	ASSERT_EQ(target.getNumberOfPendingRequests(), 0u);
+	ASSERT_EQ(target.getMillisecondsUntilNextRetry(), 0);
+	ASSERT_TRUE(target.waitForCompletedRequests().empty());
+}
+
+TEST_F(HTTPMultiClientTest, cancelAllRequestsRemovesRunningRequests)
+{
+	// given
+	HTTPMultiClient target(mLogger, mHandlePool);
+	target.addBeaconRequest(createConfiguration(1, 60000), core::UTF8String(), nullptr);
+	target.addBeaconRequest(createConfiguration(1, 60000), core::UTF8String(), nullptr);
+
+	// when
+	target.cancelAllRequests();
+
+	// then the easy handles were given back to the pool
+	ASSERT_EQ(target.getNumberOfPendingRequests(), 0u);
+	ASSERT_EQ(mHandlePool->getNumberOfIdleHandles(), 2u);
+}
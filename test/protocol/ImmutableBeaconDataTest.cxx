@@ -0,0 +1,97 @@
+/**
+* Copyright 2018 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#include "gtest/gtest.h"
+
+#include "protocol/ImmutableBeaconData.h"
+#include "protocol/ssl/SSLStrictTrustManager.h"
+#include "configuration/Configuration.h"
+#include "configuration/Device.h"
+#include "configuration/BeaconCacheConfiguration.h"
+#include "configuration/BeaconConfiguration.h"
+
+#include "../providers/MockSessionIDProvider.h"
+
+#include <string>
+
+using namespace protocol;
+
+class ImmutableBeaconDataTest : public testing::Test
+{
+protected:
+	std::shared_ptr<configuration::Configuration> createConfiguration(std::shared_ptr<configuration::Device> device, const core::UTF8String& applicationVersion)
+	{
+		auto beaconConfiguration = std::make_shared<configuration::BeaconConfiguration>(configuration::BeaconConfiguration::DEFAULT_MULTIPLICITY,
+			openkit::DataCollectionLevel::PERFORMANCE, openkit::CrashReportingLevel::OPT_OUT_CRASHES);
+
+		return std::make_shared<configuration::Configuration>(device, configuration::OpenKitType::Type::DYNATRACE,
+			core::UTF8String("appName"), applicationVersion, core::UTF8String("appID"), core::UTF8String("deviceID"), core::UTF8String(""),
+			std::make_shared<testing::NiceMock<test::MockSessionIDProvider>>(), std::make_shared<SSLStrictTrustManager>(),
+			std::make_shared<configuration::BeaconCacheConfiguration>(-1, -1, -1), beaconConfiguration);
+	}
+};
+
+TEST_F(ImmutableBeaconDataTest, applicationDataContainsVersionAndApplicationInformation)
+{
+	// given
+	auto device = std::make_shared<configuration::Device>(core::UTF8String(""), core::UTF8String(""), core::UTF8String(""));
+
+	// when
+	ImmutableBeaconData target(createConfiguration(device, core::UTF8String("1.2.3")));
+
+	// then
+	auto data = target.getApplicationData().getStringData();
+	ASSERT_EQ(0u, data.find("vv="));
+	ASSERT_NE(std::string::npos, data.find("&ap=appID&an=appName&vn=1.2.3&pt=1&tt=okc"));
+	ASSERT_EQ(std::string::npos, data.find("vi="));
+}
+
+TEST_F(ImmutableBeaconDataTest, applicationVersionIsOmittedIfEmpty)
+{
+	// given
+	auto device = std::make_shared<configuration::Device>(core::UTF8String(""), core::UTF8String(""), core::UTF8String(""));
+
+	// when
+	ImmutableBeaconData target(createConfiguration(device, core::UTF8String("")));
+
+	// then
+	ASSERT_EQ(std::string::npos, target.getApplicationData().getStringData().find("vn="));
+}
+
+TEST_F(ImmutableBeaconDataTest, deviceDataStartsWithDelimiterAndContainsDeviceInformation)
+{
+	// given
+	auto device = std::make_shared<configuration::Device>(core::UTF8String("os"), core::UTF8String("manufacturer"), core::UTF8String("model"));
+
+	// when
+	ImmutableBeaconData target(createConfiguration(device, core::UTF8String("")));
+
+	// then
+	ASSERT_EQ(std::string("&os=os&mf=manufacturer&md=model&dl=1&cl=1"), target.getDeviceData().getStringData());
+}
+
+TEST_F(ImmutableBeaconDataTest, emptyDeviceInformationIsOmitted)
+{
+	// given
+	auto device = std::make_shared<configuration::Device>(core::UTF8String(""), core::UTF8String(""), core::UTF8String(""));
+
+	// when
+	ImmutableBeaconData target(createConfiguration(device, core::UTF8String("")));
+
+	// then
+	ASSERT_EQ(std::string("&dl=1&cl=1"), target.getDeviceData().getStringData());
+}
@@ -28,6 +28,7 @@
 #include "caching/BeaconCache.h"
 #include "configuration/Configuration.h"
 #include "core/UTF8String.h"
+#include "core/UTF8StringView.h"
 #include "providers/ITimingProvider.h"
 #include "providers/IThreadIDProvider.h"
 
@@ -46,19 +47,40 @@ namespace test {
 			return protocol::Beacon::send(httpClientProvider);
 		}
 
-		void reportValue(int32_t actionID, const core::UTF8String& valueName, int32_t value) override
+		// views passed to the Beacon only live as long as the call, therefore mocked methods receive owned copies
+		void reportValue(int32_t actionID, const core::UTF8StringView& valueName, int32_t value) override
 		{
-			reportValueInt32(actionID, valueName, value);
+			reportValueInt32(actionID, valueName.toUTF8String(), value);
 		}
 
-		void reportValue(int32_t actionID, const core::UTF8String& valueName, double value) override
+		void reportValue(int32_t actionID, const core::UTF8StringView& valueName, double value) override
 		{
-			reportValueDouble(actionID, valueName, value);
+			reportValueDouble(actionID, valueName.toUTF8String(), value);
 		}
 
-		void reportValue(int32_t actionID, const core::UTF8String& valueName, const core::UTF8String& value) override
+		void reportValue(int32_t actionID, const core::UTF8StringView& valueName, const core::UTF8StringView& value) override
 		{
-			reportValueString(actionID, valueName, value);
+			reportValueString(actionID, valueName.toUTF8String(), value.toUTF8String());
+		}
+
+		void identifyUser(const core::UTF8StringView& userTag) override
+		{
+			identifyUser(userTag.toUTF8String());
+		}
+
+		void reportEvent(int32_t actionID, const core::UTF8StringView& eventName) override
+		{
+			reportEvent(actionID, eventName.toUTF8String());
+		}
+
+		void reportError(int32_t actionID, const core::UTF8StringView& errorName, int32_t errorCode, const core::UTF8StringView& reason) override
+		{
+			reportError(actionID, errorName.toUTF8String(), errorCode, reason.toUTF8String());
+		}
+
+		void reportCrash(const core::UTF8StringView& errorName, const core::UTF8StringView& reason, const core::UTF8StringView& stacktrace) override
+		{
+			reportCrash(errorName.toUTF8String(), reason.toUTF8String(), stacktrace.toUTF8String());
 		}
 
 		virtual ~MockBeacon() {}
@@ -41,9 +41,9 @@ namespace test {
 			return std::shared_ptr<protocol::TimeSyncResponse>(sendTimeSyncRequestRawPtrProxy());
 		}
 
-		virtual std::shared_ptr<protocol::StatusResponse> sendBeaconRequest(const core::UTF8String& clientIPAddress, const core::UTF8String& beaconData)
+		virtual std::shared_ptr<protocol::StatusResponse> sendBeaconRequest(const core::UTF8String& clientIPAddress, std::shared_ptr<const caching::BeaconChunk> beaconChunk)
 		{
-			return std::shared_ptr<protocol::StatusResponse>(sendBeaconRequestRawPtrProxy(clientIPAddress, beaconData));
+			return std::shared_ptr<protocol::StatusResponse>(sendBeaconRequestRawPtrProxy(clientIPAddress, beaconChunk));
 		}
 
 		virtual std::shared_ptr<protocol::StatusResponse> sendNewSessionRequest()
@@ -55,7 +55,7 @@ namespace test {
 
 		MOCK_METHOD0(sendStatusRequestRawPtrProxy, protocol::StatusResponse*());
 
-		MOCK_METHOD2(sendBeaconRequestRawPtrProxy, protocol::StatusResponse*(const core::UTF8String&, const core::UTF8String&));
+		MOCK_METHOD2(sendBeaconRequestRawPtrProxy, protocol::StatusResponse*(const core::UTF8String&, std::shared_ptr<const caching::BeaconChunk>));
 
 		MOCK_METHOD0(sendTimeSyncRequestRawPtrProxy, protocol::TimeSyncResponse*());
 
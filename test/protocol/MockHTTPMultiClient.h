@@ -0,0 +1,46 @@
+/**
+* Copyright 2018 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#ifndef _TEST_PROTOCOL_MOCKHTTPMULTICLIENT_H
+#define _TEST_PROTOCOL_MOCKHTTPMULTICLIENT_H
+
+#include "protocol/IHTTPMultiClient.h"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include <memory>
+#include <vector>
+
+namespace test {
+	class MockHTTPMultiClient : public protocol::IHTTPMultiClient
+	{
+	public:
+		MockHTTPMultiClient()
+		{
+		}
+
+		virtual ~MockHTTPMultiClient() {}
+
+		MOCK_METHOD3(addBeaconRequest, RequestID(std::shared_ptr<configuration::HTTPClientConfiguration>, const core::UTF8String&, std::shared_ptr<const caching::BeaconChunk>));
+		MOCK_METHOD0(waitForCompletedRequests, std::vector<CompletedRequest>());
+		MOCK_CONST_METHOD0(getMillisecondsUntilNextRetry, int64_t());
+		MOCK_METHOD0(cancelAllRequests, void());
+		MOCK_CONST_METHOD0(getNumberOfPendingRequests, size_t());
+	};
+}
+
+#endif
@@ -18,6 +18,8 @@
 
 #include <gtest/gtest.h>
 
+#include <limits>
+
 using namespace protocol;
 
 class ResponseTest : public testing::Test
@@ -122,6 +124,24 @@ TEST_F(ResponseTest, isTooManyRequestsResponseGivesFalseIfResponseCodeIsNotEqual
 	ASSERT_FALSE(target.isTooManyRequestsResponse());
 }
 
+TEST_F(ResponseTest, isConnectionErrorResponseGivesTrueIfResponseCodeIsMaxInt32)
+{
+	// given
+	auto target = TestResponse(logger, std::numeric_limits<int32_t>::max(), Response::ResponseHeaders());
+
+	// then
+	ASSERT_TRUE(target.isConnectionErrorResponse());
+}
+
+TEST_F(ResponseTest, isConnectionErrorResponseGivesFalseForHTTPResponseCodes)
+{
+	// given
+	auto target = TestResponse(logger, 503, Response::ResponseHeaders());
+
+	// then
+	ASSERT_FALSE(target.isConnectionErrorResponse());
+}
+
 TEST_F(ResponseTest, responseCodeIsSet)
 {
 	// given
@@ -145,6 +165,28 @@ TEST_F(ResponseTest, headersAreSet)
 	ASSERT_EQ(headers, target.getResponseHeaders());
 }
 
+TEST_F(ResponseTest, hasRetryAfterGivesFalseIfResponseKeyDoesNotExist)
+{
+	// given
+	auto target = TestResponse(logger, 503, Response::ResponseHeaders());
+
+	// then
+	ASSERT_FALSE(target.hasRetryAfter());
+}
+
+TEST_F(ResponseTest, hasRetryAfterGivesTrueIfResponseKeyExists)
+{
+	// given
+	auto responseHeaders = Response::ResponseHeaders
+	{
+		{ RESPONSE_KEY_RETRY_AFTER, std::vector<std::string>{ "10" } }
+	};
+	auto target = TestResponse(logger, 503, responseHeaders);
+
+	// then
+	ASSERT_TRUE(target.hasRetryAfter());
+}
+
 TEST_F(ResponseTest, getRetryAfterReturnsDefaultValueIfResponseKeyDoesNotExist)
 {
 	// given
@@ -0,0 +1,171 @@
+/**
+* Copyright 2018 Dynatrace LLC
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+
+#include "protocol/RetryPolicy.h"
+#include "protocol/StatusResponse.h"
+
+#include "../protocol/NullLogger.h"
+#include "../providers/MockPRNGenerator.h"
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+using namespace protocol;
+
+class RetryPolicyTest : public testing::Test
+{
+public:
+	RetryPolicyTest()
+		: mLogger(nullptr)
+		, mMockRandomGenerator(nullptr)
+	{
+	}
+
+	void SetUp()
+	{
+		mLogger = std::make_shared<NullLogger>();
+		mMockRandomGenerator = std::make_shared<testing::NiceMock<test::MockPRNGenerator>>();
+	}
+
+	std::shared_ptr<Response> createResponse(int32_t responseCode, const Response::ResponseHeaders& headers)
+	{
+		return std::make_shared<StatusResponse>(mLogger, core::UTF8String(), responseCode, headers);
+	}
+
+	std::shared_ptr<openkit::ILogger> mLogger;
+	std::shared_ptr<testing::NiceMock<test::MockPRNGenerator>> mMockRandomGenerator;
+};
+
+TEST_F(RetryPolicyTest, retriesAreAllowedUntilMaxRetriesIsReached)
+{
+	// given
+	RetryPolicy target(3, 100, 1000, 0.0);
+
+	// then
+	ASSERT_TRUE(target.isRetryAllowed(0));
+	ASSERT_TRUE(target.isRetryAllowed(2));
+	ASSERT_FALSE(target.isRetryAllowed(3));
+}
+
+TEST_F(RetryPolicyTest, noRetryIsAllowedIfMaxRetriesIsZero)
+{
+	// given
+	RetryPolicy target(0, 100, 1000, 0.0);
+
+	// then
+	ASSERT_FALSE(target.isRetryAllowed(0));
+}
+
+TEST_F(RetryPolicyTest, delayIsDoubledWithEachRetry)
+{
+	// given
+	RetryPolicy target(10, 100, 100000, 0.0);
+
+	// then
+	ASSERT_EQ(target.getRetryDelayInMilliseconds(0), 100);
+	ASSERT_EQ(target.getRetryDelayInMilliseconds(1), 200);
+	ASSERT_EQ(target.getRetryDelayInMilliseconds(2), 400);
+	ASSERT_EQ(target.getRetryDelayInMilliseconds(3), 800);
+}
+
+TEST_F(RetryPolicyTest, delayIsCappedByMaxDelay)
+{
+	// given
+	RetryPolicy target(100, 100, 1000, 0.0);
+
+	// then
+	ASSERT_EQ(target.getRetryDelayInMilliseconds(3), 800);
+	ASSERT_EQ(target.getRetryDelayInMilliseconds(4), 1000);
+	ASSERT_EQ(target.getRetryDelayInMilliseconds(99), 1000);
+}
+
+TEST_F(RetryPolicyTest, jitterShortensTheDelay)
+{
+	// given
+	RetryPolicy target(5, 1000, 10000, 0.5, mMockRandomGenerator);
+
+	// expect
+	EXPECT_CALL(*mMockRandomGenerator, nextInt64(1001))
+		.WillOnce(testing::Return(int64_t(300)));
+
+	// when
+	auto obtained = target.getRetryDelayInMilliseconds(1);
+
+	// then
+	ASSERT_EQ(obtained, 1700);
+}
+
+TEST_F(RetryPolicyTest, jitteredDelayStaysWithinBounds)
+{
+	// given
+	RetryPolicy target(5, 1000, 10000, 0.25);
+
+	// then
+	for (auto i = 0; i < 100; i++)
+	{
+		auto obtained = target.getRetryDelayInMilliseconds(2);
+		ASSERT_GE(obtained, 3000);
+		ASSERT_LE(obtained, 4000);
+	}
+}
+
+TEST_F(RetryPolicyTest, jitterFactorIsClampedToValidRange)
+{
+	// given
+	RetryPolicy tooLow(5, 1000, 10000, -1.0);
+	RetryPolicy tooHigh(5, 1000, 10000, 2.0);
+
+	// then
+	ASSERT_EQ(tooLow.getJitterFactor(), 0.0);
+	ASSERT_EQ(tooHigh.getJitterFactor(), 1.0);
+}
+
+TEST_F(RetryPolicyTest, retryAfterHeaderExtendsTheDelay)
+{
+	// given
+	RetryPolicy target(5, 1000, 10000, 0.0);
+	auto response = createResponse(503, Response::ResponseHeaders{ { "retry-after", { "30" } } });
+
+	// when
+	auto obtained = target.getRetryDelayInMilliseconds(0, response);
+
+	// then
+	ASSERT_EQ(obtained, 30 * 1000);
+}
+
+TEST_F(RetryPolicyTest, retryAfterHeaderDoesNotShortenTheDelay)
+{
+	// given
+	RetryPolicy target(5, 1000, 10000, 0.0);
+	auto response = createResponse(503, Response::ResponseHeaders{ { "retry-after", { "1" } } });
+
+	// when
+	auto obtained = target.getRetryDelayInMilliseconds(3, response);
+
+	// then
+	ASSERT_EQ(obtained, 8000);
+}
+
+TEST_F(RetryPolicyTest, responseWithoutRetryAfterHeaderUsesBackoffDelay)
+{
+	// given
+	RetryPolicy target(5, 1000, 10000, 0.0);
+
+	// then
+	ASSERT_EQ(target.getRetryDelayInMilliseconds(1, createResponse(500, Response::ResponseHeaders())), 2000);
+	ASSERT_EQ(target.getRetryDelayInMilliseconds(1, nullptr), 2000);
+}
@@ -18,6 +18,10 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <limits>
+#include <set>
+#include <thread>
+
 using namespace providers;
 
 class DefaultPRNGeneratorTest : public testing::Test
@@ -58,3 +62,59 @@ TEST_F(DefaultPRNGeneratorTest, DefaultPRNGeneratorProvidesPositiveUInt64)
 	// then
 	EXPECT_THAT(randomNumber, testing::AllOf(testing::Ge(int64_t(0)), testing::Lt(std::numeric_limits<int64_t>::max())));
 }
+
+TEST_F(DefaultPRNGeneratorTest, upperBoundOfOneAlwaysProvidesZero)
+{
+	for (auto i = 0; i < 100; i++)
+	{
+		ASSERT_EQ(randomGenerator.nextInt32(1), 0);
+		ASSERT_EQ(randomGenerator.nextInt64(1), 0);
+	}
+}
+
+TEST_F(DefaultPRNGeneratorTest, nonPositiveUpperBoundProvidesZero)
+{
+	// then
+	ASSERT_EQ(randomGenerator.nextInt32(0), 0);
+	ASSERT_EQ(randomGenerator.nextInt32(-5), 0);
+	ASSERT_EQ(randomGenerator.nextInt64(0), 0);
+	ASSERT_EQ(randomGenerator.nextInt64(std::numeric_limits<int64_t>::min()), 0);
+}
+
+TEST_F(DefaultPRNGeneratorTest, allValuesBelowSmallUpperBoundAreProvided)
+{
+	// given
+	std::set<int32_t> values32;
+	std::set<int64_t> values64;
+
+	// when
+	for (auto i = 0; i < 1000; i++)
+	{
+		values32.insert(randomGenerator.nextInt32(7));
+		values64.insert(randomGenerator.nextInt64(7));
+	}
+
+	// then
+	ASSERT_EQ(values32, (std::set<int32_t>{ 0, 1, 2, 3, 4, 5, 6 }));
+	ASSERT_EQ(values64, (std::set<int64_t>{ 0, 1, 2, 3, 4, 5, 6 }));
+}
+
+TEST_F(DefaultPRNGeneratorTest, instancesOnDifferentThreadsProvideNumbersWithinBounds)
+{
+	// given
+	const int64_t upperBound = (int64_t(1) << 62) + 1;
+	int64_t otherThreadNumber = -1;
+
+	// when
+	std::thread otherThread([&otherThreadNumber, upperBound]()
+	{
+		DefaultPRNGenerator generator;
+		otherThreadNumber = generator.nextInt64(upperBound);
+	});
+	otherThread.join();
+	auto randomNumber = randomGenerator.nextInt64(upperBound);
+
+	// then
+	EXPECT_THAT(otherThreadNumber, testing::AllOf(testing::Ge(int64_t(0)), testing::Lt(upperBound)));
+	EXPECT_THAT(randomNumber, testing::AllOf(testing::Ge(int64_t(0)), testing::Lt(upperBound)));
+}
@@ -17,6 +17,10 @@
 #include "providers/DefaultSessionIDProvider.h"
 #include <gtest/gtest.h>
 
+#include <set>
+#include <thread>
+#include <vector>
+
 using namespace providers;
 
 
@@ -87,4 +91,115 @@ TEST_F(DefaultSessionIDProviderTest, aProviderInitializedWithZeroProvidesMinSess
 
 	// then
 	ASSERT_EQ(actual, 1);
+}
+
+TEST_F(DefaultSessionIDProviderTest, concurrentlyProvidedSessionIDsAreUnique)
+{
+	// given
+	DefaultSessionIDProvider provider(0);
+	const size_t numThreads = 4;
+	const size_t numIDsPerThread = 1000;
+	std::vector<std::vector<int32_t>> sessionIDs(numThreads);
+
+	// when
+	std::vector<std::thread> threads;
+	for (size_t i = 0; i < numThreads; i++)
+	{
+		threads.emplace_back([&provider, &sessionIDs, i, numIDsPerThread]()
+		{
+			for (size_t j = 0; j < numIDsPerThread; j++)
+			{
+				sessionIDs[i].push_back(provider.getNextSessionID());
+			}
+		});
+	}
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	// then
+	std::set<int32_t> uniqueIDs;
+	for (const auto& threadIDs : sessionIDs)
+	{
+		uniqueIDs.insert(threadIDs.begin(), threadIDs.end());
+	}
+	ASSERT_EQ(uniqueIDs.size(), numThreads * numIDsPerThread);
+	ASSERT_EQ(*uniqueIDs.begin(), 1);
+	ASSERT_EQ(*uniqueIDs.rbegin(), int32_t(numThreads * numIDsPerThread));
+}
+
+TEST_F(DefaultSessionIDProviderTest, aProviderWithBlockSizeProvidesConsecutiveNumbersWithinAThread)
+{
+	//given
+	DefaultSessionIDProvider provider(0, 3);
+
+	// when
+	int32_t first = provider.getNextSessionID();
+	int32_t second = provider.getNextSessionID();
+	int32_t third = provider.getNextSessionID();
+	int32_t fourth = provider.getNextSessionID();
+
+	// then
+	ASSERT_EQ(first, 1);
+	ASSERT_EQ(second, 2);
+	ASSERT_EQ(third, 3);
+	ASSERT_EQ(fourth, 4);
+}
+
+TEST_F(DefaultSessionIDProviderTest, threadsReserveSeparateBlocks)
+{
+	//given
+	DefaultSessionIDProvider provider(0, 10);
+	int32_t otherThreadFirst = 0;
+	int32_t otherThreadSecond = 0;
+
+	// when
+	int32_t first = provider.getNextSessionID();
+	std::thread otherThread([&provider, &otherThreadFirst, &otherThreadSecond]()
+	{
+		otherThreadFirst = provider.getNextSessionID();
+		otherThreadSecond = provider.getNextSessionID();
+	});
+	otherThread.join();
+	int32_t second = provider.getNextSessionID();
+
+	// then
+	ASSERT_EQ(first, 1);
+	ASSERT_EQ(second, 2);
+	ASSERT_EQ(otherThreadFirst, 11);
+	ASSERT_EQ(otherThreadSecond, 12);
+}
+
+TEST_F(DefaultSessionIDProviderTest, aBlockIsTruncatedAtMaxIntValueAndWrapsToMinSessionIdValue)
+{
+	//given
+	DefaultSessionIDProvider provider(INT32_MAX - 2, 10);
+
+	//when
+	int32_t first = provider.getNextSessionID();
+	int32_t second = provider.getNextSessionID();
+	int32_t third = provider.getNextSessionID();
+
+	// then
+	ASSERT_EQ(first, INT32_MAX - 1);
+	ASSERT_EQ(second, INT32_MAX);
+	ASSERT_EQ(third, 1);
+}
+
+TEST_F(DefaultSessionIDProviderTest, aThreadOnlyKeepsTheBlockOfTheLastUsedProvider)
+{
+	//given
+	DefaultSessionIDProvider firstProvider(0, 10);
+	DefaultSessionIDProvider secondProvider(100, 10);
+
+	//when
+	int32_t first = firstProvider.getNextSessionID();
+	int32_t second = secondProvider.getNextSessionID();
+	int32_t third = firstProvider.getNextSessionID();
+
+	// then
+	ASSERT_EQ(first, 1);
+	ASSERT_EQ(second, 101);
+	ASSERT_EQ(third, 11);
 }
\ No newline at end of file
@@ -19,6 +19,11 @@
 
 #include <thread>
 
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 using namespace providers;
 
 class DefaultThreadIDProviderTest : public testing::Test
@@ -75,4 +80,58 @@ TEST_F(DefaultThreadIDProviderTest, convertNativeThreadIDToPositiveIntegerVerify
 
 	//verify
 	ASSERT_EQ(result, 0);
+}
+
+TEST_F(DefaultThreadIDProviderTest, threadIDIsStableWithinThread)
+{
+	// when
+	int32_t first = provider.getThreadID();
+	int32_t second = provider.getThreadID();
+
+	// then
+	ASSERT_EQ(first, second);
+}
+
+TEST_F(DefaultThreadIDProviderTest, threadIDIsComputedPerThread)
+{
+	// given
+	int32_t otherThreadID = -1;
+	int32_t expectedOtherThreadID = -1;
+
+	// when
+	std::thread otherThread([this, &otherThreadID, &expectedOtherThreadID]()
+	{
+		otherThreadID = provider.getThreadID();
+		int64_t hash = std::hash<std::thread::id>()(std::this_thread::get_id());
+		expectedOtherThreadID = DefaultThreadIDProvider::convertNativeThreadIDToPositiveInteger(hash);
+	});
+	otherThread.join();
+
+	// then
+	ASSERT_EQ(otherThreadID, expectedOtherThreadID);
+	ASSERT_NE(otherThreadID, provider.getThreadID());
+}
+
+TEST_F(DefaultThreadIDProviderTest, hashedThreadIDsAreProvidedByDefault)
+{
+	// then
+	ASSERT_FALSE(provider.isUsingKernelThreadIDs());
+	ASSERT_EQ(provider.getThreadID(), DefaultThreadIDProvider::getHashedThreadID());
+}
+
+TEST_F(DefaultThreadIDProviderTest, kernelThreadIDIsProvidedIfEnabled)
+{
+	// given
+	DefaultThreadIDProvider target(true);
+
+	// when
+	int32_t threadID = target.getThreadID();
+
+	// then
+	ASSERT_TRUE(target.isUsingKernelThreadIDs());
+	ASSERT_EQ(threadID, DefaultThreadIDProvider::getKernelThreadID());
+	ASSERT_GE(threadID, 0);
+#if defined(__linux__)
+	ASSERT_EQ(threadID, static_cast<int32_t>(syscall(SYS_gettid)));
+#endif
 }
\ No newline at end of file
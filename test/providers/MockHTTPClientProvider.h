@@ -38,6 +38,7 @@ namespace test {
 		virtual void globalDestroy() override {}
 
 		MOCK_METHOD2(createClient, std::shared_ptr<protocol::IHTTPClient>(std::shared_ptr<openkit::ILogger>, std::shared_ptr<configuration::HTTPClientConfiguration>));
+		MOCK_METHOD2(createMultiClient, std::shared_ptr<protocol::IHTTPMultiClient>(std::shared_ptr<openkit::ILogger>, std::shared_ptr<configuration::HTTPClientConfiguration>));
 	};
 }
 